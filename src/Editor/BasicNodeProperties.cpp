@@ -6,6 +6,9 @@
 #include <pvnlib/Novel/Data/Novel.h>
 #include <pvnlib/Novel/Event/EventChoice.h>
 
+#include "GraphView.h"
+#include "UndoHistory.h"
+
 BasicNodeProperties::BasicNodeProperties(GraphNode* node, QWidget *parent)
 	: QFrame(parent), currentlySelectedNode(node)
 {
@@ -47,8 +50,10 @@ void BasicNodeProperties::updateLabelInNode()
 {
 	QString lineEditText = ui.nodeNameLineEdit->text();
 	if (currentlySelectedNode->getLabel() != lineEditText) {
+		const QString oldLabel = currentlySelectedNode->getLabel();
+		GraphView* graphView = currentlySelectedNode->getGraphView();
 		// Scene rename below
-		if (Novel::getInstance().renameScene(currentlySelectedNode->getLabel(), lineEditText) == nullptr)
+		if (graphView == nullptr || !graphView->renameSceneNode(oldLabel, lineEditText))
 		{
 			QMessageBox(QMessageBox::Critical, tr("Invalid scene name"), tr("Scene with this name already exists, please provide another name."), QMessageBox::Ok).exec();
 			ui.nodeNameLineEdit->setText(currentlySelectedNode->getLabel()); // Revert change
@@ -56,49 +61,10 @@ void BasicNodeProperties::updateLabelInNode()
 		}
 		else
 		{
-			// todo move this or similar to lib -> void renameSceneJumpsFor(QString scene, QString oldJumpToSceneName, QString newJumpToSceneName);
-			// Update self jumps
-			for (auto& ev : *Novel::getInstance().getScene(lineEditText)->getEvents())
-			{
-				switch (ev->getComponentEventType())
-				{
-				case EventSubType::EVENT_CHOICE:
-					for (auto& choice : *static_cast<EventChoice*>(ev.get())->getChoices()) {
-						if (choice.jumpToSceneName == currentlySelectedNode->getLabel()) const_cast<Choice&>(choice).jumpToSceneName = lineEditText;
-					}
-					break;
-				case EventSubType::EVENT_JUMP:
-					auto evj = static_cast<EventJump*>(ev.get());
-					if (evj->jumpToSceneName == currentlySelectedNode->getLabel()) evj->jumpToSceneName = lineEditText;
-					break;
-				}
-			}
-
-			// Update jumps from other scenes to this
-			for (auto& conn : currentlySelectedNode->getConnectionPoints(GraphConnectionType::In))
-			{
-				for (auto& ev : *Novel::getInstance().getScene(conn->getSourceNodeName())->getEvents())
-				{
-					switch (ev->getComponentEventType())
-					{
-					case EventSubType::EVENT_CHOICE:
-						for (auto& choice : *static_cast<EventChoice*>(ev.get())->getChoices()) {
-							if (choice.jumpToSceneName == currentlySelectedNode->getLabel()) const_cast<Choice&>(choice).jumpToSceneName = lineEditText; //todo: fix this monster
-						}
-						break;
-					case EventSubType::EVENT_JUMP:
-						auto evj = static_cast<EventJump*>(ev.get());
-						if (evj->jumpToSceneName == currentlySelectedNode->getLabel()) evj->jumpToSceneName = lineEditText;
-						break;
-					}
-				}
-				
-			}
-
-
-
-			currentlySelectedNode->setLabel(lineEditText);
-			currentlySelectedNode->update();
+			UndoHistory::getInstance()->push(std::make_unique<CallbackCommand>(
+				[graphView, oldLabel, lineEditText] { graphView->renameSceneNode(lineEditText, oldLabel); },
+				[graphView, oldLabel, lineEditText] { graphView->renameSceneNode(oldLabel, lineEditText); },
+				(oldLabel.size() + lineEditText.size()) * sizeof(QChar)));
 			emit sceneUpdated(Novel::getInstance().getScene(lineEditText));
 
 		}
@@ -3,6 +3,8 @@
 #include <pvnlib/Novel/Data/Novel.h>
 #include <pvnlib/Novel/Event/EventChoice.h>
 
+#include "UndoHistory.h"
+
 ChoiceItemModel::ChoiceItemModel(EventChoice* parentEvent, GraphView* graph, QObject *parent)
 	: QAbstractTableModel(parent), parentEvent(parentEvent), choices(const_cast<std::vector<Choice>*>(parentEvent->getChoices())), graph(graph) //todo: fix this monster
 {
@@ -61,6 +63,12 @@ bool ChoiceItemModel::setData(const QModelIndex& index, const QVariant& value, i
 {
 	if (role == Qt::DisplayRole || role == Qt::EditRole) {
 		Choice& affectedRow = choices->at(index.row());
+		const uint row = index.row();
+		// Finds the Choice again on undo/redo, the EventChoice might have changed in between
+		auto choiceField = [row](auto field)
+		{
+			return [row, field](EventChoice& event) { return row < event.getChoices()->size() ? field(*event.getChoice(row)) : nullptr; };
+		};
 
 		switch (index.column())
 		{
@@ -68,8 +76,12 @@ bool ChoiceItemModel::setData(const QModelIndex& index, const QVariant& value, i
 			//affectedRow.name = value.toString();
 			break;
 		case Text:
+		{
+			const Translation oldTranslation = affectedRow.translation;
 			affectedRow.translation.setTranslation(NovelSettings::getInstance().language, value.toString());
+			UndoHistory::getInstance()->pushEventFieldChange<EventChoice, Translation>(*parentEvent, choiceField([](Choice& choice) { return &choice.translation; }), oldTranslation, affectedRow.translation, QString("choice%1/text").arg(row));
 			break;
+		}
 		case JumpToScene:
 			if (affectedRow.jumpToSceneName != value.toString()) {
 				graph->getNodeByName(affectedRow.parentEvent->parentScene->name)->disconnectFrom(affectedRow.jumpToSceneName);
@@ -78,14 +90,17 @@ bool ChoiceItemModel::setData(const QModelIndex& index, const QVariant& value, i
 					graph->getNodeByName(affectedRow.parentEvent->parentScene->name)->connectToNode(value.toString());
 				}
 			}
+			UndoHistory::getInstance()->pushEventFieldChange<EventChoice, QString>(*parentEvent, choiceField([](Choice& choice) { return &choice.jumpToSceneName; }), affectedRow.jumpToSceneName, value.toString(), QString("choice%1/jumpToSceneName").arg(row));
 			affectedRow.jumpToSceneName = value.toString();
 			break;
 		case Condition:
+			UndoHistory::getInstance()->pushEventFieldChange<EventChoice, QString>(*parentEvent, choiceField([](Choice& choice) { return &choice.condition; }), affectedRow.condition, value.toString(), QString("choice%1/condition").arg(row));
 			affectedRow.condition = value.toString();
 			break;
 		default:
 			return false;
 		}
+		Novel::getInstance().sceneChanged(*affectedRow.parentEvent->parentScene);
 
 		emit dataChanged(index, index, { Qt::DisplayRole | Qt::EditRole });
 		return true;
@@ -120,11 +135,35 @@ bool ChoiceItemModel::insertRows(int row, int count, const QModelIndex& parent)
 
 	beginInsertRows(QModelIndex(), row, row + count - 1);
 
+	// Through the EventChoice, so the JumpIndex learns about the shifted Choices
 	for (int rowNum = 0; rowNum < count; ++rowNum)
 	{
-		choices->emplace(choices->cbegin() + row + rowNum, parentEvent);
+		parentEvent->insertChoice(row + rowNum, Choice(parentEvent));
 	}
 
+	// Recorded, as the field changes find their Choices by row and the insertion shifts the rows after it
+	// The inserted Choices are empty, so it is enough to remember where they were
+	const QString sceneName = parentEvent->parentScene->name;
+	const uint eventIndex = parentEvent->getIndex();
+	UndoHistory::getInstance()->push(std::make_unique<CallbackCommand>(
+		[sceneName, eventIndex, row, count]
+		{
+			EventChoice* event = UndoHistory::findEvent<EventChoice>(sceneName, eventIndex);
+			if (event == nullptr || static_cast<size_t>(row + count) > event->getChoices()->size())
+				return;
+			for (int rowNum = 0; rowNum < count; ++rowNum)
+				event->removeChoice(row);
+		},
+		[sceneName, eventIndex, row, count]
+		{
+			EventChoice* event = UndoHistory::findEvent<EventChoice>(sceneName, eventIndex);
+			if (event == nullptr || static_cast<size_t>(row) > event->getChoices()->size())
+				return;
+			for (int rowNum = 0; rowNum < count; ++rowNum)
+				event->insertChoice(row + rowNum, Choice(event));
+		},
+		sceneName.size() * sizeof(QChar)));
+
 	endInsertRows();
 	return true;
 }
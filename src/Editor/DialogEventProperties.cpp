@@ -4,6 +4,8 @@
 #include <QMenu>
 
 #include "DialogItemModel.h"
+#include "pvnlib/Novel/Data/Novel.h"
+#include "UndoHistory.h"
 
 DialogEventProperties::DialogEventProperties(EventDialogue* dialogue, QWidget *parent)
 	: QFrame(parent), dialogue(dialogue)
@@ -89,7 +91,18 @@ void DialogEventProperties::changeTextEdit(const QModelIndex& index)
 void DialogEventProperties::changeModelItem()
 {
 	if (dialogue->getSentences()->size() > lastClickedModelIndex.row()) {
-		dialogue->getSentence(lastClickedModelIndex.row())->translation.setTranslation(NovelSettings::getInstance().language, ui.dialogTextEdit->toPlainText());
+		const uint row = lastClickedModelIndex.row();
+		Translation& translation = dialogue->getSentence(row)->translation;
+		const Translation oldTranslation = translation;
+		translation.setTranslation(NovelSettings::getInstance().language, ui.dialogTextEdit->toPlainText());
+		// Selecting a Sentence sets the same text again
+		if (translation == oldTranslation)
+			return;
+
+		UndoHistory::getInstance()->pushEventFieldChange<EventDialogue, Translation>(*dialogue,
+			[row](EventDialogue& event) { return row < event.getSentences()->size() ? &event.getSentence(row)->translation : nullptr; },
+			oldTranslation, translation, QString("sentence%1/text").arg(row));
+		Novel::getInstance().sceneChanged(*dialogue->parentScene);
 	}
 	else
 	{
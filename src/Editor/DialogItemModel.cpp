@@ -1,7 +1,10 @@
 #include "DialogItemModel.h"
 
+#include <pvnlib/Novel/Data/Novel.h>
 #include <pvnlib/Novel/Event/EventDialogue.h>
 
+#include "UndoHistory.h"
+
 DialogItemModel::DialogItemModel(EventDialogue* event, QObject* parent)
 	: QAbstractListModel(parent), parentEvent(event), sentences(const_cast<std::vector<Sentence>*>(event->getSentences())) //todo: fix this monster
 {}
@@ -42,7 +45,12 @@ bool DialogItemModel::setData(const QModelIndex& index, const QVariant& value, i
 {
 	if (role == Qt::DisplayRole || role == Qt::EditRole)
 	{
-		sentences->at(index.row()).displayedName = value.toString();
+		const uint row = index.row();
+		UndoHistory::getInstance()->pushEventFieldChange<EventDialogue, QString>(*parentEvent,
+			[row](EventDialogue& event) { return row < event.getSentences()->size() ? &event.getSentence(row)->displayedName : nullptr; },
+			sentences->at(row).displayedName, value.toString());
+		sentences->at(row).displayedName = value.toString();
+		Novel::getInstance().markDirty(Novel::DataKind::Scene, parentEvent->parentScene->name);
 
 		emit dataChanged(index, index, { Qt::DisplayRole | Qt::EditRole });
 		return true;
@@ -72,6 +80,32 @@ bool DialogItemModel::insertRows(int row, int count, const QModelIndex& parent)
 		sentences->emplace(sentences->cbegin() + row + rowNum, Sentence(parentEvent));
 	}
 
+	Novel::getInstance().markDirty(Novel::DataKind::Scene, parentEvent->parentScene->name);
+
+	// The inserted Sentences are empty, so it is enough to remember where they were
+	const QString sceneName = parentEvent->parentScene->name;
+	const uint eventIndex = parentEvent->getIndex();
+	UndoHistory::getInstance()->push(std::make_unique<CallbackCommand>(
+		[sceneName, eventIndex, row, count]
+		{
+			EventDialogue* event = UndoHistory::findEvent<EventDialogue>(sceneName, eventIndex);
+			if (event == nullptr || static_cast<size_t>(row + count) > event->getSentences()->size())
+				return;
+			for (int rowNum = 0; rowNum < count; ++rowNum)
+				event->removeSentence(row);
+			Novel::getInstance().markDirty(Novel::DataKind::Scene, sceneName);
+		},
+		[sceneName, eventIndex, row, count]
+		{
+			EventDialogue* event = UndoHistory::findEvent<EventDialogue>(sceneName, eventIndex);
+			if (event == nullptr || static_cast<size_t>(row) > event->getSentences()->size())
+				return;
+			for (int rowNum = 0; rowNum < count; ++rowNum)
+				event->insertSentence(row + rowNum, Sentence(event));
+			Novel::getInstance().markDirty(Novel::DataKind::Scene, sceneName);
+		},
+		sceneName.size() * sizeof(QChar)));
+
 	endInsertRows();
 	return true;
 }
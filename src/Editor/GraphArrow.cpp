@@ -1,6 +1,8 @@
 #include "GraphArrow.h"
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
 #include "GraphConnectionPoint.h"
+#include "GraphView.h"
 
 GraphArrow::GraphArrow(std::shared_ptr<GraphConnectionPoint> source, std::shared_ptr<GraphConnectionPoint> dest)
 	: QGraphicsObject(nullptr), connectionSource(source.get()), connectionDestination(dest.get())
@@ -25,6 +27,9 @@ void GraphArrow::adjust()
 	QSizeF edgeOffset(connectionSource->boundingRect().size() / 2);
 	sourcePoint = line.p1() + QPointF{ edgeOffset.width(), edgeOffset.height() };
 	destinationPoint = line.p2() + QPointF{ edgeOffset.width(), edgeOffset.height() };
+
+	path = QPainterPath(sourcePoint);
+	path.cubicTo(QPointF{ sourcePoint.x(), (destinationPoint.y() + sourcePoint.y()) / 2 }, QPointF{ destinationPoint.x(), (destinationPoint.y() + sourcePoint.y()) / 2 }, destinationPoint);
 }
 
 QRectF GraphArrow::boundingRect() const
@@ -47,10 +52,14 @@ void GraphArrow::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
 		return;
 	}
 
-	QPainterPath path(sourcePoint);
-	path.cubicTo(QPointF{ sourcePoint.x(), (destinationPoint.y() + sourcePoint.y()) / 2 }, QPointF{ destinationPoint.x(), (destinationPoint.y() + sourcePoint.y()) / 2 }, destinationPoint);
+	if (sourcePoint == destinationPoint) {
+		return;
+	}
 
-	if (qFuzzyCompare(path.length(), qreal(0.))) {
+	// Zoomed out, a hairline straight line is enough to tell what is connected
+	if (QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) < GraphView::simplifiedDetailLevel) {
+		painter->setPen(QPen(Qt::black, 0));
+		painter->drawLine(sourcePoint, destinationPoint);
 		return;
 	}
 
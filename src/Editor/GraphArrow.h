@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QGraphicsObject>
+#include <QPainterPath>
 
 class GraphConnectionPoint;
 
@@ -25,6 +26,8 @@ public:
 private:
 	QPointF sourcePoint;
 	QPointF destinationPoint;
+	// Rebuilt only when the arrow moves, not on every repaint
+	QPainterPath path;
 
 	GraphConnectionPoint* connectionSource;
 	GraphConnectionPoint* connectionDestination;
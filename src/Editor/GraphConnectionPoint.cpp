@@ -1,5 +1,8 @@
 #include "GraphConnectionPoint.h"
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+#include "GraphView.h"
 
 GraphConnectionPoint::GraphConnectionPoint(QGraphicsObject* parent)
 	: QGraphicsObject(parent), pointBoundingRect(0, 0, 10, 10)
@@ -18,6 +21,10 @@ QRectF GraphConnectionPoint::boundingRect() const
 
 void GraphConnectionPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
+	// Too small to be seen or hovered when zoomed out
+	if (QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) < GraphView::simplifiedDetailLevel)
+		return;
+
 	painter->fillRect(pointBoundingRect, pointColor);
 }
 
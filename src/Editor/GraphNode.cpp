@@ -42,6 +42,9 @@ QList<std::shared_ptr<GraphConnectionPoint>> GraphNode::getConnectionPoints(Grap
 
 void GraphNode::setLabel(QString label)
 {
+	if (nodeBody.label == label)
+		return;
+	QString oldLabel = nodeBody.label;
 	nodeBody.label = label;
 
 	// Update input names for arrows
@@ -55,6 +58,8 @@ void GraphNode::setLabel(QString label)
 	{
 		elem.get()->setSourceNodeName(label);
 	}
+
+	emit labelChanged(oldLabel, label);
 }
 
 std::shared_ptr<GraphConnectionPoint> GraphNode::appendConnectionPoint(GraphConnectionType type)
@@ -247,22 +252,17 @@ QString GraphNode::getLabel() const
 
 bool GraphNode::connectToNode(QString nodeName)
 {
-	for(auto elem : scene()->items())
-	{
-		auto otherNode = dynamic_cast<GraphNode*>(elem);
-		if (otherNode != nullptr && otherNode->getLabel() == nodeName)
-		{
-			auto point = appendConnectionPoint(GraphConnectionType::Out);
-			auto otherPoint = otherNode->appendConnectionPoint(GraphConnectionType::In);
+	auto otherNode = findNodeByName(nodeName);
+	if (otherNode == nullptr)
+		return false;
 
-			connectPointTo(point, otherPoint);
-			outputConnectionPointList.last()->setSourceNodeName(getLabel());
-			outputConnectionPointList.last()->setDestinationNodeName(nodeName);
-			return true;
-		}
-	}
+	auto point = appendConnectionPoint(GraphConnectionType::Out);
+	auto otherPoint = otherNode->appendConnectionPoint(GraphConnectionType::In);
 
-	return false;
+	connectPointTo(point, otherPoint);
+	outputConnectionPointList.last()->setSourceNodeName(getLabel());
+	outputConnectionPointList.last()->setDestinationNodeName(nodeName);
+	return true;
 }
 
 bool GraphNode::disconnectFrom(QString nodeName)
@@ -287,21 +287,17 @@ bool GraphNode::disconnectFrom(QString nodeName)
 	}
 
 	// Find target node
-	for (auto node : scene()->items())
+	if (auto castNode = findNodeByName(nodeName))
 	{
-		auto castNode = dynamic_cast<GraphNode*>(node);
-		if (castNode && castNode->getLabel() == nodeName)
+		// Find connection in other node
+		for (const auto& connectionPoint : castNode->inputConnectionPointList)
 		{
-			// Find connection in other node
-			for (const auto& connectionPoint : castNode->inputConnectionPointList)
+			if (connectionPoint->isConnected() 
+				&& connectionPoint->getDestinationNodeName() == nodeName 
+				&& thisConnectionPoint->arrow.get() == connectionPoint->arrow.get())
 			{
-				if (connectionPoint->isConnected() 
-					&& connectionPoint->getDestinationNodeName() == nodeName 
-					&& thisConnectionPoint->arrow.get() == connectionPoint->arrow.get())
-				{
-					otherConnectionPoint = connectionPoint;
-					otherNode = castNode;
-				}
+				otherConnectionPoint = connectionPoint;
+				otherNode = castNode;
 			}
 		}
 	}
@@ -331,6 +327,26 @@ void GraphNode::setFlags()
 	setFlag(ItemIsSelectable);
 }
 
+GraphView* GraphNode::getGraphView() const
+{
+	if (scene() == nullptr)
+		return nullptr;
+
+	for (auto view : scene()->views())
+	{
+		if (auto graphView = dynamic_cast<GraphView*>(view))
+			return graphView;
+	}
+
+	return nullptr;
+}
+
+GraphNode* GraphNode::findNodeByName(const QString& nodeName) const
+{
+	GraphView* graphView = getGraphView();
+	return graphView ? graphView->getNodeByName(nodeName) : nullptr;
+}
+
 void GraphNode::serializableLoad(QDataStream& dataStream)
 {
 	QPointF pos;
@@ -7,6 +7,8 @@
 
 #include "pvnlib/Serialization.h"
 
+class GraphView;
+
 class GraphNode : public QGraphicsObject
 {
 	Q_OBJECT
@@ -47,12 +49,16 @@ public:
 	// Disconnects only from output nodes
 	// Disconnects this node from nodeName. It only disconnects it on the graph and does not do it in the lib
 	bool disconnectFrom(QString nodeName);
+	// GraphView showing this node's scene, nullptr if the node is not on a scene
+	GraphView* getGraphView() const;
 	
 public slots:
 	void setLabel(QString label);
 
 	signals:
 		void nodeDoubleClicked(GraphNode* node);
+		// Lets the GraphView keep its name index up to date
+		void labelChanged(const QString& oldLabel, const QString& newLabel);
 
 private:
 	QRectF nodeBoundingRect;
@@ -62,6 +68,8 @@ private:
 	QList<std::shared_ptr<GraphConnectionPoint>> outputConnectionPointList;
 
 	void setFlags();
+	// Finds the node through the name index of the GraphView showing this node's scene
+	GraphNode* findNodeByName(const QString& nodeName) const;
 
 
 public:
@@ -1,5 +1,8 @@
 #include "GraphNodeBody.h"
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+#include "GraphView.h"
 
 GraphNodeBody::GraphNodeBody(QGraphicsObject* parent, QRectF bBox)
 	: QGraphicsObject(parent), nodeBodyBoundingRect(bBox)
@@ -23,12 +26,21 @@ void GraphNodeBody::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 	//painter->setRenderHint(QPainter::Antialiasing);
 	//prepareGeometryChange();
 
+	QBrush brush(QColor{ 100, 100, 100, 240 }, Qt::SolidPattern);
+
+	// Zoomed out too far to read the label, so a plain rectangle is enough
+	if (QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) < GraphView::simplifiedDetailLevel)
+	{
+		painter->setPen(nodeBorderPen);
+		painter->setBrush(brush);
+		painter->drawRect(nodeBodyBoundingRect);
+		return;
+	}
+
 	// Draw nodebody
 	QPainterPath path;
 	path.addRoundedRect(nodeBodyBoundingRect, roundedCornersRadius, roundedCornersRadius);
 
-	QBrush brush(QColor{ 100, 100, 100, 240 }, Qt::SolidPattern);
-
 	// Draw body
 	painter->setPen(nodeBorderPen);
 	painter->fillPath(path, brush);
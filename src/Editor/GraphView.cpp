@@ -3,6 +3,7 @@
 #include <qinputdialog.h>
 #include <QKeyEvent>
 #include <QMenu>
+#include <QPainter>
 #include <qmessagebox.h>
 #include <ranges>
 #include <QPointF>
@@ -10,16 +11,19 @@
 #include "pvnlib/Novel/Data/Novel.h"
 #include "pvnlib/Novel/Event/EventChoice.h"
 #include "pvnlib/Novel/Event/EventJump.h"
+#include "UndoHistory.h"
 
 GraphView::GraphView(QWidget* parent) : QGraphicsView(parent)
 {
 	setCacheMode(CacheBackground);
-	setViewportUpdateMode(BoundingRectViewportUpdate);
+	// Repaints only the changed regions, a bounding rect of two distant changes could cover most of a big graph
+	setViewportUpdateMode(SmartViewportUpdate);
 	setRenderHint(QPainter::Antialiasing);
 	setTransformationAnchor(AnchorUnderMouse);
     //setDragMode(ScrollHandDrag);
 
     createContextMenu();
+    createGridBrush();
 }
 
 void GraphView::mousePressEvent(QMouseEvent* event)
@@ -52,15 +56,96 @@ void GraphView::mouseMoveEvent(QMouseEvent* event)
 
 }
 
-GraphNode* GraphView::getNodeByName(const QString& name)
+GraphNode* GraphView::getNodeByName(const QString& name) const
 {
-    for (auto node : scene()->items())
+    return nodesByName.value(name, nullptr);
+}
+
+void GraphView::addNode(GraphNode* node)
+{
+    scene()->addItem(node);
+    nodesByName.insert(node->getLabel(), node);
+
+    connect(node, &GraphNode::labelChanged, this, [this, node](const QString& oldLabel, const QString& newLabel)
     {
-        const auto castNodePtr = dynamic_cast<GraphNode*>(node);
-        if (castNodePtr != nullptr && castNodePtr->getLabel() == name) return castNodePtr;
+        nodesByName.remove(oldLabel, node);
+        nodesByName.insert(newLabel, node);
+    });
+}
+
+GraphNode* GraphView::createSceneNode(const QString& name, const QPointF& pos)
+{
+    if (!Novel::getInstance().getScenes()->contains(name))
+    {
+        Scene s;
+        s.name = name;
+        Novel::getInstance().addScene(std::move(s));
     }
 
-    return nullptr;
+    GraphNode* node = new GraphNode(pos.toPoint());
+    node->setLabel(name);
+    addNode(node);
+    return node;
+}
+
+void GraphView::removeSceneNode(GraphNode* node)
+{
+    // The jumps from other scenes to this one are cleared by the Novel when the Scene is removed
+    while(!node->getConnectionPoints(GraphConnectionType::In).isEmpty())
+    {
+        
+        if (auto* sourceNode = getNodeByName(node->getConnectionPoints(GraphConnectionType::In).first()->getSourceNodeName()))
+        {
+            sourceNode->disconnectFrom(node->getLabel());
+        }
+        else
+        {
+            qDebug() << "[GraphView] Found non existing node while removing the other";
+        }
+    }
+
+    while(!node->getConnectionPoints(GraphConnectionType::Out).isEmpty())
+    {
+        if (!node->disconnectFrom(node->getConnectionPoints(GraphConnectionType::Out).first()->getDestinationNodeName()))
+        {
+            qDebug() << "[GraphView] Found non existing node while removing the other";
+        }
+    }
+
+    emit nodeDeleted();
+
+    Novel::getInstance().removeScene(node->getLabel());
+    nodesByName.remove(node->getLabel(), node);
+    disconnect(node, &GraphNode::labelChanged, this, nullptr);
+    scene()->removeItem(node);
+}
+
+bool GraphView::renameSceneNode(const QString& oldName, const QString& newName)
+{
+    GraphNode* node = getNodeByName(oldName);
+    if (node == nullptr || Novel::getInstance().getScenes()->contains(newName) || Novel::getInstance().renameScene(oldName, newName) == nullptr)
+        return false;
+
+    // The jumps into the renamed Scene (including its own) are retargeted by the Novel
+    node->setLabel(newName);
+    node->update();
+    return true;
+}
+
+void GraphView::updateNodeConnections(const QString& sceneName)
+{
+    GraphNode* node = getNodeByName(sceneName);
+    if (node == nullptr)
+        return;
+
+    QStringList destinationNames;
+    for (const auto& connectionPoint : node->getConnectionPoints(GraphConnectionType::Out))
+        destinationNames.append(connectionPoint->getDestinationNodeName());
+    for (const QString& destinationName : destinationNames)
+        node->disconnectFrom(destinationName);
+
+    for (const JumpIndex::Jump& jump : Novel::getInstance().getJumpIndex().getJumpsFrom(sceneName))
+        node->connectToNode(jump.targetSceneName);
 }
 
 void GraphView::zoomIn()
@@ -100,46 +185,11 @@ void GraphView::wheelEvent(QWheelEvent* event)
 
 void GraphView::drawBackground(QPainter* painter, const QRectF& rect)
 {
-    // Grid
-    QPen pen;
-    pen.setStyle(Qt::DashLine);
-    pen.setWidth(2);
-    pen.setBrush(Qt::gray);
-    painter->setPen(pen);
-    
-    //auto visibleArea = mapToScene(pos());
-    //auto visibleArea = mapToScene(this->width(), this->height());
-    //auto visibleArea = mapToScene(rect.topLeft().toPoint());
-    auto visibleArea = mapToScene(this->viewport()->geometry()).boundingRect();
-
-    int step = 100;
-
-    // Horizontal
-    QLine hline({
-	                static_cast<int>(visibleArea.x()) - (static_cast<int>(visibleArea.x()) % step) - step,
-	                static_cast<int>(visibleArea.y()) - (static_cast<int>(visibleArea.y()) % step)
-                },
-                {
-	                static_cast<int>(visibleArea.x()) + static_cast<int>(visibleArea.width()),
-	                static_cast<int>(visibleArea.y()) - (static_cast<int>(visibleArea.y()) % step)
-                });
-    for (int i = 0; i < visibleArea.height() + step; i += step) {
-        painter->drawLine(hline);
-        hline.translate(0, step);
-    }
-    // Vertical
-    QLine vline({
-	                static_cast<int>(visibleArea.x()) - (static_cast<int>(visibleArea.x()) % step),
-	                static_cast<int>(visibleArea.y()) - (static_cast<int>(visibleArea.y()) % step) - step
-                },
-                {
-	                static_cast<int>(visibleArea.x()) - (static_cast<int>(visibleArea.x()) % step),
-	                static_cast<int>(visibleArea.y()) + static_cast<int>(visibleArea.height())
-                });
-    for (int i = 0; i < visibleArea.width() + step; i += step) {
-        painter->drawLine(vline);
-        vline.translate(step, 0);
-    }
+    // Grid, the brush origin keeps the cells aligned to the scene coordinates while the view is panned and zoomed
+    painter->save();
+    painter->setBrushOrigin(0, 0);
+    painter->fillRect(rect, gridBrush);
+    painter->restore();
 }
 
 void GraphView::scaleView(qreal scaleFactor)
@@ -180,10 +230,29 @@ void GraphView::createContextMenu()
     connect(removeNodeAction, &QAction::triggered, this, &GraphView::removeNode);
 }
 
+void GraphView::createGridBrush()
+{
+    QPixmap gridTile(gridStep, gridStep);
+    gridTile.fill(Qt::transparent);
+
+    QPen pen;
+    pen.setStyle(Qt::DashLine);
+    pen.setWidth(2);
+    pen.setBrush(Qt::gray);
+
+    QPainter tilePainter(&gridTile);
+    tilePainter.setPen(pen);
+    tilePainter.drawLine(0, 1, gridStep, 1);
+    tilePainter.drawLine(1, 0, 1, gridStep);
+    tilePainter.end();
+
+    gridBrush = QBrush(gridTile);
+}
+
 void GraphView::createNode()
 {
-    int step = 100;
-    QPoint roundedPos = QPoint{ static_cast<int>(std::round(contextMenuPosition.x() / step)) * step, static_cast<int>(std::round(contextMenuPosition.y() / step)) * step };
+    // Snap the node to the grid
+    QPoint roundedPos = QPoint{ static_cast<int>(std::round(contextMenuPosition.x() / gridStep)) * gridStep, static_cast<int>(std::round(contextMenuPosition.y() / gridStep)) * gridStep };
 
     QString name;
     bool pressedOk = false;
@@ -207,13 +276,19 @@ void GraphView::createNode()
     // Name is ok or pressed cancel
     if (pressedOk)
     {
-        Scene s;
-        s.name = name;
-        Novel::getInstance().addScene(std::move(s));
+        createSceneNode(name, roundedPos);
 
-        GraphNode* node = new GraphNode(roundedPos);
-        node->setLabel(name);
-        scene()->addItem(node);
+        UndoHistory::getInstance()->push(std::make_unique<CallbackCommand>(
+            [this, name]
+            {
+                if (GraphNode* node = getNodeByName(name))
+                    removeSceneNode(node);
+            },
+            [this, name, roundedPos]
+            {
+                createSceneNode(name, roundedPos);
+            },
+            name.size() * sizeof(QChar)));
     }
 }
 
@@ -224,55 +299,68 @@ void GraphView::removeNode()
     if (selectedNode == nullptr)
     {
         qDebug() << "[GraphView] Focused item is not GraphNode*";
+        return;
     }
 
-    // Update jumps from other scenes to this
-    for (auto& conn : selectedNode->getConnectionPoints(GraphConnectionType::In))
+    // Everything needed to bring the Scene back: the Scene itself in the binary format and the Jumps from the other Scenes, which the Novel clears
+    struct IncomingJump
     {
-        for (auto& ev : *Novel::getInstance().getScene(conn->getSourceNodeName())->getEvents())
-        {
-            switch (ev->getComponentEventType())
-            {
-            case EventSubType::EVENT_CHOICE:
-                for (auto& choice : *static_cast<EventChoice*>(ev.get())->getChoices()) {
-                    if (choice.jumpToSceneName == selectedNode->getLabel()) 
-                        const_cast<Choice&>(choice).jumpToSceneName = ""; //todo: refactorthis monster later
-                }
-                break;
-            case EventSubType::EVENT_JUMP:
-                auto evj = static_cast<EventJump*>(ev.get());
-                if (evj->jumpToSceneName == selectedNode->getLabel()) evj->jumpToSceneName = "";
-                break;
-            }
-        }
-
-    }
-
-    while(!selectedNode->getConnectionPoints(GraphConnectionType::In).isEmpty())
+        QString sourceSceneName;
+        uint    eventIndex;
+        int     choiceIndex;
+    };
+
+    const QString name = selectedNode->getLabel();
+    const QPointF pos  = selectedNode->pos();
+    QByteArray sceneData;
+    if (auto removedScene = Novel::getInstance().getScenes()->find(name); removedScene != Novel::getInstance().getScenes()->cend())
     {
-        
-        if (auto* node = getNodeByName(selectedNode->getConnectionPoints(GraphConnectionType::In).first()->getSourceNodeName()))
-        {
-            node->disconnectFrom(selectedNode->getLabel());
-        }
-        else
-        {
-            qDebug() << "[GraphView] Found non existing node while removing the other";
-        }
+        QDataStream dataStream(&sceneData, QIODeviceBase::WriteOnly);
+        dataStream << removedScene->second;
     }
+    std::vector<IncomingJump> incomingJumps;
+    for (const JumpIndex::Jump& jump : Novel::getInstance().getJumpIndex().getJumpsTo(name))
+        // The Scene's own Jumps are stored with it
+        if (jump.sourceSceneName != name)
+            incomingJumps.push_back(IncomingJump{ jump.sourceSceneName, jump.event->getIndex(), jump.choiceIndex });
 
-    while(!selectedNode->getConnectionPoints(GraphConnectionType::Out).isEmpty())
-    {
-        if (!selectedNode->disconnectFrom(selectedNode->getConnectionPoints(GraphConnectionType::Out).first()->getDestinationNodeName()))
+    removeSceneNode(selectedNode);
+
+    UndoHistory::getInstance()->push(std::make_unique<CallbackCommand>(
+        [this, name, pos, sceneData, incomingJumps]
         {
-            qDebug() << "[GraphView] Found non existing node while removing the other";
-        }
-    }
+            if (Novel::getInstance().getScenes()->contains(name))
+                return;
 
-    emit nodeDeleted();
+            Scene restoredScene;
+            QDataStream dataStream(sceneData);
+            dataStream >> restoredScene;
+            Novel::getInstance().addScene(std::move(restoredScene));
+            createSceneNode(name, pos);
+            updateNodeConnections(name);
 
-    Novel::getInstance().removeScene(selectedNode->getLabel());
-    scene()->removeItem(selectedNode);
+            for (const IncomingJump& incomingJump : incomingJumps)
+            {
+                if (incomingJump.choiceIndex == -1)
+                {
+                    if (EventJump* jump = UndoHistory::findEvent<EventJump>(incomingJump.sourceSceneName, incomingJump.eventIndex))
+                        jump->jumpToSceneName = name;
+                }
+                else if (EventChoice* choice = UndoHistory::findEvent<EventChoice>(incomingJump.sourceSceneName, incomingJump.eventIndex); choice && incomingJump.choiceIndex < static_cast<int>(choice->getChoices()->size()))
+                    choice->getChoice(incomingJump.choiceIndex)->jumpToSceneName = name;
+                else
+                    continue;
+
+                Novel::getInstance().sceneChanged(*Novel::getInstance().getScene(incomingJump.sourceSceneName));
+                updateNodeConnections(incomingJump.sourceSceneName);
+            }
+        },
+        [this, name]
+        {
+            if (GraphNode* node = getNodeByName(name))
+                removeSceneNode(node);
+        },
+        sceneData.size() + incomingJumps.size() * sizeof(IncomingJump)));
 }
 
 void GraphView::serializableLoad(QDataStream& dataStream)
@@ -284,29 +372,19 @@ void GraphView::serializableLoad(QDataStream& dataStream)
     {
         GraphNode* node = new GraphNode();
         dataStream >> *node;
-        scene()->addItem(node);
+        addNode(node);
     }
 
     // Cannot do both at the same time, because a node may be not constructed before, so there's no possible connection
     for (const auto& scenePair : *Novel::getInstance().getScenes())
     {
-        // If can get a node
+        // If can get a node, connect it wherever its Scene jumps to
         GraphNode* node = getNodeByName(scenePair.first);
-	    if (node != nullptr)
-	    {
-            // Look through all events and connect nodes wherever applicable
-		    for (const auto& ev : *scenePair.second.getEvents())
-		    {
-			    if (auto evj = dynamic_cast<EventJump*>(ev.get())) node->connectToNode(evj->jumpToSceneName);
-
-
-                else if (auto evc = dynamic_cast<EventChoice*>(ev.get()))
-                {
-	                for (const auto& choice : *evc->getChoices()) node->connectToNode(choice.jumpToSceneName);
-                }
-                // todo check if names of the nodes exist, though it should work anyway
-		    }
-	    }
+        if (node != nullptr)
+        {
+            for (const JumpIndex::Jump& jump : Novel::getInstance().getJumpIndex().getJumpsFrom(scenePair.first))
+                node->connectToNode(jump.targetSceneName);
+        }
     }
 }
 
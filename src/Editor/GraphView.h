@@ -1,5 +1,6 @@
 #pragma once
 #include <QGraphicsView>
+#include <QMultiHash>
 
 #include "GraphNode.h"
 #include "pvnlib/Serialization.h"
@@ -11,9 +12,24 @@ class GraphView : public QGraphicsView
 public:
 	GraphView(QWidget* parent = nullptr);
 
+	// Below this level of detail (roughly the zoom) the graph items skip their labels and curves and draw only their outlines
+	static constexpr qreal simplifiedDetailLevel = 0.35;
+
 	void mousePressEvent(QMouseEvent* event) override;
 	void mouseMoveEvent(QMouseEvent* event) override;
-	GraphNode* getNodeByName(const QString& name);
+	// Looks the node up in the name index, so it does not depend on the number of items on the scene
+	GraphNode* getNodeByName(const QString& name) const;
+	// Adds the node to the scene and to the name index, nodes added directly to the scene cannot be found by name
+	void addNode(GraphNode* node);
+
+	// Creates the Scene in the Novel together with its node
+	GraphNode* createSceneNode(const QString& name, const QPointF& pos);
+	// Removes the node's Scene from the Novel together with the node and its connections
+	void removeSceneNode(GraphNode* node);
+	// Renames the Scene in the Novel and its node, returns false if the Novel already has a Scene named `newName`
+	bool renameSceneNode(const QString& oldName, const QString& newName);
+	// Redraws the node's outgoing connections from the Jumps its Scene contains now
+	void updateNodeConnections(const QString& sceneName);
 
 public slots:
 	void zoomIn();
@@ -33,6 +49,7 @@ protected:
 
 private:
 	void createContextMenu();
+	void createGridBrush();
 
 	QPointF mousePressOrigin;
 	QPointF contextMenuPosition;
@@ -40,6 +57,13 @@ private:
 	QAction* createNodeAction;
 	QAction* removeNodeAction;
 
+	static constexpr int gridStep = 100;
+	// One grid cell, tiled over the background by the painter instead of drawing every line on each repaint
+	QBrush gridBrush;
+
+	// Multi, because the names are only unique once the user finishes renaming a node
+	QMultiHash<QString, GraphNode*> nodesByName;
+
 private slots:
 	void createNode();
 	void removeNode();
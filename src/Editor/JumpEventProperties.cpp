@@ -1,5 +1,8 @@
 #include "JumpEventProperties.h"
 
+#include "pvnlib/Novel/Data/Novel.h"
+#include "UndoHistory.h"
+
 JumpEventProperties::JumpEventProperties(EventJump* jump, GraphView* graph, QWidget *parent)
 	: QFrame(parent), jump(jump), graph(graph)
 {
@@ -56,10 +59,14 @@ void JumpEventProperties::updateJumpToScene()
 	}
 
 	ui.jumpToSceneLineEdit->setPalette(palette);
+	UndoHistory::getInstance()->pushEventFieldChange<EventJump, QString>(*jump, [](EventJump& jump) { return &jump.jumpToSceneName; }, jump->jumpToSceneName, nodeToJump, "jumpToSceneName");
 	jump->jumpToSceneName = nodeToJump;
+	Novel::getInstance().sceneChanged(*jump->parentScene);
 }
 
 void JumpEventProperties::updateCondition()
 {
+	UndoHistory::getInstance()->pushEventFieldChange<EventJump, QString>(*jump, [](EventJump& jump) { return &jump.condition; }, jump->condition, ui.conditionLineEdit->text(), "condition");
 	jump->condition = ui.conditionLineEdit->text();
+	Novel::getInstance().markDirty(Novel::DataKind::Scene, jump->parentScene->name);
 }
@@ -1,10 +1,12 @@
 ﻿#include "NAMSC_editor.h"
 
+#include <QApplication>
 #include <QDirIterator>
 #include <QInputDialog>
 #include <QMessageBox>
 #include <QMimeData>
 #include <QMimeDatabase>
+#include <QSet>
 
 #include <pvnlib/Novel/Data/Asset/AssetManager.h>
 #include <pvnlib/Novel/Event/EventDialogue.h>
@@ -20,6 +22,7 @@
 #include "Preview.h"
 #include "ProjectConfiguration.h"
 #include "SceneryObjectOnSceneProperties.h"
+#include "UndoHistory.h"
 
 void errorMessageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg)
 {
@@ -90,11 +93,12 @@ NAMSC_editor::NAMSC_editor(QWidget *parent) : QMainWindow(parent)
 
     //todo: does it need to be a pointer?
     scene = new QGraphicsScene(this);
-    scene->setSceneRect(ui.graphView->rect());
+    // The scene rect is left to grow with the nodes, so the BSP index spans the whole graph and the view can skip the off-screen items
+    // The visible area is controlled by the view's own scene rect
+    scene->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
 
     //todo: Move to custom class and do this in the constructor
     ui.graphView->setScene(scene);
-    scene->setSceneRect(this->rect());
 
     //debugConstructorActions(); -- todo: find out what they wanted to do with this
     setupAssetTree();
@@ -104,6 +108,12 @@ NAMSC_editor::NAMSC_editor(QWidget *parent) : QMainWindow(parent)
     prepareSwitchboard();
 
     createDanglingContextMenuActions();
+    createUndoActions();
+    createFindAction();
+
+    // Only the data changed since the last save is written, in the background, so it can run often without freezing the editor
+    connect(&autosaveTimer, &QTimer::timeout, this, &NAMSC_editor::autosave);
+    autosaveTimer.start(autosaveInterval);
 
     connect(ui.actionNew_project, &QAction::triggered, ProjectConfiguration::getInstance(), &ProjectConfiguration::createNewProject);
     connect(ui.assetsTree, &AssetTreeView::addAssetToObjects, ui.objectsTree, &ObjectsTree::addAssetToObjects);
@@ -111,6 +121,7 @@ NAMSC_editor::NAMSC_editor(QWidget *parent) : QMainWindow(parent)
     connect(ui.graphView, &GraphView::nodeDoubleClicked, this, [&](GraphNode* node)
         {
             sceneWidget->clearSceneryObjectWidgets();
+            previewedSceneName = node->getLabel();
             Novel::getInstance().getScene(node->getLabel())->scenery.render(sceneWidget);
             ui.middlePanelEditorStack->setCurrentIndex(1);
         });
@@ -205,6 +216,7 @@ void NAMSC_editor::prepareSwitchboard()
 void NAMSC_editor::loadEditor()
 {
     loadGraph(ui.graphView);
+    UndoHistory::getInstance()->clear();
 }
 
 void NAMSC_editor::saveEditor()
@@ -238,10 +250,10 @@ void NAMSC_editor::propertyTabChangeRequested(void* object, PropertyTypes dataTy
         break;
         case PropertyTypes::ObjectTreeItem:
             // todo: currently assuming it's always Image
-        	ui.propertiesLayout->addWidget(new ObjectPropertyPack(static_cast<SceneryObject*>(object)));
+        	ui.propertiesLayout->addWidget(new ObjectPropertyPack(static_cast<SceneryObject*>(object), SceneryObjectLocation::defaultSceneryObject(static_cast<SceneryObject*>(object)->name)));
             break;
         case PropertyTypes::CharacterTreeItem:
-            ui.propertiesLayout->addWidget(new ObjectPropertyPack(static_cast<SceneryObject*>(object)));
+            ui.propertiesLayout->addWidget(new ObjectPropertyPack(static_cast<SceneryObject*>(object), SceneryObjectLocation::defaultCharacter(static_cast<SceneryObject*>(object)->name)));
             break;
         case PropertyTypes::Scene:
         {
@@ -260,10 +272,17 @@ void NAMSC_editor::propertyTabChangeRequested(void* object, PropertyTypes dataTy
             ui.propertiesLayout->addWidget(new JumpEventProperties(static_cast<EventJump*>(object), ui.graphView));
             break;
         case PropertyTypes::ObjectOnScene:
-            ui.propertiesLayout->addWidget(new ObjectPropertyPack(static_cast<SceneryObject*>(object)));
-            ui.propertiesLayout->addWidget(new SceneryObjectOnSceneProperties(static_cast<SceneryObject*>(object)));
+        {
+            // Only the previewed Scene's Scenery is searched, the objects dropped onto the preview are the default ones
+            SceneryObject* sceneryObject = static_cast<SceneryObject*>(object);
+            Novel& novel = Novel::getInstance();
+            const Scenery* previewedScenery = novel.getScenes()->contains(previewedSceneName) ? &novel.getScene(previewedSceneName)->scenery : nullptr;
+            const SceneryObjectLocation location = SceneryObjectLocation::displayedIn(previewedSceneName, -1, previewedScenery, *sceneryObject);
+            ui.propertiesLayout->addWidget(new ObjectPropertyPack(sceneryObject, location));
+            ui.propertiesLayout->addWidget(new SceneryObjectOnSceneProperties(sceneryObject, location));
             break;
         }
+        }
 
         ui.propertiesLayout->addStretch();
     }
@@ -282,7 +301,7 @@ void NAMSC_editor::debugConstructorActions()
 
     node = new GraphNode;
     node->setLabel(scene1->name);
-    scene->addItem(node);
+    ui.graphView->addNode(node);
     
     QString scene2Name = QString("Scene 2");
     snovel.addScene(Scene(scene2Name));
@@ -302,7 +321,7 @@ void NAMSC_editor::debugConstructorActions()
     node2 = new GraphNode;
     node2->setLabel(scene2->name);
     //node2->appendConnectionPoint(GraphConnectionType::In);
-    scene->addItem(node2);
+    ui.graphView->addNode(node2);
 
     node->moveBy(-100, -100);
     node2->moveBy(300, 300);
@@ -372,6 +391,106 @@ void NAMSC_editor::createDanglingContextMenuActions()
 
 }
 
+void NAMSC_editor::createUndoActions()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+
+    undoAction = new QAction(tr("Undo"), this);
+    undoAction->setShortcut(QKeySequence::Undo);
+    undoAction->setEnabled(undoHistory->canUndo());
+    redoAction = new QAction(tr("Redo"), this);
+    redoAction->setShortcut(QKeySequence::Redo);
+    redoAction->setEnabled(undoHistory->canRedo());
+    ui.menuEdit->addAction(undoAction);
+    ui.menuEdit->addAction(redoAction);
+
+    connect(undoAction, &QAction::triggered, undoHistory, &UndoHistory::undo);
+    connect(redoAction, &QAction::triggered, undoHistory, &UndoHistory::redo);
+    connect(undoHistory, &UndoHistory::canUndoChanged, undoAction, &QAction::setEnabled);
+    connect(undoHistory, &UndoHistory::canRedoChanged, redoAction, &QAction::setEnabled);
+    // Typing into a field merges into one change until the focus moves elsewhere
+    connect(qApp, &QApplication::focusChanged, undoHistory, &UndoHistory::setMergeBoundary);
+
+    connect(undoHistory, &UndoHistory::sceneApplied, ui.graphView, &GraphView::updateNodeConnections);
+    // The property panels hold pointers into the changed data, so they are recreated for the current selection
+    connect(undoHistory, &UndoHistory::historyApplied, &switchboard, [&]
+        {
+            if (ui.graphView->scene()->selectedItems().isEmpty())
+            {
+                switchboard.nodeSelectionChanged(nullptr);
+            }
+            else {
+                switchboard.nodeSelectionChanged(qgraphicsitem_cast<GraphNode*>(ui.graphView->scene()->selectedItems()[0]));
+            }
+        });
+}
+
+void NAMSC_editor::createFindAction()
+{
+    findInProjectAction = new QAction(tr("Find in project..."), this);
+    findInProjectAction->setShortcut(QKeySequence::Find);
+    ui.menuEdit->addSeparator();
+    ui.menuEdit->addAction(findInProjectAction);
+
+    connect(findInProjectAction, &QAction::triggered, this, &NAMSC_editor::findInProject);
+}
+
+void NAMSC_editor::findInProject()
+{
+    bool pressedOk = false;
+    const QString query = QInputDialog::getText(this, tr("Find in project"), tr("Text, or the name of an asset, character, object, stat, event or scene:"), QLineEdit::Normal, "", &pressedOk).trimmed();
+    if (!pressedOk || query.isEmpty())
+        return;
+
+    // Text matches first, then every kind of a reference to the exact name
+    const SearchIndex& searchIndex = Novel::getInstance().getSearchIndex();
+    std::vector<SearchIndex::Location> locations = searchIndex.findText(query);
+    for (int type = static_cast<int>(SearchIndex::ReferenceType::Label); type != static_cast<int>(SearchIndex::ReferenceType::Count); ++type)
+    {
+        std::vector<SearchIndex::Location> references = searchIndex.findReferences(static_cast<SearchIndex::ReferenceType>(type), query);
+        locations.insert(locations.end(), references.cbegin(), references.cend());
+    }
+
+    QStringList items;
+    QStringList itemSceneNames;
+    QSet<QString> addedItems;
+    for (const SearchIndex::Location& location : locations)
+    {
+        QString item;
+        if (location.event == nullptr)
+            item = tr("%1: scenery").arg(location.sceneName);
+        else
+        {
+            item = tr("%1: event %2 \"%3\"").arg(location.sceneName).arg(location.event->getIndex() + 1).arg(location.event->label);
+            if (location.elementIndex != -1)
+                item += tr(", line %1").arg(location.elementIndex + 1);
+        }
+
+        if (addedItems.contains(item))
+            continue;
+        addedItems.insert(item);
+        items.append(item);
+        itemSceneNames.append(location.sceneName);
+    }
+
+    if (items.isEmpty())
+    {
+        QMessageBox(QMessageBox::Information, tr("Find in project"), tr("Nothing was found."), QMessageBox::Ok).exec();
+        return;
+    }
+
+    const QString chosenItem = QInputDialog::getItem(this, tr("Find in project"), tr("Found %n place(s):", "", items.size()), items, 0, false, &pressedOk);
+    if (!pressedOk)
+        return;
+
+    if (GraphNode* node = ui.graphView->getNodeByName(itemSceneNames[items.indexOf(chosenItem)]))
+    {
+        ui.graphView->scene()->clearSelection();
+        node->setSelected(true);
+        ui.graphView->centerOn(node);
+    }
+}
+
 void NAMSC_editor::invokeEventsContextMenu(const QPoint& pos)
 {
     QMenu menu(ui.eventsTree);
@@ -434,5 +553,12 @@ void NAMSC_editor::setupSupportedFormats()
 
 NAMSC_editor::~NAMSC_editor()
 {
+    autosave();
+    Novel::waitForDirtySaves();
+}
 
+void NAMSC_editor::autosave()
+{
+    if (Novel::getInstance().hasDirtyData())
+        Novel::getInstance().saveDirty();
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QFileSystemModel>
+#include <QTimer>
 
 #include "GraphNode.h"
 #include "ui_NAMSC_editor.h"
@@ -34,6 +35,10 @@ private:
     void setupEventTree();
 
     void createDanglingContextMenuActions();
+    void createUndoActions();
+    void createFindAction();
+    // Asks for a text or a name and selects the node of the Scene it was found in
+    void findInProject();
     void invokeEventsContextMenu(const QPoint& pos);
 
     void loadGraph(GraphView* graph);
@@ -41,6 +46,8 @@ private:
 
     void debugConstructorActions();
 
+    void autosave();
+
     PropertyConnectionSwitchboard switchboard;
     QGraphicsScene* scene; // todo remove?
     GraphNode* node;
@@ -52,12 +59,22 @@ private:
     QFileSystemModel* model;
     CustomSortFilterProxyModel* proxyFileFilter;
     SceneWidget* sceneWidget;
+    // Scene whose own Scenery is shown in the sceneWidget
+    QString previewedSceneName;
 
 
     QAction* addDialogueEventAction;
     QAction* addChoiceEventAction;
     QAction* addJumpEventAction;
 
+    QAction* undoAction;
+    QAction* redoAction;
+    QAction* findInProjectAction;
+
+    // In milliseconds
+    static constexpr int autosaveInterval = 5000;
+    QTimer autosaveTimer;
+
 
     Ui::NAMSC_editorClass ui;
 
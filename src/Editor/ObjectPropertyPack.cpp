@@ -3,11 +3,13 @@
 ObjectPropertyPack::ObjectPropertyPack(ObjectTreeWidgetItem* item)
 {
 	currentlySelectedObject = item->sceneryObject;
+	location = SceneryObjectLocation::defaultSceneryObject(item->sceneryObject->name);
 	layout = new QVBoxLayout(this);
 	initProperties();
 }
 
-ObjectPropertyPack::ObjectPropertyPack(SceneryObject* item)
+ObjectPropertyPack::ObjectPropertyPack(SceneryObject* item, const SceneryObjectLocation& location)
+	: location(location)
 {
 	currentlySelectedObject = item;
 	layout = new QVBoxLayout(this);
@@ -22,7 +24,7 @@ ObjectPropertyPack::~ObjectPropertyPack()
 
 void ObjectPropertyPack::initProperties()
 {
-	sceneryObjectTreeProperties = new SceneryObjectTreeProperties(currentlySelectedObject, layout->parentWidget());
+	sceneryObjectTreeProperties = new SceneryObjectTreeProperties(currentlySelectedObject, location, layout->parentWidget());
 
 	//layout->setSizeConstraint(QLayout::SetDefaultConstraint);
 	layout->addWidget(sceneryObjectTreeProperties);
@@ -9,11 +9,12 @@ class ObjectPropertyPack : public QFrame
 {
 public:
 	ObjectPropertyPack(ObjectTreeWidgetItem *item);
-	ObjectPropertyPack(SceneryObject* item);
+	ObjectPropertyPack(SceneryObject* item, const SceneryObjectLocation& location);
 	~ObjectPropertyPack();
 
 private:
 	SceneryObject* currentlySelectedObject;
+	SceneryObjectLocation location;
 
 	QLayout* layout;
 
@@ -20,5 +20,5 @@ void PropertyConnectionSwitchboard::objectSelectionChanged(QString sceneryObject
 
 void PropertyConnectionSwitchboard::characterSelectionChanged(QString characterName)
 {
-	emit characterSelectionChangedSignal(Novel::getInstance().getDefaultCharacter(characterName));
+	emit characterSelectionChangedSignal(Novel::getInstance().getDefaultCharacter(characterName), PropertyTypes::CharacterTreeItem);
 }
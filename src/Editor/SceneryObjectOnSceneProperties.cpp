@@ -1,7 +1,10 @@
 #include "SceneryObjectOnSceneProperties.h"
 
-SceneryObjectOnSceneProperties::SceneryObjectOnSceneProperties(SceneryObject* sceneryObject, QWidget *parent)
-	: QFrame(parent), sceneryObject(sceneryObject)
+#include "pvnlib/Novel/Data/Novel.h"
+#include "UndoHistory.h"
+
+SceneryObjectOnSceneProperties::SceneryObjectOnSceneProperties(SceneryObject* sceneryObject, const SceneryObjectLocation& location, QWidget *parent)
+	: QFrame(parent), sceneryObject(sceneryObject), location(location)
 {
 	ui.setupUi(this);
 
@@ -32,10 +35,14 @@ void SceneryObjectOnSceneProperties::prepareDataInUi()
 
 void SceneryObjectOnSceneProperties::updatePosX(int val)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<QPointF>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.pos; }, sceneryObject->pos, QPointF(val, sceneryObject->pos.y()), "pos");
 	sceneryObject->pos.setX(val);
+	location.markDirty();
 }
 
 void SceneryObjectOnSceneProperties::updatePosY(int val)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<QPointF>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.pos; }, sceneryObject->pos, QPointF(sceneryObject->pos.x(), val), "pos");
 	sceneryObject->pos.setY(val);
+	location.markDirty();
 }
\ No newline at end of file
@@ -3,13 +3,14 @@
 #include <QFrame>
 #include "ui_SceneryObjectOnSceneProperties.h"
 #include "pvnlib/Novel/Data/Visual/Scenery/SceneryObject.h"
+#include "UndoHistory.h"
 
 class SceneryObjectOnSceneProperties : public QFrame
 {
 	Q_OBJECT
 
 public:
-	SceneryObjectOnSceneProperties(SceneryObject* sceneryObject, QWidget *parent = nullptr);
+	SceneryObjectOnSceneProperties(SceneryObject* sceneryObject, const SceneryObjectLocation& location, QWidget *parent = nullptr);
 	~SceneryObjectOnSceneProperties();
 
 private:
@@ -18,6 +19,8 @@ private:
 	void prepareConnections();
 	void prepareDataInUi();
 	SceneryObject* sceneryObject;
+	// Where the undo/redo finds the SceneryObject again
+	SceneryObjectLocation location;
 
 	inline static bool expanded = false;
 
@@ -1,7 +1,10 @@
 #include "SceneryObjectTreeProperties.h"
 
-SceneryObjectTreeProperties::SceneryObjectTreeProperties(SceneryObject* sceneryObject, QWidget *parent)
-	: QFrame(parent), sceneryObject(sceneryObject)
+#include "pvnlib/Novel/Data/Novel.h"
+#include "UndoHistory.h"
+
+SceneryObjectTreeProperties::SceneryObjectTreeProperties(SceneryObject* sceneryObject, const SceneryObjectLocation& location, QWidget *parent)
+	: QFrame(parent), sceneryObject(sceneryObject), location(location)
 {
 	ui.setupUi(this);
 	ui.sceneryObjectTreeItemContent->setGeometry({ {0, 0}, ui.sceneryObjectCollapseButtonContent->totalSizeHint() });
@@ -39,24 +42,32 @@ void SceneryObjectTreeProperties::prepareDataInUi()
 
 void SceneryObjectTreeProperties::updateScaleX(double x)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<QSizeF>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.scale; }, sceneryObject->scale, QSizeF(x, sceneryObject->scale.height()), "scale");
 	sceneryObject->scale = QSizeF(x, sceneryObject->scale.height());
+	location.markDirty();
 	// todo eventually emit signal to inform about change
 }
 
 void SceneryObjectTreeProperties::updateScaleY(double y)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<QSizeF>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.scale; }, sceneryObject->scale, QSizeF(sceneryObject->scale.width(), y), "scale");
 	sceneryObject->scale = QSizeF(sceneryObject->scale.width(), y);
+	location.markDirty();
 	// todo eventually emit signal to inform about change
 }
 
 void SceneryObjectTreeProperties::updateAlphaMultiplier(double multiplier)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<double>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.alphaMultiplier; }, sceneryObject->alphaMultiplier, multiplier, "alphaMultiplier");
 	sceneryObject->alphaMultiplier = multiplier;
+	location.markDirty();
 	// todo eventually emit signal to inform about change
 }
 
 void SceneryObjectTreeProperties::updateRotation(double rotation)
 {
+	UndoHistory::getInstance()->pushSceneryObjectFieldChange<double>(location, [](SceneryObject& sceneryObject) { return &sceneryObject.rotationDegree; }, sceneryObject->rotationDegree, rotation, "rotationDegree");
 	sceneryObject->rotationDegree = rotation;
+	location.markDirty();
 	// todo eventually emit signal to inform about change
 }
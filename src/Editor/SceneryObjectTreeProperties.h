@@ -3,19 +3,22 @@
 #include <QFrame>
 #include "ui_SceneryObjectTreeProperties.h"
 #include "pvnlib/Novel/Data/Visual/Scenery/SceneryObject.h"
+#include "UndoHistory.h"
 
 class SceneryObjectTreeProperties : public QFrame
 {
 	Q_OBJECT
 
 public:
-	SceneryObjectTreeProperties(SceneryObject* sceneryObject, QWidget *parent = nullptr);
+	SceneryObjectTreeProperties(SceneryObject* sceneryObject, const SceneryObjectLocation& location, QWidget *parent = nullptr);
 	~SceneryObjectTreeProperties();
 
 private:
 	void prepareConnections();
 	void prepareDataInUi();
 	SceneryObject* sceneryObject;
+	// Where the undo/redo finds the SceneryObject again
+	SceneryObjectLocation location;
 
 	Ui::SceneryObjectTreePropertiesClass ui;
 
@@ -0,0 +1,263 @@
+#include "UndoHistory.h"
+
+SceneryObjectLocation SceneryObjectLocation::defaultSceneryObject(const QString& name)
+{
+	return SceneryObjectLocation{ Owner::DefaultSceneryObject, name };
+}
+
+SceneryObjectLocation SceneryObjectLocation::defaultCharacter(const QString& name)
+{
+	return SceneryObjectLocation{ Owner::DefaultCharacter, name };
+}
+
+SceneryObjectLocation SceneryObjectLocation::displayed(const QString& sceneName, int eventIndex, uint index, bool bCharacter)
+{
+	return SceneryObjectLocation{ Owner::Scenery, sceneName, eventIndex, index, bCharacter };
+}
+
+SceneryObjectLocation SceneryObjectLocation::displayedIn(const QString& sceneName, int eventIndex, const Scenery* scenery, const SceneryObject& sceneryObject)
+{
+	if (scenery)
+	{
+		const std::vector<SceneryObject>& sceneryObjects = *scenery->getDisplayedSceneryObjects();
+		for (uint i = 0; i != sceneryObjects.size(); ++i)
+			if (&sceneryObjects[i] == &sceneryObject)
+				return displayed(sceneName, eventIndex, i, false);
+
+		const std::vector<Character>& characters = *scenery->getDisplayedCharacters();
+		for (uint i = 0; i != characters.size(); ++i)
+			if (&characters[i] == &sceneryObject)
+				return displayed(sceneName, eventIndex, i, true);
+	}
+
+	if (dynamic_cast<const Character*>(&sceneryObject))
+		return defaultCharacter(sceneryObject.name);
+	return defaultSceneryObject(sceneryObject.name);
+}
+
+SceneryObject* SceneryObjectLocation::resolve() const
+{
+	Novel& novel = Novel::getInstance();
+	switch (owner)
+	{
+	case Owner::DefaultSceneryObject:
+		return novel.getDefaultSceneryObjects()->contains(name) ? novel.getDefaultSceneryObject(name) : nullptr;
+	case Owner::DefaultCharacter:
+		return novel.getDefaultCharacters()->contains(name) ? novel.getDefaultCharacter(name) : nullptr;
+	case Owner::Scenery:
+		break;
+	}
+
+	Scenery* scenery = nullptr;
+	if (eventIndex == -1)
+	{
+		if (!novel.getScenes()->contains(name))
+			return nullptr;
+		scenery = &novel.getScene(name)->scenery;
+	}
+	else if (Event* event = UndoHistory::findEvent<Event>(name, eventIndex))
+		scenery = &event->scenery;
+	else
+		return nullptr;
+
+	if (bCharacter)
+		return index < scenery->getDisplayedCharacters()->size() ? scenery->getDisplayedCharacter(index) : nullptr;
+	return index < scenery->getDisplayedSceneryObjects()->size() ? scenery->getDisplayedSceneryObject(index) : nullptr;
+}
+
+void SceneryObjectLocation::markDirty() const
+{
+	switch (owner)
+	{
+	case Owner::DefaultSceneryObject:
+		Novel::getInstance().markDirty(Novel::DataKind::SceneryObject, name);
+		break;
+	case Owner::DefaultCharacter:
+		Novel::getInstance().markDirty(Novel::DataKind::Character, name);
+		break;
+	case Owner::Scenery:
+		Novel::getInstance().markDirty(Novel::DataKind::Scene, name);
+		break;
+	}
+}
+
+QString SceneryObjectLocation::key() const
+{
+	switch (owner)
+	{
+	case Owner::DefaultSceneryObject:
+		return "sceneryObject:" + name;
+	case Owner::DefaultCharacter:
+		return "character:" + name;
+	default:
+		return QString("scene:%1/%2/%3%4").arg(name).arg(eventIndex).arg(bCharacter ? "character" : "sceneryObject").arg(index);
+	}
+}
+
+CallbackCommand::CallbackCommand(std::function<void()> undoCallback, std::function<void()> redoCallback, qsizetype memorySize)
+	: undoCallback(std::move(undoCallback)), redoCallback(std::move(redoCallback)), size(sizeof(*this) + memorySize)
+{}
+
+void CallbackCommand::undo()
+{
+	undoCallback();
+}
+
+void CallbackCommand::redo()
+{
+	redoCallback();
+}
+
+qsizetype CallbackCommand::memorySize() const
+{
+	return size;
+}
+
+UndoHistory::UndoHistory(QObject* parent)
+	: QObject(parent)
+{}
+
+UndoHistory::~UndoHistory()
+{}
+
+UndoHistory* UndoHistory::getInstance()
+{
+	static UndoHistory* instance;
+	if (instance == nullptr) instance = new UndoHistory();
+
+	return instance;
+}
+
+void UndoHistory::push(std::unique_ptr<UndoCommand> command)
+{
+	if (applying)
+		return;
+
+	const bool couldUndo = canUndo(),
+	           couldRedo = canRedo();
+
+	// The undone changes cannot be redone after a new one
+	while (commands.size() > currentIndex)
+	{
+		memoryUsed -= commands.back()->memorySize();
+		commands.pop_back();
+	}
+
+	// A pause or a merge boundary (e.g. focus-out) starts a new command, even for the same field
+	const bool canMerge = !mergeBoundary && lastPushTimer.isValid() && lastPushTimer.elapsed() < mergeInterval;
+	mergeBoundary = false;
+	lastPushTimer.start();
+
+	if (canMerge && !commands.empty())
+	{
+		UndoCommand& lastCommand = *commands.back();
+		const qsizetype lastSize = lastCommand.memorySize();
+		if (lastCommand.mergeWith(*command))
+		{
+			memoryUsed += lastCommand.memorySize() - lastSize;
+			emitStateChanges(couldUndo, couldRedo);
+			return;
+		}
+	}
+
+	memoryUsed += command->memorySize();
+	commands.push_back(std::move(command));
+	currentIndex = commands.size();
+
+	dropOldestCommands();
+	emitStateChanges(couldUndo, couldRedo);
+}
+
+void UndoHistory::setMergeBoundary()
+{
+	mergeBoundary = true;
+}
+
+bool UndoHistory::canUndo() const noexcept
+{
+	return currentIndex != 0;
+}
+
+bool UndoHistory::canRedo() const noexcept
+{
+	return currentIndex != commands.size();
+}
+
+bool UndoHistory::isApplying() const noexcept
+{
+	return applying;
+}
+
+void UndoHistory::setMemoryLimit(qsizetype bytes)
+{
+	const bool couldUndo = canUndo(),
+	           couldRedo = canRedo();
+
+	memoryLimit = bytes;
+	dropOldestCommands();
+	emitStateChanges(couldUndo, couldRedo);
+}
+
+void UndoHistory::clear()
+{
+	const bool couldUndo = canUndo(),
+	           couldRedo = canRedo();
+
+	commands.clear();
+	currentIndex  = 0;
+	memoryUsed    = 0;
+	mergeBoundary = true;
+	emitStateChanges(couldUndo, couldRedo);
+}
+
+void UndoHistory::undo()
+{
+	if (!canUndo())
+		return;
+
+	const bool couldRedo = canRedo();
+
+	applying = true;
+	commands[--currentIndex]->undo();
+	applying = false;
+	// The next change must not be merged into a command that was undone or redone
+	mergeBoundary = true;
+
+	emit historyApplied();
+	emitStateChanges(true, couldRedo);
+}
+
+void UndoHistory::redo()
+{
+	if (!canRedo())
+		return;
+
+	const bool couldUndo = canUndo();
+
+	applying = true;
+	commands[currentIndex++]->redo();
+	applying = false;
+	mergeBoundary = true;
+
+	emit historyApplied();
+	emitStateChanges(couldUndo, true);
+}
+
+void UndoHistory::dropOldestCommands()
+{
+	// The newest change is always kept, even if it alone is over the limit
+	while (memoryUsed > memoryLimit && commands.size() > 1 && currentIndex != 0)
+	{
+		memoryUsed -= commands.front()->memorySize();
+		commands.pop_front();
+		--currentIndex;
+	}
+}
+
+void UndoHistory::emitStateChanges(bool couldUndo, bool couldRedo)
+{
+	if (couldUndo != canUndo())
+		emit canUndoChanged(canUndo());
+	if (couldRedo != canRedo())
+		emit canRedoChanged(canRedo());
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QObject>
+#include <deque>
+#include <functional>
+#include <memory>
+
+#include "pvnlib/Novel/Data/Novel.h"
+#include "pvnlib/Serialization.h"
+
+// One undoable change, recorded after it was already made
+class UndoCommand
+{
+public:
+	virtual ~UndoCommand() = default;
+
+	virtual void undo() = 0;
+	virtual void redo() = 0;
+	// Approximate number of bytes held by the command, counted against the UndoHistory's memory limit
+	virtual qsizetype memorySize() const = 0;
+	// Absorbs the next change of the same field (e.g. every step of a spin box), returns false if it is a different change
+	virtual bool mergeWith(const UndoCommand& next) { return false; }
+};
+
+// Change of a single field, only the field's old and new value are kept, serialized in the same binary format as the project files
+template<typename T>
+class FieldChangeCommand final : public UndoCommand
+{
+public:
+	// resolveField should capture names and indices, not pointers, as the objects might have been recreated by other undos/redos in between
+	// onApplied lets the Novel and the views know after the field is changed
+	// fieldKey identifies the field for merging, an empty key never merges
+	FieldChangeCommand(std::function<T*()> resolveField, std::function<void()> onApplied, const T& oldValue, const T& newValue, const QString& fieldKey = QString())
+		: resolveField(std::move(resolveField)), onApplied(std::move(onApplied)), oldValue(serialize(oldValue)), newValue(serialize(newValue)), fieldKey(fieldKey)
+	{}
+
+	void undo() override { apply(oldValue); }
+	void redo() override { apply(newValue); }
+
+	qsizetype memorySize() const override
+	{
+		return sizeof(*this) + oldValue.size() + newValue.size() + fieldKey.size() * sizeof(QChar);
+	}
+
+	bool mergeWith(const UndoCommand& next) override
+	{
+		auto nextChange = dynamic_cast<const FieldChangeCommand<T>*>(&next);
+		if (fieldKey.isEmpty() || nextChange == nullptr || nextChange->fieldKey != fieldKey)
+			return false;
+
+		newValue = nextChange->newValue;
+		return true;
+	}
+
+private:
+	static QByteArray serialize(const T& value)
+	{
+		QByteArray data;
+		QDataStream dataStream(&data, QIODeviceBase::WriteOnly);
+		dataStream << value;
+		return data;
+	}
+
+	void apply(const QByteArray& value)
+	{
+		// Its object does not exist anymore
+		T* field = resolveField();
+		if (field == nullptr)
+			return;
+
+		// Loaded into a new value, as some types (e.g. Translation) only add to what they already contain
+		T loadedValue;
+		QDataStream dataStream(value);
+		dataStream >> loadedValue;
+		*field = std::move(loadedValue);
+		if (onApplied)
+			onApplied();
+	}
+
+	std::function<T*()> resolveField;
+	std::function<void()> onApplied;
+	QByteArray oldValue;
+	QByteArray newValue;
+	QString fieldKey;
+};
+
+// Where a SceneryObject is kept, passed by the views showing it, so undo/redo finds it again by its names and indices without scanning the Novel
+struct SceneryObjectLocation
+{
+	enum class Owner
+	{
+		DefaultSceneryObject,
+		DefaultCharacter,
+		// Displayed in the Scenery of a Scene or of one of its Events
+		Scenery
+	};
+
+	static SceneryObjectLocation defaultSceneryObject(const QString& name);
+	static SceneryObjectLocation defaultCharacter(const QString& name);
+	// eventIndex is -1 for the Scene's own Scenery, index is the position in the Scenery's displayed SceneryObjects or Characters
+	static SceneryObjectLocation displayed(const QString& sceneName, int eventIndex, uint index, bool bCharacter);
+	// Looks for the SceneryObject only in the given Scenery (if any), if it is not displayed there, it is one of the defaults
+	static SceneryObjectLocation displayedIn(const QString& sceneName, int eventIndex, const Scenery* scenery, const SceneryObject& sceneryObject);
+
+	// Returns nullptr if the SceneryObject does not exist anymore
+	SceneryObject* resolve() const;
+	// Marks the default SceneryObject or Character, or the Scene displaying it, to be saved
+	void markDirty() const;
+	// Identifies the SceneryObject for merging the changes of its fields
+	QString key() const;
+
+	Owner   owner      = Owner::DefaultSceneryObject;
+	// Name of the default SceneryObject or Character, or of the Scene displaying it
+	QString name;
+	int     eventIndex = -1;
+	uint    index      = 0;
+	bool    bCharacter = false;
+};
+
+// Change that is more than a field (e.g. adding or removing a Scene), whatever is needed to redo or undo it is captured in the functions
+class CallbackCommand final : public UndoCommand
+{
+public:
+	CallbackCommand(std::function<void()> undoCallback, std::function<void()> redoCallback, qsizetype memorySize);
+
+	void undo() override;
+	void redo() override;
+	qsizetype memorySize() const override;
+
+private:
+	std::function<void()> undoCallback;
+	std::function<void()> redoCallback;
+	qsizetype size;
+};
+
+// Undo/redo history of the editor
+// Undo and redo touch only the change itself, so they do not depend on the size of the project
+// The oldest changes are dropped once the history takes more memory than its limit
+class UndoHistory : public QObject
+{
+	Q_OBJECT
+
+public:
+	~UndoHistory();
+
+	static UndoHistory* getInstance();
+
+	// Records a change that was already made, dropping the undone changes
+	// Ignored while an undo or redo is being applied, so the views refreshing themselves do not record anything
+	// It is merged into the previous command only if that one was pushed less than `mergeInterval` ago and no merge boundary was set since
+	void push(std::unique_ptr<UndoCommand> command);
+	// The next change starts a new command, even if it changes the same field (e.g. the edited field lost focus)
+	void setMergeBoundary();
+
+	// Records a change of a field of the `event`, which is looked up again by its Scene's name and its index on every undo/redo
+	// Consecutive changes with the same non-empty `fieldName` are merged into one (e.g. typing into a line edit)
+	template<typename EventType, typename T>
+	void pushEventFieldChange(const EventType& event, std::function<T*(EventType&)> getField, const T& oldValue, const T& newValue, const QString& fieldName = QString());
+	// Records a change of a field of the default SceneryObject or Character, or the SceneryObject displayed in a Scenery
+	template<typename T>
+	void pushSceneryObjectFieldChange(const SceneryObjectLocation& location, std::function<T*(SceneryObject&)> getField, const T& oldValue, const T& newValue, const QString& fieldName);
+
+	bool canUndo() const noexcept;
+	bool canRedo() const noexcept;
+	bool isApplying() const noexcept;
+
+	void setMemoryLimit(qsizetype bytes);
+	void clear();
+
+	// Finds the Event without reporting errors, as the Scene or the Event might not exist anymore
+	template<typename EventType>
+	static EventType* findEvent(const QString& sceneName, uint eventIndex);
+
+public slots:
+	void undo();
+	void redo();
+
+signals:
+	void canUndoChanged(bool canUndo);
+	void canRedoChanged(bool canRedo);
+	// Emitted after an undo or redo, so the views can show the current data
+	void historyApplied();
+	// Emitted when an undo or redo changed the Scene (its Events, Jumps, etc.)
+	void sceneApplied(const QString& sceneName);
+
+private:
+	UndoHistory(QObject* parent = nullptr);
+	Q_DISABLE_COPY(UndoHistory);
+
+	void dropOldestCommands();
+	void emitStateChanges(bool couldUndo, bool couldRedo);
+
+	std::deque<std::unique_ptr<UndoCommand>> commands;
+	// The commands before it are done, the ones from it onwards are undone
+	size_t currentIndex = 0;
+	qsizetype memoryUsed = 0;
+	qsizetype memoryLimit = 16 * 1024 * 1024;
+	bool applying = false;
+
+	// Changes of the same field further apart than this are separate commands, so a long editing session is not undone at once
+	static constexpr qint64 mergeInterval = 2000;
+	QElapsedTimer lastPushTimer;
+	bool mergeBoundary = true;
+};
+
+template<typename EventType>
+EventType* UndoHistory::findEvent(const QString& sceneName, uint eventIndex)
+{
+	auto scene = Novel::getInstance().getScenes()->find(sceneName);
+	if (scene == Novel::getInstance().getScenes()->cend() || eventIndex >= scene->second.getEvents()->size())
+		return nullptr;
+
+	return dynamic_cast<EventType*>(scene->second.getEvents()->at(eventIndex).get());
+}
+
+template<typename EventType, typename T>
+void UndoHistory::pushEventFieldChange(const EventType& event, std::function<T*(EventType&)> getField, const T& oldValue, const T& newValue, const QString& fieldName)
+{
+	if (oldValue == newValue || event.parentScene == nullptr)
+		return;
+
+	const QString sceneName = event.parentScene->name;
+	const uint eventIndex = event.getIndex();
+	push(std::make_unique<FieldChangeCommand<T>>(
+		[sceneName, eventIndex, getField]() -> T*
+		{
+			EventType* foundEvent = findEvent<EventType>(sceneName, eventIndex);
+			return foundEvent ? getField(*foundEvent) : nullptr;
+		},
+		[this, sceneName]
+		{
+			Novel::getInstance().sceneChanged(*Novel::getInstance().getScene(sceneName));
+			emit sceneApplied(sceneName);
+		},
+		oldValue, newValue, fieldName.isEmpty() ? QString() : QString("scene:%1/%2/%3").arg(sceneName).arg(eventIndex).arg(fieldName)));
+}
+
+template<typename T>
+void UndoHistory::pushSceneryObjectFieldChange(const SceneryObjectLocation& location, std::function<T*(SceneryObject&)> getField, const T& oldValue, const T& newValue, const QString& fieldName)
+{
+	if (oldValue == newValue)
+		return;
+
+	push(std::make_unique<FieldChangeCommand<T>>(
+		[location, getField]() -> T*
+		{
+			SceneryObject* foundSceneryObject = location.resolve();
+			return foundSceneryObject ? getField(*foundSceneryObject) : nullptr;
+		},
+		[location]
+		{
+			location.markDirty();
+		},
+		oldValue, newValue, location.key() + '/' + fieldName));
+}
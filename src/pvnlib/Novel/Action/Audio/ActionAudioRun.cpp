@@ -1,5 +1,7 @@
 #include "pvnLib/Novel/Action/Audio/ActionAudioAll.h"
 
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+
 #include "pvnLib/Novel/Data/Save/NovelState.h"
 #include "pvnLib/Novel/Data/Scene.h"
 
@@ -8,6 +10,9 @@ void ActionAudioSetMusic::run()
 	//qDebug() << "ActionAudioSetMusic::run in Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
 	ActionAudio::run();
 
+	NovelState::getCurrentlyLoadedState()->scenery.musicPlaylist = musicPlaylist_;
+	AudioEngine::getInstance().playMusic(musicPlaylist_);
+
 	//TODO: pointer to the changed object
 	onRun_(parentEvent, &musicPlaylist_);
 }
@@ -17,6 +22,11 @@ void ActionAudioSetSounds::run()
 	//qDebug() << "ActionAudioSetSounds::run in Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
 	ActionAudio::run();
 
+	NovelState::getCurrentlyLoadedState()->scenery.setSounds(sounds_);
+	AudioEngine& audioEngine = AudioEngine::getInstance();
+	for (const Sound& sound : sounds_)
+		audioEngine.playSound(sound);
+
 	//TODO: pointer to the changed object
 	onRun_(parentEvent, &sounds_);
 }
@@ -12,6 +12,13 @@ class ActionSceneryObjectAnimRotate;
 class ActionSceneryObjectAnimColor;
 class ActionSceneryObjectAnimFade;
 class ActionCharacterSetVoice;
+class ActionFilterBlur;
+class ActionFilterBrightness;
+class ActionFilterDilation;
+class ActionFilterErosion;
+class ActionFilterHue;
+class ActionFilterNegative;
+class ActionFilterSaturation;
 // [optional]
 //class ActionStatHide;
 //class ActionStatVisibility;
@@ -19,13 +26,6 @@ class ActionCharacterSetVoice;
 //class ActionEffectBlur;
 //class ActionEffectDistort;
 //class ActionEffectGlow;
-//class ActionFilterBlur;
-//class ActionFilterBrightness;
-//class ActionFilterDilation;
-//class ActionFilterErosion;
-//class ActionFilterHue;
-//class ActionFilterNegative;
-//class ActionFilterSaturation;
 
 /// Base class of a Visitor for Actions
 /// It is not the abstract class, like it should be, but default to doing nothing and allow for the overload
@@ -49,6 +49,14 @@ public:
     virtual void visitActionSceneryObjectSetImage(ActionSceneryObjectSetImage* action)    {}
     virtual void visitActionCharacterSetVoice(ActionCharacterSetVoice* action)            {}
     virtual void visitActionSetBackground(ActionSetBackground* action)                    {}
+
+    virtual void visitActionFilterBlur(ActionFilterBlur* action)                          {}
+    virtual void visitActionFilterBrightness(ActionFilterBrightness* action)              {}
+    virtual void visitActionFilterDilation(ActionFilterDilation* action)                  {}
+    virtual void visitActionFilterErosion(ActionFilterErosion* action)                    {}
+    virtual void visitActionFilterHue(ActionFilterHue* action)                            {}
+    virtual void visitActionFilterNegative(ActionFilterNegative* action)                  {}
+    virtual void visitActionFilterSaturation(ActionFilterSaturation* action)              {}
     // [optional]																		  
     //virtual void visitActionLive2DAnim(ActionLive2DAnim* action)						  {}
                                                                                           
@@ -56,12 +64,7 @@ public:
     //virtual void visitActionEffectBlur(ActionEffectBlur* action)						  {}
     //virtual void visitActionEffectDistort(ActionEffectDistort* action)				  {}
     //virtual void visitActionEffectGlow(ActionEffectGlow* action)						  {}
-                                                                                          
-    //virtual void visitActionFilterBlur(ActionFilterBlur* action)						  {}
-    //virtual void visitActionFilterBrightness(ActionFilterBrightness* action)			  {}
-    //virtual void visitActionFilterDilation(ActionFilterDilation* action)				  {}
-    //virtual void visitActionFilterErosion(ActionFilterErosion* action)				  {}
-    //virtual void visitActionFilterHue(ActionFilterHue* action)						  {}
-    //virtual void visitActionFilterNegative(ActionFilterNegative* action)				  {}
-    //virtual void visitActionFilterSaturation(ActionFilterSaturation* action)			  {}
-};
\ No newline at end of file
+};
+
+/// Pure virtual, but still called by the derived Visitors' destructors
+inline ActionVisitor::~ActionVisitor() = default;
@@ -18,11 +18,13 @@ void swap(ActionSceneryObjectSetImage& first, ActionSceneryObjectSetImage& secon
 	swap(static_cast<ActionSceneryObject&>(first), static_cast<ActionSceneryObject&>(second));
 	swap(first.assetImageName_, second.assetImageName_);
 	swap(first.assetImage_,     second.assetImage_);
+	swap(first.transitionTime,  second.transitionTime);
 	swap(first.onRun_,          second.onRun_);
 }
 
-ActionSceneryObjectSetImage::ActionSceneryObjectSetImage(Event* const parentEvent, const QString& sceneryObjectName, const QString& assetImageName, SceneryObject* sceneryObject, AssetImage* assetImage)
+ActionSceneryObjectSetImage::ActionSceneryObjectSetImage(Event* const parentEvent, const QString& sceneryObjectName, const QString& assetImageName, uint transitionTime, SceneryObject* sceneryObject, AssetImage* assetImage)
 	: ActionSceneryObject(parentEvent, sceneryObjectName, sceneryObject),
+	transitionTime(transitionTime),
 	assetImageName_(assetImageName), 
 	assetImage_(assetImage)
 {
@@ -33,6 +35,7 @@ ActionSceneryObjectSetImage::ActionSceneryObjectSetImage(Event* const parentEven
 
 ActionSceneryObjectSetImage::ActionSceneryObjectSetImage(const ActionSceneryObjectSetImage& obj) noexcept
 	: ActionSceneryObject(obj.parentEvent, obj.sceneryObjectName_, obj.sceneryObject_), 
+	transitionTime(obj.transitionTime),
 	assetImageName_(obj.assetImageName_),
 	assetImage_(obj.assetImage_), 
 	onRun_(obj.onRun_)
@@ -44,7 +47,8 @@ bool ActionSceneryObjectSetImage::operator==(const ActionSceneryObjectSetImage&
 	if (this == &obj) return true;
 
 	return	ActionSceneryObject::operator==(obj)   &&
-			assetImageName_ == obj.assetImageName_;// &&
+			assetImageName_ == obj.assetImageName_ &&
+			transitionTime  == obj.transitionTime;// &&
 			//assetImage_     == obj.assetImage_;
 }
 
@@ -56,7 +60,11 @@ void ActionSceneryObjectSetImage::setOnRunListener(std::function<void(const Even
 void ActionSceneryObjectSetImage::serializableLoad(QDataStream& dataStream)
 {
 	ActionSceneryObject::serializableLoad(dataStream);
+	const quint32 version = NovelLib::loadSerializationVersion(dataStream);
 	dataStream >> assetImageName_;
+	transitionTime = 0;
+	if (version >= 1)
+		dataStream >> transitionTime;
 
 	if (!assetImageName_.isEmpty())
 		assetImage_ = AssetManager::getInstance().getAssetImageSceneryObject(assetImageName_);
@@ -66,7 +74,8 @@ void ActionSceneryObjectSetImage::serializableLoad(QDataStream& dataStream)
 void ActionSceneryObjectSetImage::serializableSave(QDataStream& dataStream) const
 {
 	ActionSceneryObject::serializableSave(dataStream);
-	dataStream << assetImageName_;
+	NovelLib::saveSerializationVersion(dataStream, SERIALIZATION_VERSION);
+	dataStream << assetImageName_ << transitionTime;
 }
 
 //  MEMBER_FIELD_SECTION_CHANGE END
@@ -130,5 +139,5 @@ void ActionSceneryObjectSetImage::acceptVisitor(ActionVisitor* visitor)
 
 NovelLib::SerializationID ActionSceneryObjectSetImage::getType() const noexcept 
 { 
-	return NovelLib::SerializationID::ActionSetBackground; 
+	return NovelLib::SerializationID::ActionSceneryObjectSetImage; 
 }
\ No newline at end of file
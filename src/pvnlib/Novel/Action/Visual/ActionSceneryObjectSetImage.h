@@ -15,8 +15,9 @@ public:
 	explicit ActionSceneryObjectSetImage(Event* const parentEvent) noexcept;
 	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization 
 	/// \param assetImage Copies the AssetImage pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param transitionTime In milliseconds, the old image cross-fades into the new one; 0 swaps them immediately
 	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName` or couldn't find/read the AssetImage named `assetImageName`
-	ActionSceneryObjectSetImage(Event* const parentEvent, const QString& sceneryObjectName, const QString& assetImageName = "", SceneryObject* sceneryObject = nullptr, AssetImage* assetImage = nullptr);
+	ActionSceneryObjectSetImage(Event* const parentEvent, const QString& sceneryObjectName, const QString& assetImageName = "", uint transitionTime = 0, SceneryObject* sceneryObject = nullptr, AssetImage* assetImage = nullptr);
 	ActionSceneryObjectSetImage(const ActionSceneryObjectSetImage& obj)     noexcept;
 	ActionSceneryObjectSetImage(ActionSceneryObjectSetImage&& obj)          noexcept;
 	ActionSceneryObjectSetImage& operator=(ActionSceneryObjectSetImage obj) noexcept;
@@ -39,6 +40,10 @@ public:
 
 	void acceptVisitor(ActionVisitor* visitor) override;
 
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// In milliseconds, the old image cross-fades into the new one; 0 swaps them immediately
+	uint transitionTime = 0;
+
 private:
 	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
 	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
@@ -46,6 +51,10 @@ private:
 
 	void ensureResourcesAreLoaded() override;
 
+	/// 0 - without the `transitionTime`
+	/// 1 - with the `transitionTime`
+	static constexpr quint32 SERIALIZATION_VERSION = 1;
+
 	/// A function pointer that is called (if not nullptr) after the ActionSceneryObjectSetImage's `void run()` allowing for data read. Consts are safe to be casted to non-consts, they are there to indicate you should not do that, unless you have a very reason for it. `image` is NOT castable
 	std::function<void(const Event* const parentEvent, const SceneryObject* const sceneryObject, const QImage* const image)> onRun_ = nullptr;
 
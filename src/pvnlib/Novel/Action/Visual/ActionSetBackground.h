@@ -17,7 +17,9 @@ public:
 	{
 		CrossFade,
 		FadeOutToFadeIn,
-		SweepRight	//[optional]
+		SweepRight,
+		/// The new background appears pixel by pixel in a noise pattern
+		Dissolve
 	};
 
 	explicit ActionSetBackground(Event* const parentEvent) noexcept;
@@ -57,6 +59,8 @@ private:
 	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
 	NovelLib::SerializationID getType() const noexcept override;
 
+	void ensureResourcesAreLoaded() override;
+
 	/// A function pointer that is called (if not nullptr) after the ActionSetBackground's `void run()` allowing for data read. Consts are safe to be casted to non-consts, they are there to indicate you should not do that, unless you have a very reason for it. `image` is NOT castable
 	std::function<void(const Event* const parentEvent, const QImage* const background, const ActionSetBackground::TransitionType& transitionType, const uint& transitionTime)> onRun_;
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "pvnLib/Novel/Action/Visual/Animation/ActionAnimAll.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterAll.h"
 #include "pvnLib/Novel/Action/Visual/ActionCharacterSetVoice.h"
 #include "pvnLib/Novel/Action/Visual/ActionSceneryObjectSetImage.h"
 #include "pvnLib/Novel/Action/Visual/ActionSetBackground.h"
\ No newline at end of file
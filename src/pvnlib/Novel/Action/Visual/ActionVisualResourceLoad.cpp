@@ -1,9 +1,21 @@
 #include "pvnLib/Novel/Action/Visual/ActionVisualAll.h"
 
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
+
 void ActionSceneryObjectSetImage::ensureResourcesAreLoaded()
 {
 	ActionSceneryObject::ensureResourcesAreLoaded();
 
-	if (assetImage_->isLoaded())
+	if (!assetImage_->isLoaded())
+		assetImage_->load();
+}
+
+void ActionSetBackground::ensureResourcesAreLoaded()
+{
+	Action::ensureResourcesAreLoaded();
+
+	//Background is stretched over the whole scene
+	assetImage_->setDisplaySize(QSizeF(RESOLUTION_X, RESOLUTION_Y).toSize());
+	if (!assetImage_->isLoaded())
 		assetImage_->load();
 }
\ No newline at end of file
@@ -1,5 +1,25 @@
 #include "pvnLib/Novel/Action/Visual/ActionVisualAll.h"
 
+#include "pvnLib/Novel/Data/Novel.h"
+
+namespace
+{
+	Transition::Type toTransitionType(ActionSetBackground::TransitionType transitionType) noexcept
+	{
+		switch (transitionType)
+		{
+		case ActionSetBackground::TransitionType::FadeOutToFadeIn:
+			return Transition::Type::FadeOutToFadeIn;
+		case ActionSetBackground::TransitionType::SweepRight:
+			return Transition::Type::Slide;
+		case ActionSetBackground::TransitionType::Dissolve:
+			return Transition::Type::Dissolve;
+		default:
+			return Transition::Type::CrossFade;
+		}
+	}
+}
+
 void ActionSceneryObject::run()
 {
 	Action::run();
@@ -28,6 +48,13 @@ void ActionSceneryObjectSetImage::run()
 {
 	ActionSceneryObject::run();
 
+	//The SceneWidget blends from the image it currently displays, so it does not need the old AssetImage
+	Novel& novel = Novel::getInstance();
+	if (novel.getSceneWidget())
+		emit novel.pendSceneryObjectImageTransition(sceneryObjectName_, assetImage_, Transition::Type::CrossFade, transitionTime);
+	if (sceneryObject_)
+		sceneryObject_->setAssetImage(assetImageName_, assetImage_);
+
 	if (onRun_)
 		onRun_(parentEvent, sceneryObject_, assetImage_->getImage());
 }
@@ -36,6 +63,22 @@ void ActionSetBackground::run()
 {
 	Action::run();
 
+	Scenery& scenery = NovelState::getCurrentlyLoadedState()->scenery;
+	scenery.setBackgroundAssetImage(assetImageName_, assetImage_);
+
+	Novel& novel = Novel::getInstance();
+	if (novel.getSceneWidget())
+	{
+		//Panoramas are streamed, there are no two whole images to blend
+		if (assetImage_->getTiledImagePack())
+		{
+			emit novel.pendTiledBackgroundDisplay(assetImage_->getTiledImagePack());
+			emit novel.pendBackgroundCameraMove(scenery.getBackgroundCameraPos());
+		}
+		else
+			emit novel.pendBackgroundTransition(assetImage_->getImage(), toTransitionType(transitionType), transitionTime);
+	}
+
 	if (onRun_)
 		onRun_(parentEvent, assetImage_->getImage(), transitionType, transitionTime);
 }
\ No newline at end of file
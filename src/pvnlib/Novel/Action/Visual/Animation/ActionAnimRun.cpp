@@ -12,6 +12,7 @@ void ActionSceneryObjectAnimColor::run()
 void ActionSceneryObjectAnimFade::run()
 {
 	ActionSceneryObjectAnim::run();
+	NovelState::getCurrentlyLoadedState()->scenery.addAnimator(AnimatorSceneryObjectFade(sceneryObject_, priority, startDelay, 1.0, 1, bFinishAnimationAtEventEnd, duration, bAppear));
 
 	if (onRun_)
 		onRun_(parentEvent, sceneryObject_, priority, startDelay, bFinishAnimationAtEventEnd, duration, bAppear);
@@ -38,6 +39,19 @@ void ActionSceneryObjectAnimRotate::run()
 void ActionSceneryObjectAnimScale::run()
 {
 	ActionSceneryObjectAnim::run();
+
+	//The sprite has to be decoded with enough pixels for the largest scale the Animation reaches, not only the static one
+	if (sceneryObject_ && sceneryObject_->getAssetImage() && assetAnim_)
+	{
+		double maxScale = 0.0;
+		for (const AnimNodeDouble2D& node : *assetAnim_->getAnimNodes())
+			maxScale = qMax(maxScale, qMax(qAbs(node.state_[0]), qAbs(node.state_[1])));
+
+		AssetImage* assetImage = sceneryObject_->getAssetImage();
+		assetImage->requestDisplayScale(maxScale);
+		if (!assetImage->isLoaded())
+			assetImage->load();
+	}
 	NovelState::getCurrentlyLoadedState()->scenery.addAnimator(AnimatorSceneryObjectScale(sceneryObject_, assetAnim_, priority, startDelay, speed, timesPlayed, bFinishAnimationAtEventEnd));
 
 	if (onRun_)
@@ -4,7 +4,6 @@
 #include "pvnLib/Novel/Data/Visual/Animation/AnimatorSceneryObjectFade.h"
 
 /// Creates AnimatorSceneryObjectFade and adds it to the Scenery, which will perform an **appear** or **disappear** Animation on a SceneryObject 
-/// \todo create special Animator for it 
 class ActionSceneryObjectAnimFade : public ActionSceneryObjectAnim<AnimNodeDouble1D>
 {
 	/// Swap trick
@@ -0,0 +1,55 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilter::~ActionFilter() = default;
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilter& first, ActionFilter& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionSceneryObject&>(first), static_cast<ActionSceneryObject&>(second));
+	swap(first.intensivness, second.intensivness);
+	swap(first.strength,     second.strength);
+	swap(first.onRun_,       second.onRun_);
+}
+
+ActionFilter::ActionFilter(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionSceneryObject(parentEvent, sceneryObjectName, sceneryObject),
+	intensivness(intensivness),
+	strength(strength)
+{
+}
+
+bool ActionFilter::operator==(const ActionFilter& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionSceneryObject::operator==(obj) &&
+		   intensivness == obj.intensivness     &&
+		   strength     == obj.strength;
+}
+
+void ActionFilter::serializableLoad(QDataStream& dataStream)
+{
+	ActionSceneryObject::serializableLoad(dataStream);
+	dataStream >> intensivness >> strength;
+
+	errorCheck();
+}
+
+void ActionFilter::serializableSave(QDataStream& dataStream) const
+{
+	ActionSceneryObject::serializableSave(dataStream);
+	dataStream << intensivness << strength;
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+void ActionFilter::setOnRunListener(std::function<void(const Event* const parentEvent, const SceneryObject* const sceneryObject, const ImageFilter& filter)> onRun) noexcept
+{
+	onRun_ = onRun;
+}
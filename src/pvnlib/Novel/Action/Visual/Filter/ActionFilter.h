@@ -1,53 +1,56 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/ActionSceneryObject.h"
-//
-///// [optional] Base class for the rest of the ActionFilters
-//class ActionFilter : public ActionSceneryObject
-//{
-//public:
-//	ActionFilter() noexcept = default;
-//	ActionFilter(QString&& sceneryObjectName, double intensivness, double strength);
-//	ActionFilter(const ActionFilter& obj) noexcept { *this = obj; }
-//	ActionFilter& operator=(const ActionFilter& obj) noexcept;
-//
-//protected:
-//	//[optional] List of the ids that the filter will be applied on, empty list means all the parts
-//	//QVector<uint> objectPartsAffected;
-//
-//	/// Sets the intensivness of the Filter, defined in percentage
-//	/// Accepted values: 0.0 - 100.0
-//	double intensivness	= 100.0;
-//
-//	/// Strength of the Effect, not all Filters use it. 
-//	/// Intensivness is a multiplier for it
-//	double strength = 1.0;
-//
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//  /// \param dataStream Stream (presumably connected to a QFile) to read from
-//	virtual void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//  /// \param dataStream Stream (presumably connected to a QFile) to save to
-//	virtual void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilter::ActionFilter(QString&& sceneryObjectName, double intensivness, double strength) :
-//	ActionSceneryObject(move(sceneryObjectName)), intensivness(intensivness), strength(strength) 
-//{
-//}
-//
-//inline ActionFilter& ActionFilter::operator=(const ActionFilter& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionSceneryObject::operator=(obj);
-//	intensivness = obj.intensivness;
-//	strength     = obj.strength;
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/ActionSceneryObject.h"
+
+#include "pvnLib/Novel/Data/Visual/Scenery/ImageFilter.h"
+
+/// Base class for the rest of the ActionFilters
+/// Adds an ImageFilter to the SceneryObject's `filters`, replacing the previous ImageFilter of the same type, so rerunning the Action does not stack the ImageFilters
+class ActionFilter : public ActionSceneryObject
+{
+	/// Swap trick
+	friend void swap(ActionFilter& first, ActionFilter& second) noexcept;
+public:
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Strength of the Filter, its meaning depends on the Filter (see `ImageFilter::strength`)
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	explicit ActionFilter(Event* const parentEvent, const QString& sceneryObjectName = "", double intensivness = 100.0, double strength = 1.0, SceneryObject* sceneryObject = nullptr);
+	bool operator==(const ActionFilter& obj) const noexcept;
+	bool operator!=(const ActionFilter& obj) const noexcept = default;
+	//Makes it abstract
+	virtual ~ActionFilter() = 0;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	virtual bool errorCheck(bool bComprehensive = false) const override;
+
+	virtual void run() override;
+
+	/// Sets a function pointer that is called (if not nullptr) after the ActionFilter's `void run()` allowing for data read. Consts are safe to be casted to non-consts, they are there to indicate you should not do that, unless you have a very reason for it
+	void setOnRunListener(std::function<void(const Event* const parentEvent, const SceneryObject* const sceneryObject, const ImageFilter& filter)> onRun) noexcept;
+
+	/// \return ImageFilter, which is added to the SceneryObject by the `void run()`
+	virtual ImageFilter getImageFilter() const noexcept = 0;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// Sets the intensivness of the Filter, defined in percentage
+	/// Accepted values: 0.0 - 100.0
+	double intensivness = 100.0;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// Strength of the Filter, its meaning depends on the Filter (see `ImageFilter::strength`)
+	double strength     = 1.0;
+
+protected:
+	/// A function pointer that is called (if not nullptr) after the ActionFilter's `void run()` allowing for data read. Consts are safe to be casted to non-consts, they are there to indicate you should not do that, unless you have a very reason for it
+	std::function<void(const Event* const parentEvent, const SceneryObject* const sceneryObject, const ImageFilter& filter)> onRun_ = nullptr;
+
+public:
+	//---SERIALIZATION---
+	/// Loading an object from a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to read from
+	virtual void serializableLoad(QDataStream& dataStream) override;
+	/// Saving an object to a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to save to
+	virtual void serializableSave(QDataStream& dataStream) const override;
+};
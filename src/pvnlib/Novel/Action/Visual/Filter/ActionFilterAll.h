@@ -0,0 +1,8 @@
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterBlur.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterBrightness.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterDilation.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterErosion.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterHue.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterNegative.h"
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterSaturation.h"
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterBlur.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterBlur::ActionFilterBlur(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterBlur& first, ActionFilterBlur& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+	swap(first.blurType, second.blurType);
+}
+
+ActionFilterBlur::ActionFilterBlur(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, BlurType blurType, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject),
+	blurType(blurType)
+{
+	errorCheck(true);
+}
+
+ActionFilterBlur::ActionFilterBlur(const ActionFilterBlur& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_),
+	blurType(obj.blurType)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterBlur::operator==(const ActionFilterBlur& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj) &&
+		   blurType == obj.blurType;
+}
+
+void ActionFilterBlur::serializableLoad(QDataStream& dataStream)
+{
+	ActionFilter::serializableLoad(dataStream);
+	dataStream >> blurType;
+}
+
+void ActionFilterBlur::serializableSave(QDataStream& dataStream) const
+{
+	ActionFilter::serializableSave(dataStream);
+	dataStream << blurType;
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterBlur::ActionFilterBlur(ActionFilterBlur&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterBlur& ActionFilterBlur::operator=(ActionFilterBlur obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterBlur::getImageFilter() const noexcept
+{
+	return ImageFilter(blurType == BlurType::Box ? ImageFilter::Type::BoxBlur : ImageFilter::Type::GaussianBlur, intensivness, strength);
+}
+
+void ActionFilterBlur::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterBlur(this);
+}
+
+NovelLib::SerializationID ActionFilterBlur::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterBlur;
+}
\ No newline at end of file
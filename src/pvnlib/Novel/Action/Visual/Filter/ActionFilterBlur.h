@@ -1,65 +1,56 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
-//
-///// [optional] Creates a Blur Filter at a SceneryObject or the entire Viewport
-//class ActionFilterBlur final : public ActionFilter
-//{
-//public:
-//	/// Algorithm used for blurring
-//	enum class BlurType
-//	{
-//		Gaussian
-//	};
-//
-//	ActionFilterBlur() noexcept = default;
-//	ActionFilterBlur(QString&& sceneryObjectName, double intensivness, double strength, BlurType blurType);
-//	ActionFilterBlur(const ActionFilterBlur& obj) noexcept { *this = obj; }
-//	ActionFilterBlur& operator=(const ActionFilterBlur& obj) noexcept;
-//
-//	/// Executes the ActionFilterBlur's logic
-//	void run() override;
-//
-//	/// Accepts an ActionVisitor
-//	/// \param vistor Pointer to a concrete Visitor derived from an ActionVisitor
-//	void accept(ActionVisitor* visitor) override { visitor->visitActionFilterBlur(this); }
-//
-//signals:
-//	/// A Qt signal emitted after the ActionFilterBlur's `void run()` allowing for data read
-//	void onRun(const SceneryObject* sceneryObject, QPoint pos, QSize size, double intensivness, uint strength, BlurType blurType) const;
-//
-//private:
-//	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
-//  /// \return SerializationID corresponding to the class of a serialized object
-//	SerializationID	getType() const override { return SerializationID::ActionFilterBlur; }
-//
-//	/// Algorithm used for blurring
-//	BlurType blurType = BlurType::Gaussian;
-//
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to read from
-//	void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to save to
-//	void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilterBlur::ActionFilterBlur(QString&& sceneryObjectName, double intensivness, double strength, BlurType blurType) :
-//	ActionFilter(move(sceneryObjectName), intensivness, strength), blurType(blurType) 
-//{
-//}
-//
-//inline ActionFilterBlur& ActionFilterBlur::operator=(const ActionFilterBlur& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionFilter::operator=(obj);
-//	blurType = obj.blurType;
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+/// Blurs a SceneryObject
+class ActionFilterBlur final : public ActionFilter
+{
+	/// Swap trick
+	friend void swap(ActionFilterBlur& first, ActionFilterBlur& second) noexcept;
+public:
+	/// Algorithm used for blurring
+	enum class BlurType
+	{
+		/// Approximated with three box blurs
+		Gaussian,
+		Box
+	};
+
+	explicit ActionFilterBlur(Event* const parentEvent) noexcept;
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Blur radius in pixels
+	/// \param blurType Algorithm used for blurring
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	ActionFilterBlur(Event* const parentEvent, const QString& sceneryObjectName, double intensivness = 100.0, double strength = 1.0, BlurType blurType = BlurType::Gaussian, SceneryObject* sceneryObject = nullptr);
+	ActionFilterBlur(const ActionFilterBlur& obj)     noexcept;
+	ActionFilterBlur(ActionFilterBlur&& obj)          noexcept;
+	ActionFilterBlur& operator=(ActionFilterBlur obj) noexcept;
+	bool operator==(const ActionFilterBlur& obj) const noexcept;
+	bool operator!=(const ActionFilterBlur& obj) const noexcept = default;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	bool errorCheck(bool bComprehensive = false) const override;
+
+	ImageFilter getImageFilter() const noexcept override;
+
+	void acceptVisitor(ActionVisitor* visitor) override;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// Algorithm used for blurring
+	BlurType blurType = BlurType::Gaussian;
+
+private:
+	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
+	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
+	NovelLib::SerializationID getType() const noexcept override;
+
+public:
+	//---SERIALIZATION---
+	/// Loading an object from a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to read from
+	void serializableLoad(QDataStream& dataStream) override;
+	/// Saving an object to a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to save to
+	void serializableSave(QDataStream& dataStream) const override;
+};
\ No newline at end of file
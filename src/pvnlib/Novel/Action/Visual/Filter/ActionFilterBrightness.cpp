@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterBrightness.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterBrightness::ActionFilterBrightness(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterBrightness& first, ActionFilterBrightness& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterBrightness::ActionFilterBrightness(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterBrightness::ActionFilterBrightness(const ActionFilterBrightness& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterBrightness::operator==(const ActionFilterBrightness& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterBrightness::ActionFilterBrightness(ActionFilterBrightness&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterBrightness& ActionFilterBrightness::operator=(ActionFilterBrightness obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterBrightness::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Brightness, intensivness, strength);
+}
+
+void ActionFilterBrightness::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterBrightness(this);
+}
+
+NovelLib::SerializationID ActionFilterBrightness::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterBrightness;
+}
\ No newline at end of file
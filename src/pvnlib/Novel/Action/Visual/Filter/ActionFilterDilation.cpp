@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterDilation.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterDilation::ActionFilterDilation(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterDilation& first, ActionFilterDilation& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterDilation::ActionFilterDilation(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterDilation::ActionFilterDilation(const ActionFilterDilation& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterDilation::operator==(const ActionFilterDilation& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterDilation::ActionFilterDilation(ActionFilterDilation&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterDilation& ActionFilterDilation::operator=(ActionFilterDilation obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterDilation::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Dilation, intensivness, strength);
+}
+
+void ActionFilterDilation::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterDilation(this);
+}
+
+NovelLib::SerializationID ActionFilterDilation::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterDilation;
+}
\ No newline at end of file
@@ -1,55 +1,34 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
-//
-///// [optional] Creates a Dilation Filter at a SceneryObject or the entire Viewport
-//class ActionFilterDilation final : public ActionFilter
-//{
-//public:
-//	ActionFilterDilation() noexcept = default;
-//	ActionFilterDilation(QString&& sceneryObjectName, double intensivness, double strength);
-//	ActionFilterDilation(const ActionFilterDilation& obj) noexcept { *this = obj; }
-//	ActionFilterDilation& operator=(const ActionFilterDilation& obj) noexcept;
-//	
-//	/// Executes the ActionFilterDilation's logic
-//	void run() override;
-//
-//	/// Accepts an ActionVisitor
-//	/// \param vistor Pointer to a concrete Visitor derived from an ActionVisitor
-//	void accept(ActionVisitor* visitor) override	{ visitor->visitActionFilterDilation(this); }
-//
-//signals:
-//	/// A Qt signal emitted after the ActionFilterDilation's `void run()` allowing for data read
-//	void onRun(const SceneryObject* sceneryObject, QPoint pos, QSize size, double intensivness, uint strength) const;
-//
-//private:
-//	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
-//  /// \return SerializationID corresponding to the class of a serialized object
-//	SerializationID	getType() const override		{ return SerializationID::ActionFilterDilation; }
-//	
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to read from
-//	void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to save to
-//	void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilterDilation::ActionFilterDilation(QString&& sceneryObjectName, double intensivness, double strength) :
-//	ActionFilter(move(sceneryObjectName), intensivness, strength) 
-//{
-//}
-//
-//inline ActionFilterDilation& ActionFilterDilation::operator=(const ActionFilterDilation& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionFilter::operator=(obj);
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+/// Expands the bright and opaque areas of a SceneryObject
+class ActionFilterDilation final : public ActionFilter
+{
+	/// Swap trick
+	friend void swap(ActionFilterDilation& first, ActionFilterDilation& second) noexcept;
+public:
+	explicit ActionFilterDilation(Event* const parentEvent) noexcept;
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Radius (in pixels) of the square, in which the maximum is taken
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	ActionFilterDilation(Event* const parentEvent, const QString& sceneryObjectName, double intensivness = 100.0, double strength = 1.0, SceneryObject* sceneryObject = nullptr);
+	ActionFilterDilation(const ActionFilterDilation& obj)     noexcept;
+	ActionFilterDilation(ActionFilterDilation&& obj)          noexcept;
+	ActionFilterDilation& operator=(ActionFilterDilation obj) noexcept;
+	bool operator==(const ActionFilterDilation& obj) const noexcept;
+	bool operator!=(const ActionFilterDilation& obj) const noexcept = default;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	bool errorCheck(bool bComprehensive = false) const override;
+
+	ImageFilter getImageFilter() const noexcept override;
+
+	void acceptVisitor(ActionVisitor* visitor) override;
+
+private:
+	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
+	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
+	NovelLib::SerializationID getType() const noexcept override;
+};
\ No newline at end of file
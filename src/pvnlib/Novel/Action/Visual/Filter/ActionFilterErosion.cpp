@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterErosion.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterErosion::ActionFilterErosion(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterErosion& first, ActionFilterErosion& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterErosion::ActionFilterErosion(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterErosion::ActionFilterErosion(const ActionFilterErosion& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterErosion::operator==(const ActionFilterErosion& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterErosion::ActionFilterErosion(ActionFilterErosion&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterErosion& ActionFilterErosion::operator=(ActionFilterErosion obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterErosion::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Erosion, intensivness, strength);
+}
+
+void ActionFilterErosion::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterErosion(this);
+}
+
+NovelLib::SerializationID ActionFilterErosion::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterErosion;
+}
\ No newline at end of file
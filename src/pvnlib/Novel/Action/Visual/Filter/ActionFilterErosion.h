@@ -1,55 +1,34 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
-//
-///// [optional] Creates a Erosion Filter at a SceneryObject or the entire Viewport
-//class ActionFilterErosion final : public ActionFilter
-//{
-//public:
-//	ActionFilterErosion() noexcept = default;
-//	ActionFilterErosion(QString&& sceneryObjectName, double intensivness, double strength);
-//	ActionFilterErosion(const ActionFilterErosion& obj) noexcept { *this = obj; }
-//	ActionFilterErosion& operator=(const ActionFilterErosion& obj) noexcept;
-//	
-//	/// Executes the ActionFilterErosion's logic
-//	void run() override;
-//
-//	/// Accepts an ActionVisitor
-//	/// \param vistor Pointer to a concrete Visitor derived from an ActionVisitor
-//	void accept(ActionVisitor* visitor) override { visitor->visitActionFilterErosion(this); }
-//
-//signals:
-//	/// A Qt signal emitted after the ActionFilterErosion's `void run()` allowing for data read
-//	void onRun(const SceneryObject* sceneryObject, QPoint pos, QSize size, double intensivness, uint strength) const;
-//
-//private:
-//	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
-//  /// \return SerializationID corresponding to the class of a serialized object
-//	SerializationID	getType() const override { return SerializationID::ActionFilterErosion; }
-//
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to read from
-//	void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to save to
-//	void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilterErosion::ActionFilterErosion(QString&& sceneryObjectName, double intensivness, double strength) :
-//	ActionFilter(move(sceneryObjectName), intensivness, strength) 
-//{
-//}
-//
-//inline ActionFilterErosion& ActionFilterErosion::operator=(const ActionFilterErosion& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionFilter::operator=(obj);
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+/// Shrinks the bright and opaque areas of a SceneryObject
+class ActionFilterErosion final : public ActionFilter
+{
+	/// Swap trick
+	friend void swap(ActionFilterErosion& first, ActionFilterErosion& second) noexcept;
+public:
+	explicit ActionFilterErosion(Event* const parentEvent) noexcept;
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Radius (in pixels) of the square, in which the minimum is taken
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	ActionFilterErosion(Event* const parentEvent, const QString& sceneryObjectName, double intensivness = 100.0, double strength = 1.0, SceneryObject* sceneryObject = nullptr);
+	ActionFilterErosion(const ActionFilterErosion& obj)     noexcept;
+	ActionFilterErosion(ActionFilterErosion&& obj)          noexcept;
+	ActionFilterErosion& operator=(ActionFilterErosion obj) noexcept;
+	bool operator==(const ActionFilterErosion& obj) const noexcept;
+	bool operator!=(const ActionFilterErosion& obj) const noexcept = default;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	bool errorCheck(bool bComprehensive = false) const override;
+
+	ImageFilter getImageFilter() const noexcept override;
+
+	void acceptVisitor(ActionVisitor* visitor) override;
+
+private:
+	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
+	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
+	NovelLib::SerializationID getType() const noexcept override;
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterAll.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+bool ActionFilter::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionSceneryObject::errorCheck(bComprehensive);
+
+	auto errorChecker = [this](bool bComprehensive)
+	{
+		if (intensivness < 0.0 || intensivness > 100.0)
+			qCritical() << NovelLib::ErrorType::General << "ActionFilter's intensivness (" << intensivness << ") is out of the [0.0, 100.0] range";
+	};
+
+	bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilter::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterBlur::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterBlur::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterBrightness::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterBrightness::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterDilation::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterDilation::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterErosion::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterErosion::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterHue::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterHue::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterNegative::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterNegative::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
+
+bool ActionFilterSaturation::errorCheck(bool bComprehensive) const
+{
+	bool bError = ActionFilter::errorCheck(bComprehensive);
+
+	//auto errorChecker = [this](bool bComprehensive)
+	//{
+	//};
+
+	//bError |= NovelLib::catchExceptions(errorChecker, bComprehensive);
+	if (bError)
+		qDebug() << "Error occurred in ActionFilterSaturation::errorCheck of Scene \"" + parentEvent->parentScene->name + "\" Event" << parentEvent->getIndex();
+
+	return bError;
+}
\ No newline at end of file
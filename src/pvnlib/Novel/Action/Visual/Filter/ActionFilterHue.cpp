@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterHue.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterHue::ActionFilterHue(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterHue& first, ActionFilterHue& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterHue::ActionFilterHue(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterHue::ActionFilterHue(const ActionFilterHue& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterHue::operator==(const ActionFilterHue& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterHue::ActionFilterHue(ActionFilterHue&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterHue& ActionFilterHue::operator=(ActionFilterHue obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterHue::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Hue, intensivness, strength);
+}
+
+void ActionFilterHue::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterHue(this);
+}
+
+NovelLib::SerializationID ActionFilterHue::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterHue;
+}
\ No newline at end of file
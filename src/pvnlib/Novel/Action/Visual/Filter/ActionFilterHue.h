@@ -1,61 +1,34 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
-//
-///// [optional] Creates a Hue Filter at a SceneryObject or the entire Viewport
-//class ActionFilterHue final : public ActionFilter
-//{
-//public:
-//	ActionFilterHue() noexcept = default;
-//	ActionFilterHue(QString&& sceneryObjectName, double intensivness, double strength, int hueShift);
-//	ActionFilterHue(const ActionFilterHue& obj) noexcept { *this = obj; }
-//	ActionFilterHue& operator=(const ActionFilterHue& obj) noexcept;
-//
-//	/// Executes the ActionFilterHue's logic
-//	void run() override;
-//
-//	/// Accepts an ActionVisitor
-//	/// \param vistor Pointer to a concrete Visitor derived from an ActionVisitor
-//	void accept(ActionVisitor* visitor) override { visitor->visitActionFilterHue(this); }
-//
-//signals:
-//	/// A Qt signal emitted after the ActionFilterHue's `void run()` allowing for data read
-//	void onRun(const SceneryObject* sceneryObject, QPoint pos, QSize size, double intensivness, uint strength, int hueShift) const;
-//
-//private:
-//	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
-//  /// \return SerializationID corresponding to the class of a serialized object
-//	SerializationID	getType() const override { return SerializationID::ActionFilterHue; }
-//
-//	/// Adds Hue to every pixel of the affected object/vieport
-//	/// Accepted values: -359 - 359
-//	int	hueShift = 0;
-//
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to read from
-//	void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to save to
-//	void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilterHue::ActionFilterHue(QString&& sceneryObjectName, double intensivness, double strength, int hueShift) :
-//	ActionFilter(move(sceneryObjectName), intensivness, strength), hueShift(hueShift) 
-//{
-//
-//}
-//
-//inline ActionFilterHue& ActionFilterHue::operator=(const ActionFilterHue& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionFilter::operator=(obj);
-//	hueShift = obj.hueShift;
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+/// Rotates the Hue of every pixel of a SceneryObject
+class ActionFilterHue final : public ActionFilter
+{
+	/// Swap trick
+	friend void swap(ActionFilterHue& first, ActionFilterHue& second) noexcept;
+public:
+	explicit ActionFilterHue(Event* const parentEvent) noexcept;
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Hue rotation in degrees. Accepted values: -359.0 - 359.0
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	ActionFilterHue(Event* const parentEvent, const QString& sceneryObjectName, double intensivness = 100.0, double strength = 0.0, SceneryObject* sceneryObject = nullptr);
+	ActionFilterHue(const ActionFilterHue& obj)     noexcept;
+	ActionFilterHue(ActionFilterHue&& obj)          noexcept;
+	ActionFilterHue& operator=(ActionFilterHue obj) noexcept;
+	bool operator==(const ActionFilterHue& obj) const noexcept;
+	bool operator!=(const ActionFilterHue& obj) const noexcept = default;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	bool errorCheck(bool bComprehensive = false) const override;
+
+	ImageFilter getImageFilter() const noexcept override;
+
+	void acceptVisitor(ActionVisitor* visitor) override;
+
+private:
+	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
+	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
+	NovelLib::SerializationID getType() const noexcept override;
+};
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterNegative.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterNegative::ActionFilterNegative(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterNegative& first, ActionFilterNegative& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterNegative::ActionFilterNegative(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterNegative::ActionFilterNegative(const ActionFilterNegative& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterNegative::operator==(const ActionFilterNegative& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterNegative::ActionFilterNegative(ActionFilterNegative&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterNegative& ActionFilterNegative::operator=(ActionFilterNegative obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterNegative::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Negative, intensivness, strength);
+}
+
+void ActionFilterNegative::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterNegative(this);
+}
+
+NovelLib::SerializationID ActionFilterNegative::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterNegative;
+}
\ No newline at end of file
@@ -1,55 +1,34 @@
-//#pragma once
-//#include "Global.h"
-//
-//#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
-//
-///// [optional] Creates a Negation Filter at a SceneryObject or the entire Viewport
-///// "Flips" colors
-//class ActionFilterNegative final : public ActionFilter
-//{
-//public:
-//	ActionFilterNegative() noexcept = default;
-//	ActionFilterNegative(QString&& sceneryObjectName, double intensivness, double strength);
-//	ActionFilterNegative(const ActionFilterNegative& obj) noexcept { *this = obj; };
-//
-//	/// Executes the ActionFilterNegative's logic
-//	void run() override;
-//
-//	/// Accepts an ActionVisitor
-//	/// \param vistor Pointer to a concrete Visitor derived from an ActionVisitor
-//	void accept(ActionVisitor* visitor) override { visitor->visitActionFilterNegative(this); }
-//
-//signals:
-//	/// A Qt signal emitted after the ActionFilterNegative's `void run()` allowing for data read
-//	void onRun(const SceneryObject* sceneryObject, QPoint pos, QSize size, double intensivness, uint strength) const;
-//
-//private:
-//	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
-//  /// \return SerializationID corresponding to the class of a serialized object
-//	SerializationID	getType() const override { return SerializationID::ActionFilterNegative; }
-//
-//	//---SERIALIZATION---
-//	/// Loading an object from a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to read from
-//	void serializableLoad(QDataStream& dataStream) override;
-//	/// Saving an object to a binary file
-//	/// \param dataStream Stream (presumably connected to a QFile) to save to
-//	void serializableSave(QDataStream& dataStream) const override;
-//};
-//
-//
-//
-//
-//inline ActionFilterNegative::ActionFilterNegative(QString&& sceneryObjectName, double intensivness, double strength) :
-//	ActionFilter(move(sceneryObjectName), intensivness, strength)
-//{
-//}
-//
-//inline ActionFilterNegative& ActionFilterNegative::operator=(const ActionFilterNegative& obj)
-//{
-//	if (this == &obj) return *this;
-//
-//	ActionFilter::operator=(obj);
-//
-//	return *this;
-//}
\ No newline at end of file
+#pragma once
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilter.h"
+
+/// Inverts the colors of a SceneryObject
+class ActionFilterNegative final : public ActionFilter
+{
+	/// Swap trick
+	friend void swap(ActionFilterNegative& first, ActionFilterNegative& second) noexcept;
+public:
+	explicit ActionFilterNegative(Event* const parentEvent) noexcept;
+	/// \param sceneryObject Copies the SceneryObject pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
+	/// \param intensivness Sets the intensivness of the Filter, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Unused
+	/// \exception Error Couldn't find the SceneryObject named `sceneryObjectName`
+	ActionFilterNegative(Event* const parentEvent, const QString& sceneryObjectName, double intensivness = 100.0, double strength = 1.0, SceneryObject* sceneryObject = nullptr);
+	ActionFilterNegative(const ActionFilterNegative& obj)     noexcept;
+	ActionFilterNegative(ActionFilterNegative&& obj)          noexcept;
+	ActionFilterNegative& operator=(ActionFilterNegative obj) noexcept;
+	bool operator==(const ActionFilterNegative& obj) const noexcept;
+	bool operator!=(const ActionFilterNegative& obj) const noexcept = default;
+
+	/// \exception Error `sceneryObject_` is invalid or `intensivness` is out of range
+	/// \return Whether an Error has occurred
+	bool errorCheck(bool bComprehensive = false) const override;
+
+	ImageFilter getImageFilter() const noexcept override;
+
+	void acceptVisitor(ActionVisitor* visitor) override;
+
+private:
+	/// Needed for Serialization, to know the class of an object about to be Serialization loaded
+	/// \return NovelLib::SerializationID corresponding to the class of a serialized object
+	NovelLib::SerializationID getType() const noexcept override;
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterAll.h"
+
+#include <algorithm>
+
+#include "pvnLib/Novel/Data/Novel.h"
+
+void ActionFilter::run()
+{
+	ActionSceneryObject::run();
+	if (!sceneryObject_)
+		return;
+
+	const ImageFilter filter = getImageFilter();
+	auto isBlur = [](const ImageFilter& imageFilter) { return imageFilter.type == ImageFilter::Type::GaussianBlur || imageFilter.type == ImageFilter::Type::BoxBlur; };
+
+	//Rerunning an ActionFilter of the same kind replaces its ImageFilter, instead of stacking another one
+	std::vector<ImageFilter>& filters = sceneryObject_->filters;
+	auto it = std::find_if(filters.begin(), filters.end(), [&](const ImageFilter& imageFilter) { return imageFilter.type == filter.type || (isBlur(imageFilter) && isBlur(filter)); });
+	if (it != filters.end())
+		*it = filter;
+	else
+		filters.push_back(filter);
+
+	//The SceneryObject was already rendered by the Event
+	Novel& novel = Novel::getInstance();
+	if (novel.getSceneWidget())
+		emit novel.pendSceneryObjectFiltersUpdate(sceneryObjectName_, filters);
+
+	if (onRun_)
+		onRun_(parentEvent, sceneryObject_, filter);
+}
\ No newline at end of file
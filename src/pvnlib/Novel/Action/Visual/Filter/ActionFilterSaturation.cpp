@@ -0,0 +1,69 @@
+#include "pvnLib/Novel/Action/Visual/Filter/ActionFilterSaturation.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+
+ActionFilterSaturation::ActionFilterSaturation(Event* const parentEvent) noexcept
+	: ActionFilter(parentEvent)
+{
+}
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+void swap(ActionFilterSaturation& first, ActionFilterSaturation& second) noexcept
+{
+	using std::swap;
+	//Static cast, because no check is needed and it's faster
+	swap(static_cast<ActionFilter&>(first), static_cast<ActionFilter&>(second));
+}
+
+ActionFilterSaturation::ActionFilterSaturation(Event* const parentEvent, const QString& sceneryObjectName, double intensivness, double strength, SceneryObject* sceneryObject)
+	: ActionFilter(parentEvent, sceneryObjectName, intensivness, strength, sceneryObject)
+{
+	errorCheck(true);
+}
+
+ActionFilterSaturation::ActionFilterSaturation(const ActionFilterSaturation& obj) noexcept
+	: ActionFilter(obj.parentEvent, obj.sceneryObjectName_, obj.intensivness, obj.strength, obj.sceneryObject_)
+{
+	onRun_ = obj.onRun_;
+}
+
+bool ActionFilterSaturation::operator==(const ActionFilterSaturation& obj) const noexcept
+{
+	if (this == &obj) return true;
+
+	return ActionFilter::operator==(obj);
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+ActionFilterSaturation::ActionFilterSaturation(ActionFilterSaturation&& obj) noexcept
+	: ActionFilter(obj.parentEvent)
+{
+	swap(*this, obj);
+}
+
+ActionFilterSaturation& ActionFilterSaturation::operator=(ActionFilterSaturation obj) noexcept
+{
+	if (this == &obj) return *this;
+
+	swap(*this, obj);
+
+	return *this;
+}
+
+ImageFilter ActionFilterSaturation::getImageFilter() const noexcept
+{
+	return ImageFilter(ImageFilter::Type::Saturation, intensivness, strength);
+}
+
+void ActionFilterSaturation::acceptVisitor(ActionVisitor* visitor)
+{
+	visitor->visitActionFilterSaturation(this);
+}
+
+NovelLib::SerializationID ActionFilterSaturation::getType() const noexcept
+{
+	return NovelLib::SerializationID::ActionFilterSaturation;
+}
\ No newline at end of file
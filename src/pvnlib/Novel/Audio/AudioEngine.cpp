@@ -0,0 +1,825 @@
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QUrl>
+#include <algorithm>
+
+#include "pvnLib/Exceptions.h"
+#include "pvnLib/Novel/Data/NovelSettings.h"
+
+AudioEngine& AudioEngine::getInstance()
+{
+	static AudioEngine instance;
+	return instance;
+}
+
+AudioEngine::AudioEngine()
+{
+	musicDecoder_.setAudioFormat(PcmDecoder::getPreferredFormat());
+	connect(&musicDecoder_, &QAudioDecoder::bufferReady, this, &AudioEngine::onMusicBufferReady);
+	connect(&musicDecoder_, &QAudioDecoder::finished,    this, &AudioEngine::onMusicDecodingFinished);
+	connect(&musicDecoder_, qOverload<QAudioDecoder::Error>(&QAudioDecoder::error), this, [this](QAudioDecoder::Error)
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "Could not decode the Song \"" + musicDecoder_.source().toLocalFile() + "\":" << musicDecoder_.errorString();
+		//Whatever was decoded before the error is still played
+		if (decodingChunk_)
+		{
+			finishSong(!bSongHasAudio_ && decodingChunk_->samples.empty());
+			feedMusic();
+		}
+	});
+
+	decodeThreadPool_.setMaxThreadCount(1);
+
+	serviceTimer_.setInterval(20);
+	connect(&serviceTimer_, &QTimer::timeout, this, &AudioEngine::collectEvents);
+
+	if (QCoreApplication::instance())
+		connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &AudioEngine::shutdown);
+}
+
+AudioEngine::~AudioEngine()
+{
+	shutdown();
+}
+
+void AudioEngine::setOutputMode(OutputMode outputMode)
+{
+	if (mixerThread_)
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "Cannot change the AudioEngine's output mode after something was played";
+		return;
+	}
+	outputMode_ = outputMode;
+}
+
+AudioEngine::OutputMode AudioEngine::getOutputMode() const noexcept
+{
+	return outputMode_;
+}
+
+void AudioEngine::loadSound(const QString& filePath)
+{
+	if (filePath.isEmpty() || soundCache_.contains(filePath) || loadingSounds_.contains(filePath))
+		return;
+	loadingSounds_.insert(filePath);
+
+	decodeThreadPool_.start([this, generation = soundGeneration_, filePath]
+	{
+		std::shared_ptr<const PcmBuffer> pcmBuffer = PcmDecoder::decode(filePath);
+		QMetaObject::invokeMethod(this, [this, generation, filePath, pcmBuffer = std::move(pcmBuffer)]() mutable
+		{
+			onSoundDecoded(generation, filePath, std::move(pcmBuffer));
+		}, Qt::QueuedConnection);
+	});
+}
+
+bool AudioEngine::isSoundLoaded(const QString& filePath) const
+{
+	return soundCache_.contains(filePath);
+}
+
+void AudioEngine::unloadSound(const QString& filePath)
+{
+	soundCache_.remove(filePath);
+	loadingSounds_.remove(filePath);
+}
+
+void AudioEngine::playSound(const Sound& sound)
+{
+	if (sound.audioSettings.timesPlayed == 0 || sound.audioSettings.timesPlayed < -1)
+		return;
+
+	auto it = soundCache_.constFind(sound.soundFilePath);
+	if (it != soundCache_.cend())
+	{
+		startSound(sound, it.value());
+		return;
+	}
+
+	loadSound(sound.soundFilePath);
+	if (loadingSounds_.contains(sound.soundFilePath))
+		pendingSounds_.push_back(sound);
+}
+
+void AudioEngine::startSound(const Sound& sound, std::shared_ptr<const PcmBuffer> pcmBuffer)
+{
+	AudioCommand command;
+	command.type              = AudioCommand::Type::PlaySound;
+	command.buffer            = pcmBuffer.get();
+	command.token             = keepAlive(std::move(pcmBuffer), false);
+	command.delayFrames       = PcmBuffer::framesFromMilliseconds(sound.startDelay);
+	command.replayDelayFrames = PcmBuffer::framesFromMilliseconds(sound.audioSettings.delayBetweenReplays);
+	command.timesPlayed       = sound.audioSettings.timesPlayed;
+	command.bPersistent       = sound.bPersistToNewEvent;
+	stereoGains(sound.audioSettings.volume, sound.audioSettings.stereo, command.gainLeft, command.gainRight);
+
+	if (!sendCommand(command))
+		keptBuffers_.remove(command.token);
+}
+
+void AudioEngine::stopSounds(bool bIncludingPersistent)
+{
+	std::erase_if(pendingSounds_, [bIncludingPersistent](const Sound& sound) { return bIncludingPersistent || !sound.bPersistToNewEvent; });
+
+	//Nothing could have been played yet
+	if (outputMode_ == OutputMode::Device && !mixerThread_)
+		return;
+
+	AudioCommand command;
+	command.type        = AudioCommand::Type::StopSounds;
+	command.bPersistent = bIncludingPersistent;
+	sendCommand(command);
+}
+
+void AudioEngine::prepareBlip(const Sound& sound)
+{
+	if (sound.soundFilePath.isEmpty() || blipBuffers_.contains(sound.soundFilePath))
+		return;
+
+	auto it = soundCache_.constFind(sound.soundFilePath);
+	if (it != soundCache_.cend())
+	{
+		blipBuffers_.insert(sound.soundFilePath, it.value());
+		return;
+	}
+
+	loadSound(sound.soundFilePath);
+	if (loadingSounds_.contains(sound.soundFilePath))
+		pendingBlips_.insert(sound.soundFilePath);
+}
+
+void AudioEngine::playBlip(const Sound& sound)
+{
+	auto it = blipBuffers_.constFind(sound.soundFilePath);
+	if (it == blipBuffers_.cend())
+		return;
+
+	if (blipTimer_.isValid() && blipTimer_.elapsed() < MIN_BLIP_INTERVAL)
+		return;
+	blipTimer_.restart();
+
+	AudioCommand command;
+	command.type   = AudioCommand::Type::PlayBlip;
+	command.buffer = it.value().get();
+	stereoGains(sound.audioSettings.volume, sound.audioSettings.stereo, command.gainLeft, command.gainRight);
+	sendCommand(command);
+}
+
+void AudioEngine::releaseBlips()
+{
+	pendingBlips_.clear();
+
+	//Nothing could have been played yet
+	if (outputMode_ == OutputMode::Device && !mixerThread_)
+	{
+		blipBuffers_.clear();
+		return;
+	}
+
+	//Every buffer goes back to the GUI thread with its own StopBlips, only after the mixer stopped reading it
+	for (auto it = blipBuffers_.begin(); it != blipBuffers_.end(); ++it)
+	{
+		AudioCommand command;
+		command.type   = AudioCommand::Type::StopBlips;
+		command.buffer = it.value().get();
+		command.token  = keepAlive(std::move(it.value()), false);
+		if (!sendCommand(command))
+			keptBuffers_.remove(command.token);
+	}
+	blipBuffers_.clear();
+}
+
+void AudioEngine::playVoiceLine(const Sound& sound, std::shared_ptr<const PcmBuffer> pcmBuffer)
+{
+	if (!pcmBuffer)
+		return;
+
+	AudioCommand command;
+	command.type        = AudioCommand::Type::PlayVoiceLine;
+	command.buffer      = pcmBuffer.get();
+	command.token       = keepAlive(std::move(pcmBuffer), false);
+	command.delayFrames = PcmBuffer::framesFromMilliseconds(sound.startDelay);
+	stereoGains(sound.audioSettings.volume, sound.audioSettings.stereo, command.gainLeft, command.gainRight);
+
+	if (!sendCommand(command))
+		keptBuffers_.remove(command.token);
+}
+
+void AudioEngine::stopVoiceLine()
+{
+	//Nothing could have been played yet
+	if (outputMode_ == OutputMode::Device && !mixerThread_)
+		return;
+
+	AudioCommand command;
+	command.type = AudioCommand::Type::StopVoiceLine;
+	sendCommand(command);
+}
+
+void AudioEngine::playMusic(const MusicPlaylist& musicPlaylist)
+{
+	stopMusic();
+	if (musicPlaylist.songs.empty() || musicPlaylist.audioSettings.timesPlayed == 0 || musicPlaylist.audioSettings.timesPlayed < -1)
+		return;
+
+	musicPlaylist_ = musicPlaylist;
+	bMusicPlaying_ = true;
+	songsStarted_     = 0;
+	songsEnded_       = 0;
+	failedSongsInRow_ = 0;
+
+	AudioCommand command;
+	command.type = AudioCommand::Type::SetMusicGain;
+	stereoGains(musicPlaylist_.audioSettings.volume, musicPlaylist_.audioSettings.stereo, command.gainLeft, command.gainRight);
+	sendCommand(command);
+
+	startNextSong();
+}
+
+void AudioEngine::stopMusic()
+{
+	bMusicPlaying_ = false;
+	++musicGeneration_;
+	musicDecoder_.stop();
+	clearMusicState();
+
+	if (musicChunksInMixer_ == 0)
+		return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::StopMusic;
+	sendCommand(command);
+}
+
+void AudioEngine::updateVolumes()
+{
+	const NovelSettings& novelSettings = NovelSettings::getInstance();
+
+	AudioCommand command;
+	command.type        = AudioCommand::Type::SetMasterVolumes;
+	command.soundVolume = static_cast<float>(novelSettings.volumeSoundMultiplier);
+	command.musicVolume = static_cast<float>(novelSettings.volumeMusicMultiplier);
+	command.voiceVolume = static_cast<float>(novelSettings.volumeVoiceMultiplier);
+	sendCommand(command);
+}
+
+bool AudioEngine::renderOffline(const QString& wavFilePath, uint duration)
+{
+	if (outputMode_ != OutputMode::Offline)
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "AudioEngine::renderOffline works only in the Offline mode";
+		return false;
+	}
+
+	WavFileOutput output(wavFilePath);
+	if (!output.open())
+		return false;
+
+	while (!loadingSounds_.isEmpty() || !pendingSounds_.empty())
+	{
+		decodeThreadPool_.waitForDone();
+		//Delivers the decoded files queued by the decoding thread
+		QCoreApplication::sendPostedEvents(this);
+	}
+
+	updateVolumes();
+	for (qint64 remainingFrames = PcmBuffer::framesFromMilliseconds(duration); remainingFrames > 0;)
+	{
+		collectEvents();
+		processCommands();
+		//Rendering is faster than decoding, so it waits for the music instead of mixing silence in its place
+		while (bMusicPlaying_ && musicChunksCount_ == 0 && musicGapFrames_ == 0 && (decodingChunk_ || !pendingMusicChunks_.empty()))
+		{
+			QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents, 5);
+			collectEvents();
+			processCommands();
+		}
+
+		const qsizetype frameCount = std::min<qint64>(BLOCK_FRAMES, remainingFrames);
+		mix(mixBlock_.data(), frameCount);
+		output.write(mixBlock_.data(), frameCount);
+		remainingFrames -= frameCount;
+	}
+	output.close();
+	collectEvents();
+	return true;
+}
+
+void AudioEngine::shutdown()
+{
+	++soundGeneration_;
+	decodeThreadPool_.clear();
+	decodeThreadPool_.waitForDone();
+	loadingSounds_.clear();
+	pendingSounds_.clear();
+	pendingBlips_.clear();
+
+	bMixerRunning_.store(false, std::memory_order_release);
+	if (mixerThread_)
+	{
+		mixerThread_->wait();
+		delete mixerThread_;
+		mixerThread_ = nullptr;
+	}
+	serviceTimer_.stop();
+
+	bMusicPlaying_ = false;
+	++musicGeneration_;
+	musicDecoder_.stop();
+	clearMusicState();
+	musicChunksInMixer_ = 0;
+
+	//The mixer is not running anymore, so its state can be dropped from here
+	AudioCommand command;
+	while (commands_.pop(command));
+	AudioEvent event;
+	while (events_.pop(event));
+	while (musicEvents_.pop(event));
+	soundVoices_.fill(SoundVoice());
+	blipVoices_.fill(BlipVoice());
+	voiceLine_ = SoundVoice();
+	musicChunks_.fill(MusicChunk());
+	musicChunksHead_  = 0;
+	musicChunksCount_ = 0;
+	musicPosition_    = 0;
+	musicGapFrames_   = 0;
+
+	keptBuffers_.clear();
+	blipBuffers_.clear();
+	soundCache_.clear();
+}
+
+void AudioEngine::stereoGains(double volume, double stereo, float& gainLeft, float& gainRight) noexcept
+{
+	stereo    = qBound(0.0, stereo, 1.0);
+	gainLeft  = static_cast<float>(volume * std::min(1.0, 2.0 * (1.0 - stereo)));
+	gainRight = static_cast<float>(volume * std::min(1.0, 2.0 * stereo));
+}
+
+void AudioEngine::ensureStarted()
+{
+	if (outputMode_ != OutputMode::Device || mixerThread_)
+		return;
+
+	bMixerRunning_.store(true, std::memory_order_release);
+	mixerThread_ = QThread::create([this] { runMixer(); });
+	mixerThread_->start(QThread::TimeCriticalPriority);
+	serviceTimer_.start();
+	updateVolumes();
+}
+
+bool AudioEngine::sendCommand(const AudioCommand& command)
+{
+	ensureStarted();
+	//The audio device could not be opened, the error has been already reported
+	if (outputMode_ == OutputMode::Device && !bMixerRunning_.load(std::memory_order_acquire))
+		return false;
+
+	if (!commands_.push(command))
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "The AudioEngine's command queue is full, a command was dropped";
+		return false;
+	}
+	return true;
+}
+
+void AudioEngine::collectEvents()
+{
+	AudioEvent event;
+	while (musicEvents_.pop(event) || events_.pop(event))
+	{
+		switch (event.type)
+		{
+		case AudioEvent::Type::Release:
+		{
+			auto it = keptBuffers_.find(event.token);
+			if (it == keptBuffers_.end())
+				break;
+			if (it->bMusic)
+				--musicChunksInMixer_;
+			keptBuffers_.erase(it);
+			break;
+		}
+		case AudioEvent::Type::MusicEnded:
+			--musicChunksInMixer_;
+			//The last Song has been played and there is nothing more to decode
+			if (bMusicPlaying_ && event.token == musicGeneration_ && ++songsEnded_ == songsStarted_ && !decodingChunk_ && !bNextSongDue_)
+				bMusicPlaying_ = false;
+			break;
+		}
+	}
+	feedMusic();
+}
+
+quint64 AudioEngine::keepAlive(std::shared_ptr<const PcmBuffer> buffer, bool bMusic)
+{
+	const quint64 token = nextToken_++;
+	keptBuffers_.insert(token, KeptBuffer{ std::move(buffer), bMusic });
+	return token;
+}
+
+bool AudioEngine::hasNextSong() const
+{
+	const int timesPlayed = musicPlaylist_.audioSettings.timesPlayed;
+	return timesPlayed == -1 || static_cast<size_t>(songsStarted_) < static_cast<size_t>(timesPlayed) * musicPlaylist_.songs.size();
+}
+
+void AudioEngine::onSoundDecoded(quint64 generation, const QString& filePath, std::shared_ptr<const PcmBuffer> pcmBuffer)
+{
+	if (generation != soundGeneration_)
+		return;
+
+	//Not cached if it was unloaded while it was being decoded, the Sounds waiting for it are still played
+	if (loadingSounds_.remove(filePath) && pcmBuffer)
+		soundCache_.insert(filePath, pcmBuffer);
+
+	if (pendingBlips_.remove(filePath) && pcmBuffer)
+		blipBuffers_.insert(filePath, pcmBuffer);
+
+	//Taken out first, so they stop waiting even if the file could not be decoded
+	std::vector<Sound> decodedSounds;
+	std::erase_if(pendingSounds_, [&filePath, &decodedSounds](const Sound& sound)
+	{
+		if (sound.soundFilePath != filePath)
+			return false;
+		decodedSounds.push_back(sound);
+		return true;
+	});
+	if (pcmBuffer)
+		for (const Sound& sound : decodedSounds)
+			startSound(sound, pcmBuffer);
+}
+
+void AudioEngine::startNextSong()
+{
+	bNextSongDue_ = false;
+	if (!hasNextSong())
+		return;
+	++songsStarted_;
+
+	//The previous Song's chunks stay pending, so the new one is joined right after them
+	musicDecoder_.stop();
+	musicConverter_.reset();
+	decodingChunk_ = std::make_shared<PcmBuffer>();
+	bSongHasAudio_ = false;
+	bSongDecoded_  = false;
+	musicDecoder_.setSource(QUrl::fromLocalFile(musicPlaylist_.nextSong().second));
+	musicDecoder_.start();
+}
+
+void AudioEngine::onMusicBufferReady()
+{
+	feedMusic();
+}
+
+void AudioEngine::readMusicBuffers()
+{
+	//The decoder decodes the next buffer only once this one is read, so leaving it unread pauses the decoding until the mixer catches up
+	while (decodingChunk_ && pendingMusicChunks_.size() < MAX_PENDING_MUSIC_CHUNKS && musicDecoder_.bufferAvailable())
+	{
+		const QAudioBuffer audioBuffer = musicDecoder_.read();
+		musicConverter_.append(audioBuffer, decodingChunk_->samples);
+		if (decodingChunk_->frameCount() >= MUSIC_CHUNK_FRAMES)
+		{
+			pendingMusicChunks_.push_back(PendingMusicChunk{ std::move(decodingChunk_) });
+			bSongHasAudio_ = true;
+			decodingChunk_ = std::make_shared<PcmBuffer>();
+			decodingChunk_->samples.reserve(static_cast<size_t>(MUSIC_CHUNK_FRAMES + BLOCK_FRAMES) * PcmBuffer::CHANNELS);
+		}
+	}
+
+	//The Song ends only after its last buffer has been read
+	if (decodingChunk_ && bSongDecoded_ && !musicDecoder_.bufferAvailable())
+		finishSong(false);
+}
+
+void AudioEngine::onMusicDecodingFinished()
+{
+	if (!decodingChunk_)
+		return;
+	bSongDecoded_ = true;
+	feedMusic();
+}
+
+void AudioEngine::finishSong(bool bFailed)
+{
+	if (!decodingChunk_->samples.empty())
+		pendingMusicChunks_.push_back(PendingMusicChunk{ std::move(decodingChunk_) });
+	decodingChunk_.reset();
+	//A broken Song does not get the silence after it
+	pendingMusicChunks_.push_back(PendingMusicChunk{ nullptr, bFailed ? 0 : PcmBuffer::framesFromMilliseconds(musicPlaylist_.audioSettings.delayBetweenReplays) });
+
+	failedSongsInRow_ = bFailed ? failedSongsInRow_ + 1 : 0;
+	//A MusicPlaylist of broken Songs would otherwise be skipped through endlessly
+	bNextSongDue_ = static_cast<size_t>(failedSongsInRow_) < musicPlaylist_.songs.size() && hasNextSong();
+}
+
+void AudioEngine::feedMusic()
+{
+	readMusicBuffers();
+	while (musicChunksInMixer_ < MAX_MUSIC_CHUNKS && !pendingMusicChunks_.empty())
+	{
+		PendingMusicChunk& pendingMusicChunk = pendingMusicChunks_.front();
+		AudioCommand command;
+		if (pendingMusicChunk.buffer)
+		{
+			command.type   = AudioCommand::Type::QueueMusicChunk;
+			command.buffer = pendingMusicChunk.buffer.get();
+			command.token  = keepAlive(std::move(pendingMusicChunk.buffer), true);
+		}
+		else
+		{
+			command.type        = AudioCommand::Type::QueueMusicEnd;
+			command.token       = musicGeneration_;
+			command.delayFrames = pendingMusicChunk.gapFrames;
+		}
+		pendingMusicChunks_.pop_front();
+
+		if (!sendCommand(command))
+		{
+			if (command.type == AudioCommand::Type::QueueMusicChunk)
+				keptBuffers_.remove(command.token);
+			continue;
+		}
+		++musicChunksInMixer_;
+	}
+
+	//Only a few seconds are decoded ahead of what the mixer plays, the Songs are not decoded `timesPlayed` times over at once
+	if (bNextSongDue_ && bMusicPlaying_ && musicChunksInMixer_ + static_cast<int>(pendingMusicChunks_.size()) < MUSIC_DECODE_AHEAD_CHUNKS)
+		startNextSong();
+}
+
+void AudioEngine::clearMusicState()
+{
+	musicConverter_.reset();
+	decodingChunk_.reset();
+	bSongHasAudio_ = false;
+	bSongDecoded_  = false;
+	bNextSongDue_  = false;
+	pendingMusicChunks_.clear();
+}
+
+void AudioEngine::runMixer()
+{
+	AudioDeviceOutput output;
+	if (!output.open())
+	{
+		bMixerRunning_.store(false, std::memory_order_release);
+		return;
+	}
+
+	//QAudioSink moves the data to the device through this thread's own event loop, which also runs the mixing timer
+	QEventLoop eventLoop;
+	QTimer mixTimer;
+	mixTimer.setTimerType(Qt::PreciseTimer);
+	mixTimer.setInterval(MIX_INTERVAL);
+	connect(&mixTimer, &QTimer::timeout, &eventLoop, [this, &output, &eventLoop]
+	{
+		if (!bMixerRunning_.load(std::memory_order_acquire))
+		{
+			eventLoop.quit();
+			return;
+		}
+
+		processCommands();
+		while (output.getWritableFrames() >= BLOCK_FRAMES)
+		{
+			mix(mixBlock_.data(), BLOCK_FRAMES);
+			output.write(mixBlock_.data(), BLOCK_FRAMES);
+		}
+	});
+	mixTimer.start();
+	eventLoop.exec();
+	output.close();
+}
+
+void AudioEngine::processCommands() noexcept
+{
+	AudioCommand command;
+	while (commands_.pop(command))
+	{
+		switch (command.type)
+		{
+		case AudioCommand::Type::PlaySound:
+		{
+			auto voice = std::find_if(soundVoices_.begin(), soundVoices_.end(), [](const SoundVoice& soundVoice) { return !soundVoice.bActive; });
+			//Every voice is taken, the new Sound is dropped rather than cutting one that's already audible
+			if (voice == soundVoices_.end())
+			{
+				postEvent(AudioEvent{ AudioEvent::Type::Release, command.token });
+				break;
+			}
+			*voice = SoundVoice{ command.buffer, command.token, 0, command.delayFrames, command.replayDelayFrames, command.timesPlayed, command.gainLeft, command.gainRight, command.bPersistent, true };
+			break;
+		}
+		case AudioCommand::Type::StopSounds:
+			for (SoundVoice& voice : soundVoices_)
+				if (voice.bActive && (command.bPersistent || !voice.bPersistent))
+				{
+					voice.bActive = false;
+					postEvent(AudioEvent{ AudioEvent::Type::Release, voice.token });
+				}
+			break;
+		case AudioCommand::Type::PlayBlip:
+		{
+			//A new blip of the same Sound cuts the previous one short, otherwise it takes a free voice or the one that has played the longest
+			auto voice = std::find_if(blipVoices_.begin(), blipVoices_.end(), [&command](const BlipVoice& blipVoice) { return blipVoice.bActive && blipVoice.buffer == command.buffer; });
+			if (voice == blipVoices_.end())
+				voice = std::find_if(blipVoices_.begin(), blipVoices_.end(), [](const BlipVoice& blipVoice) { return !blipVoice.bActive; });
+			if (voice == blipVoices_.end())
+				voice = std::max_element(blipVoices_.begin(), blipVoices_.end(), [](const BlipVoice& first, const BlipVoice& second) { return first.position < second.position; });
+			*voice = BlipVoice{ command.buffer, 0, command.gainLeft, command.gainRight, true };
+			break;
+		}
+		case AudioCommand::Type::StopBlips:
+			for (BlipVoice& voice : blipVoices_)
+				if (voice.buffer == command.buffer)
+					voice.bActive = false;
+			postEvent(AudioEvent{ AudioEvent::Type::Release, command.token });
+			break;
+		case AudioCommand::Type::PlayVoiceLine:
+			if (voiceLine_.bActive)
+				postEvent(AudioEvent{ AudioEvent::Type::Release, voiceLine_.token });
+			voiceLine_ = SoundVoice{ command.buffer, command.token, 0, command.delayFrames, 0, 1, command.gainLeft, command.gainRight, false, true };
+			break;
+		case AudioCommand::Type::StopVoiceLine:
+			if (voiceLine_.bActive)
+			{
+				voiceLine_.bActive = false;
+				postEvent(AudioEvent{ AudioEvent::Type::Release, voiceLine_.token });
+			}
+			break;
+		case AudioCommand::Type::QueueMusicChunk:
+		case AudioCommand::Type::QueueMusicEnd:
+			//The GUI thread never sends more than fits
+			if (musicChunksCount_ == MAX_MUSIC_CHUNKS)
+			{
+				postMusicEvent(AudioEvent{ command.buffer ? AudioEvent::Type::Release : AudioEvent::Type::MusicEnded, command.token });
+				break;
+			}
+			musicChunks_[(musicChunksHead_ + musicChunksCount_++) % MAX_MUSIC_CHUNKS] = MusicChunk{ command.type == AudioCommand::Type::QueueMusicChunk ? command.buffer : nullptr, command.token, command.delayFrames };
+			break;
+		case AudioCommand::Type::StopMusic:
+			for (; musicChunksCount_ != 0; --musicChunksCount_, musicChunksHead_ = (musicChunksHead_ + 1) % MAX_MUSIC_CHUNKS)
+			{
+				const MusicChunk& chunk = musicChunks_[musicChunksHead_];
+				postMusicEvent(AudioEvent{ chunk.buffer ? AudioEvent::Type::Release : AudioEvent::Type::MusicEnded, chunk.token });
+			}
+			musicPosition_  = 0;
+			musicGapFrames_ = 0;
+			break;
+		case AudioCommand::Type::SetMusicGain:
+			musicGainLeft_  = command.gainLeft;
+			musicGainRight_ = command.gainRight;
+			break;
+		case AudioCommand::Type::SetMasterVolumes:
+			soundVolume_ = command.soundVolume;
+			musicVolume_ = command.musicVolume;
+			voiceVolume_ = command.voiceVolume;
+			break;
+		}
+	}
+}
+
+void AudioEngine::mix(float* frames, qsizetype frameCount) noexcept
+{
+	std::fill(frames, frames + frameCount * PcmBuffer::CHANNELS, 0.0f);
+	mixSounds(frames, frameCount);
+	mixBlips(frames, frameCount);
+	if (voiceLine_.bActive)
+		mixSoundVoice(voiceLine_, voiceVolume_, frames, frameCount);
+	mixMusic(frames, frameCount);
+}
+
+void AudioEngine::mixSounds(float* frames, qsizetype frameCount) noexcept
+{
+	for (SoundVoice& voice : soundVoices_)
+		if (voice.bActive)
+			mixSoundVoice(voice, soundVolume_, frames, frameCount);
+}
+
+void AudioEngine::mixSoundVoice(SoundVoice& voice, float volume, float* frames, qsizetype frameCount) noexcept
+{
+	constexpr float SAMPLE_SCALE = 1.0f / 32768.0f;
+
+	const qsizetype bufferFrames = voice.buffer->frameCount();
+	const float gainLeft  = voice.gainLeft  * volume * SAMPLE_SCALE,
+				gainRight = voice.gainRight * volume * SAMPLE_SCALE;
+	for (qsizetype frame = 0; frame != frameCount && voice.bActive;)
+	{
+		if (voice.delayFrames > 0)
+		{
+			const qsizetype skipped = std::min<qint64>(voice.delayFrames, frameCount - frame);
+			voice.delayFrames -= skipped;
+			frame             += skipped;
+			continue;
+		}
+
+		const qsizetype mixed  = std::min(bufferFrames - voice.position, frameCount - frame);
+		const qint16*   source = voice.buffer->samples.data() + voice.position * PcmBuffer::CHANNELS;
+		float*          target = frames + frame * PcmBuffer::CHANNELS;
+		for (qsizetype i = 0; i != mixed; ++i)
+		{
+			target[2 * i]     += source[2 * i]     * gainLeft;
+			target[2 * i + 1] += source[2 * i + 1] * gainRight;
+		}
+		voice.position += mixed;
+		frame          += mixed;
+
+		if (voice.position < bufferFrames)
+			continue;
+		voice.position = 0;
+		if (voice.remainingPlays > 0)
+			--voice.remainingPlays;
+		if (voice.remainingPlays == 0 || bufferFrames == 0)
+		{
+			voice.bActive = false;
+			postEvent(AudioEvent{ AudioEvent::Type::Release, voice.token });
+		}
+		else
+			voice.delayFrames = voice.replayDelayFrames;
+	}
+}
+
+void AudioEngine::mixBlips(float* frames, qsizetype frameCount) noexcept
+{
+	constexpr float SAMPLE_SCALE = 1.0f / 32768.0f;
+
+	for (BlipVoice& voice : blipVoices_)
+	{
+		if (!voice.bActive)
+			continue;
+
+		const float gainLeft  = voice.gainLeft  * voiceVolume_ * SAMPLE_SCALE,
+					gainRight = voice.gainRight * voiceVolume_ * SAMPLE_SCALE;
+		const qsizetype mixed  = std::min(voice.buffer->frameCount() - voice.position, frameCount);
+		const qint16*   source = voice.buffer->samples.data() + voice.position * PcmBuffer::CHANNELS;
+		for (qsizetype i = 0; i != mixed; ++i)
+		{
+			frames[2 * i]     += source[2 * i]     * gainLeft;
+			frames[2 * i + 1] += source[2 * i + 1] * gainRight;
+		}
+		voice.position += mixed;
+		if (voice.position >= voice.buffer->frameCount())
+			voice.bActive = false;
+	}
+}
+
+void AudioEngine::mixMusic(float* frames, qsizetype frameCount) noexcept
+{
+	constexpr float SAMPLE_SCALE = 1.0f / 32768.0f;
+	const float gainLeft  = musicGainLeft_  * musicVolume_ * SAMPLE_SCALE,
+				gainRight = musicGainRight_ * musicVolume_ * SAMPLE_SCALE;
+
+	for (qsizetype frame = 0; frame != frameCount && (musicGapFrames_ != 0 || musicChunksCount_ != 0);)
+	{
+		if (musicGapFrames_ > 0)
+		{
+			const qsizetype skipped = std::min<qint64>(musicGapFrames_, frameCount - frame);
+			musicGapFrames_ -= skipped;
+			frame           += skipped;
+			continue;
+		}
+
+		//The next Song's chunks follow the end marker directly, so the Songs are joined without a gap
+		const MusicChunk& chunk = musicChunks_[musicChunksHead_];
+		if (chunk.buffer)
+		{
+			const qsizetype mixed  = std::min(chunk.buffer->frameCount() - musicPosition_, frameCount - frame);
+			const qint16*   source = chunk.buffer->samples.data() + musicPosition_ * PcmBuffer::CHANNELS;
+			float*          target = frames + frame * PcmBuffer::CHANNELS;
+			for (qsizetype i = 0; i != mixed; ++i)
+			{
+				target[2 * i]     += source[2 * i]     * gainLeft;
+				target[2 * i + 1] += source[2 * i + 1] * gainRight;
+			}
+			musicPosition_ += mixed;
+			frame          += mixed;
+			if (musicPosition_ < chunk.buffer->frameCount())
+				continue;
+			postMusicEvent(AudioEvent{ AudioEvent::Type::Release, chunk.token });
+		}
+		else
+		{
+			postMusicEvent(AudioEvent{ AudioEvent::Type::MusicEnded, chunk.token });
+			musicGapFrames_ = chunk.gapFrames;
+		}
+
+		musicPosition_   = 0;
+		musicChunksHead_ = (musicChunksHead_ + 1) % MAX_MUSIC_CHUNKS;
+		--musicChunksCount_;
+	}
+}
+
+void AudioEngine::postEvent(const AudioEvent& event) noexcept
+{
+	//The queue holds far more than the voices in the mixer, so it cannot overflow unless the GUI thread stalls for seconds; a lost Release of a Sound only delays freeing its buffer until `shutdown()`
+	events_.push(event);
+}
+
+void AudioEngine::postMusicEvent(const AudioEvent& event) noexcept
+{
+	//Cannot fail, the GUI thread never has more music in the mixer than this queue holds
+	musicEvents_.push(event);
+}
@@ -0,0 +1,317 @@
+#pragma once
+#include <QAudioDecoder>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "pvnLib/Novel/Audio/AudioOutput.h"
+#include "pvnLib/Novel/Audio/LockFreeQueue.h"
+#include "pvnLib/Novel/Audio/PcmBuffer.h"
+#include "pvnLib/Novel/Data/Audio/MusicPlaylist.h"
+#include "pvnLib/Novel/Data/Audio/Sound.h"
+
+/// Plays the Sounds and the MusicPlaylist
+/// Sounds are decoded once into PcmBuffers (cached by their file path) on a background thread, so the GUI thread never waits for a decoder; music is decoded while it plays, at most `MAX_PENDING_MUSIC_CHUNKS` chunks ahead of the mixer, and handed to it one chunk at a time
+/// The next Song is decoded once the music queued ahead of the mixer runs low, so the mixer joins them without a gap (other than `delayBetweenReplays`) and a looping MusicPlaylist does not pile up in memory
+/// Everything is mixed on a dedicated real-time thread, which receives the commands through a LockFreeQueue and sends back the buffers it no longer uses, so it never locks, allocates or frees memory
+/// The public methods must be called from the GUI thread
+/// **Singleton**
+class AudioEngine final : public QObject
+{
+	Q_OBJECT
+public:
+	enum class OutputMode
+	{
+		/// Mixed in real time on the mixing thread and played on the default audio device
+		Device,
+		/// Mixed only by `renderOffline()`, which does not need a sound device
+		Offline
+	};
+
+	static AudioEngine& getInstance();
+	AudioEngine(const AudioEngine&)            = delete;
+	AudioEngine& operator=(const AudioEngine&) = delete;
+	~AudioEngine() override;
+
+	/// Must be set before anything is played
+	void setOutputMode(OutputMode outputMode);
+	OutputMode getOutputMode() const noexcept;
+
+	/// Starts decoding the file into the cache in the background, if it's not there (or on its way) yet
+	void loadSound(const QString& filePath);
+	/// \return Whether the file has been decoded into the cache
+	bool isSoundLoaded(const QString& filePath) const;
+	/// Drops the file from the cache, the Sounds that are still playing it keep their buffer until they end
+	void unloadSound(const QString& filePath);
+
+	/// Plays the Sound with its AudioSettings (volume, stereo, repetitions and the delay between them) after its `startDelay`
+	/// If it's not loaded yet, it's loaded first and its `startDelay` counts from when the decoding finishes
+	void playSound(const Sound& sound);
+	/// \param bIncludingPersistent Whether the Sounds that persist to a new Event are stopped as well
+	void stopSounds(bool bIncludingPersistent = false);
+
+	/// Pins a Voice's `insertionSound`, so `playBlip()` can play it without decoding or allocating anything
+	/// If it's not loaded yet, it's pinned once it's decoded and the blips before that are skipped
+	void prepareBlip(const Sound& sound);
+	/// Plays a pinned blip as soon as the mixer gets to it, meant to be called for every revealed character
+	/// Cuts short the previous blip of the same Sound and steals the oldest blip when all of them are taken
+	/// Blips closer than `MIN_BLIP_INTERVAL` milliseconds apart are skipped, so fast text does not turn into noise
+	void playBlip(const Sound& sound);
+	/// Unpins all the blips, they are freed once the mixer stops playing them
+	void releaseBlips();
+
+	/// Plays an already decoded voice line with the `sound`'s AudioSettings, cutting the previous one short
+	/// There is only one voice line at a time and it is scaled by `NovelSettings::volumeVoiceMultiplier`
+	void playVoiceLine(const Sound& sound, std::shared_ptr<const PcmBuffer> pcmBuffer);
+	void stopVoiceLine();
+
+	/// Replaces the current music, the Songs are played in the MusicPlaylist's order, the whole MusicPlaylist repeats `audioSettings.timesPlayed` times
+	/// `audioSettings.delayBetweenReplays` of silence is mixed after every Song
+	void playMusic(const MusicPlaylist& musicPlaylist);
+	void stopMusic();
+
+	/// Applies the volume multipliers from the NovelSettings, should be called after they change
+	void updateVolumes();
+
+	/// Mixes `duration` milliseconds of the current Sounds and music into a WAV file on the calling thread
+	/// Waits for the Sounds that are still being decoded, so they start at the beginning of the render
+	/// Works only in the Offline mode
+	/// \return Whether the file was written
+	bool renderOffline(const QString& wavFilePath, uint duration);
+
+	/// Stops the mixing thread and drops everything
+	void shutdown();
+
+private:
+	//Nothing can create the AudioEngine, but its methods
+	AudioEngine();
+
+	static constexpr qsizetype BLOCK_FRAMES        = 256;
+	/// How often (in milliseconds) the mixing thread tops up the audio device, a precise timer so it does not depend on the scheduler's sleep granularity
+	static constexpr int       MIX_INTERVAL        = 5;
+	static constexpr int       MAX_SOUND_VOICES    = 64;
+	/// How many chunks of music (with the end markers) the mixer holds, the rest waits on the GUI thread
+	static constexpr int       MAX_MUSIC_CHUNKS    = 8;
+	/// Size of a music chunk handed to the mixer
+	static constexpr qsizetype MUSIC_CHUNK_FRAMES  = PcmBuffer::SAMPLE_RATE;
+	/// How many decoded chunks (with the end markers) wait on the GUI thread, the decoder is paused (its buffers are left unread) while there are this many
+	static constexpr size_t    MAX_PENDING_MUSIC_CHUNKS = 4;
+	/// The next Song starts decoding once fewer chunks (with the end markers) than this are queued in the mixer and on the GUI thread
+	static constexpr int       MUSIC_DECODE_AHEAD_CHUNKS = MAX_MUSIC_CHUNKS / 2;
+	static constexpr int       MAX_BLIP_VOICES     = 4;
+	/// In milliseconds
+	static constexpr qint64    MIN_BLIP_INTERVAL   = 35;
+
+	struct AudioCommand
+	{
+		enum class Type
+		{
+			PlaySound,
+			StopSounds,
+			PlayBlip,
+			/// Stops the blips of the `buffer` and gives back the `token`
+			StopBlips,
+			PlayVoiceLine,
+			StopVoiceLine,
+			QueueMusicChunk,
+			/// Marks the end of a Song, the mixer reports when it gets there and then mixes `delayFrames` of silence
+			QueueMusicEnd,
+			StopMusic,
+			SetMusicGain,
+			SetMasterVolumes
+		};
+
+		Type             type              = Type::PlaySound;
+		const PcmBuffer* buffer            = nullptr;
+		/// Identifies the buffer when the mixer gives it back, or the music's generation for the QueueMusicEnd
+		quint64          token             = 0;
+		float            gainLeft          = 1.0f,
+						 gainRight         = 1.0f;
+		qint64           delayFrames       = 0,
+						 replayDelayFrames = 0;
+		int              timesPlayed       = 1;
+		bool             bPersistent       = false;
+		float            soundVolume       = 1.0f,
+						 musicVolume       = 1.0f,
+						 voiceVolume       = 1.0f;
+	};
+
+	struct AudioEvent
+	{
+		enum class Type
+		{
+			/// The mixer no longer uses the buffer of `token`
+			Release,
+			/// The mixer reached the end of a Song of the `token` generation
+			MusicEnded
+		};
+
+		Type    type  = Type::Release;
+		quint64 token = 0;
+	};
+
+	/// Mixer-side state of a playing Sound
+	struct SoundVoice
+	{
+		const PcmBuffer* buffer            = nullptr;
+		quint64          token             = 0;
+		qsizetype        position          = 0;
+		qint64           delayFrames       = 0,
+						 replayDelayFrames = 0;
+		/// -1 loops infinitely
+		int              remainingPlays    = 0;
+		float            gainLeft          = 1.0f,
+						 gainRight         = 1.0f;
+		bool             bPersistent       = false,
+						 bActive           = false;
+	};
+
+	/// Mixer-side state of a playing blip, its buffer is pinned by the GUI thread
+	struct BlipVoice
+	{
+		const PcmBuffer* buffer   = nullptr;
+		qsizetype        position = 0;
+		float            gainLeft  = 1.0f,
+						 gainRight = 1.0f;
+		bool             bActive  = false;
+	};
+
+	struct MusicChunk
+	{
+		/// nullptr marks the end of a Song
+		const PcmBuffer* buffer    = nullptr;
+		quint64          token     = 0;
+		/// Silence after the end of a Song
+		qint64           gapFrames = 0;
+	};
+
+	/// Equal gain at the centre, one side fades out as the other one is approached
+	static void stereoGains(double volume, double stereo, float& gainLeft, float& gainRight) noexcept;
+
+	//GUI thread
+	void ensureStarted();
+	bool sendCommand(const AudioCommand& command);
+	/// Handles everything the mixer has sent back and feeds it more music
+	void collectEvents();
+	quint64 keepAlive(std::shared_ptr<const PcmBuffer> buffer, bool bMusic);
+	void startSound(const Sound& sound, std::shared_ptr<const PcmBuffer> pcmBuffer);
+	/// Caches the decoded file and plays or pins the Sounds that were waiting for it
+	void onSoundDecoded(quint64 generation, const QString& filePath, std::shared_ptr<const PcmBuffer> pcmBuffer);
+	/// Whether the MusicPlaylist has not been played `timesPlayed` times yet
+	bool hasNextSong() const;
+	void startNextSong();
+	void onMusicBufferReady();
+	/// Reads the decoded buffers into chunks, as long as there are fewer than `MAX_PENDING_MUSIC_CHUNKS` of them
+	void readMusicBuffers();
+	void onMusicDecodingFinished();
+	/// Queues the end of the decoded Song, the next one is started by `feedMusic()` once the queued music runs low
+	/// \param bFailed Whether nothing could be decoded, the MusicPlaylist stops once all of its Songs fail in a row
+	void finishSong(bool bFailed);
+	/// Reads the decoded music, sends the pending chunks to the mixer and starts decoding the next Song if there is little music queued
+	void feedMusic();
+	void clearMusicState();
+
+	//Mixing thread (or `renderOffline()`)
+	void runMixer();
+	void processCommands() noexcept;
+	void mix(float* frames, qsizetype frameCount) noexcept;
+	void mixSounds(float* frames, qsizetype frameCount) noexcept;
+	/// Mixes a single SoundVoice, deactivating it and giving its buffer back once it's played `remainingPlays` times
+	void mixSoundVoice(SoundVoice& voice, float volume, float* frames, qsizetype frameCount) noexcept;
+	void mixBlips(float* frames, qsizetype frameCount) noexcept;
+	void mixMusic(float* frames, qsizetype frameCount) noexcept;
+	void postEvent(const AudioEvent& event) noexcept;
+	/// Releases of the music chunks and ends of the Songs, which must never be lost, as the GUI thread counts the music in the mixer by them
+	void postMusicEvent(const AudioEvent& event) noexcept;
+
+	OutputMode outputMode_ = OutputMode::Device;
+
+	LockFreeQueue<AudioCommand, 1024> commands_;
+	LockFreeQueue<AudioEvent,   1024> events_;
+	/// Holds more than the music chunks the mixer can have, so it never overflows
+	LockFreeQueue<AudioEvent,   2 * MAX_MUSIC_CHUNKS> musicEvents_;
+
+	QThread*          mixerThread_ = nullptr;
+	std::atomic<bool> bMixerRunning_{ false };
+	/// Collects the mixer's events and feeds the music
+	QTimer            serviceTimer_;
+
+	//GUI thread state
+	QHash<QString, std::shared_ptr<const PcmBuffer>> soundCache_;
+	/// Files being decoded by `decodeThreadPool_`
+	QSet<QString> loadingSounds_;
+	/// Played before their file was decoded
+	std::vector<Sound> pendingSounds_;
+	/// Prepared before their file was decoded
+	QSet<QString> pendingBlips_;
+	/// Changes with every `shutdown()`, so a late decoded file is dropped
+	quint64 soundGeneration_ = 0;
+	/// Decodes the Sounds, one file at a time
+	QThreadPool decodeThreadPool_;
+	struct KeptBuffer
+	{
+		std::shared_ptr<const PcmBuffer> buffer;
+		bool bMusic = false;
+	};
+	/// Buffers the mixer might still read, released when it sends them back
+	QHash<quint64, KeptBuffer> keptBuffers_;
+	quint64 nextToken_ = 1;
+
+	/// Pinned `insertionSound`s of the Voices
+	QHash<QString, std::shared_ptr<const PcmBuffer>> blipBuffers_;
+	QElapsedTimer blipTimer_;
+
+	MusicPlaylist musicPlaylist_;
+	bool          bMusicPlaying_       = false;
+	/// Songs started (decoded) and ended (played) since `playMusic()`, to stop after `timesPlayed` passes over the MusicPlaylist
+	int           songsStarted_        = 0,
+				  songsEnded_          = 0,
+				  failedSongsInRow_    = 0;
+	/// Changes with every `playMusic()` and `stopMusic()`, so a late MusicEnded of the stopped music is ignored
+	quint64       musicGeneration_     = 0;
+	QAudioDecoder musicDecoder_;
+	PcmConverter  musicConverter_;
+	/// nullptr when no Song is being decoded
+	std::shared_ptr<PcmBuffer> decodingChunk_;
+	bool          bSongHasAudio_       = false;
+	/// The decoder has finished, the Song ends once its remaining buffers are read
+	bool          bSongDecoded_        = false;
+	/// The previous Song has been decoded and the next one waits for the queued music to run low
+	bool          bNextSongDue_        = false;
+	struct PendingMusicChunk
+	{
+		/// nullptr marks the end of a Song
+		std::shared_ptr<const PcmBuffer> buffer;
+		qint64 gapFrames = 0;
+	};
+	/// Decoded ahead of the mixer, possibly spanning the end of one Song and the start of the next one
+	std::deque<PendingMusicChunk> pendingMusicChunks_;
+	/// Chunks and end markers sent to the mixer and not reported back yet
+	int           musicChunksInMixer_     = 0;
+
+	//Mixing thread state
+	std::array<float, BLOCK_FRAMES * PcmBuffer::CHANNELS> mixBlock_{};
+	std::array<SoundVoice, MAX_SOUND_VOICES> soundVoices_{};
+	std::array<BlipVoice,  MAX_BLIP_VOICES>  blipVoices_{};
+	SoundVoice voiceLine_;
+	/// Ring of the chunks waiting to be mixed, the end markers take a place as well
+	std::array<MusicChunk, MAX_MUSIC_CHUNKS> musicChunks_{};
+	int       musicChunksHead_  = 0,
+			  musicChunksCount_ = 0;
+	qsizetype musicPosition_    = 0;
+	qint64    musicGapFrames_   = 0;
+	float     musicGainLeft_    = 1.0f,
+			  musicGainRight_   = 1.0f,
+			  soundVolume_      = 1.0f,
+			  musicVolume_      = 1.0f,
+			  voiceVolume_      = 1.0f;
+};
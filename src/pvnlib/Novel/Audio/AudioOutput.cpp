@@ -0,0 +1,128 @@
+#include "pvnLib/Novel/Audio/AudioOutput.h"
+
+#include <QAudioSink>
+#include <QDataStream>
+#include <QMediaDevices>
+#include <cmath>
+#include <limits>
+
+#include "pvnLib/Exceptions.h"
+#include "pvnLib/Novel/Audio/PcmBuffer.h"
+
+namespace
+{
+	void toSamples(const float* frames, qsizetype frameCount, std::vector<qint16>& samples)
+	{
+		samples.resize(static_cast<size_t>(frameCount) * PcmBuffer::CHANNELS);
+		for (size_t i = 0; i != samples.size(); ++i)
+			samples[i] = static_cast<qint16>(std::lround(qBound(-1.0f, frames[i], 1.0f) * 32767.0f));
+	}
+}
+
+AudioDeviceOutput::AudioDeviceOutput()  = default;
+AudioDeviceOutput::~AudioDeviceOutput() { close(); }
+
+bool AudioDeviceOutput::open()
+{
+	QAudioFormat format;
+	format.setSampleRate(PcmBuffer::SAMPLE_RATE);
+	format.setChannelCount(PcmBuffer::CHANNELS);
+	format.setSampleFormat(QAudioFormat::Int16);
+
+	const QAudioDevice audioDevice = QMediaDevices::defaultAudioOutput();
+	if (audioDevice.isNull() || !audioDevice.isFormatSupported(format))
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "The default audio device cannot play 16-bit stereo at" << PcmBuffer::SAMPLE_RATE << "Hz";
+		return false;
+	}
+
+	audioSink_ = std::make_unique<QAudioSink>(audioDevice, format);
+	//15 ms, so a blip of a revealed character is heard within a frame; the mixing thread tops it up from a precise timer every `AudioEngine::MIX_INTERVAL` milliseconds, which does not depend on the scheduler's sleep granularity
+	audioSink_->setBufferSize(format.bytesForDuration(15000));
+	device_ = audioSink_->start();
+	if (!device_)
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "Could not start the audio device";
+		audioSink_.reset();
+		return false;
+	}
+	return true;
+}
+
+void AudioDeviceOutput::close()
+{
+	if (!audioSink_)
+		return;
+	audioSink_->stop();
+	audioSink_.reset();
+	device_ = nullptr;
+}
+
+qsizetype AudioDeviceOutput::getWritableFrames()
+{
+	return audioSink_ ? audioSink_->bytesFree() / (PcmBuffer::CHANNELS * static_cast<qsizetype>(sizeof(qint16))) : 0;
+}
+
+void AudioDeviceOutput::write(const float* frames, qsizetype frameCount)
+{
+	if (!device_)
+		return;
+	toSamples(frames, frameCount, samples_);
+	device_->write(reinterpret_cast<const char*>(samples_.data()), static_cast<qint64>(samples_.size() * sizeof(qint16)));
+}
+
+WavFileOutput::WavFileOutput(const QString& filePath)
+	: file_(filePath)
+{
+}
+
+WavFileOutput::~WavFileOutput()
+{
+	close();
+}
+
+bool WavFileOutput::open()
+{
+	if (!file_.open(QIODeviceBase::WriteOnly | QIODeviceBase::Truncate))
+	{
+		qCritical() << NovelLib::ErrorType::General << "Could not open the WAV file \"" + file_.fileName() + "\":" << file_.errorString();
+		return false;
+	}
+	dataBytes_ = 0;
+	//Placeholder, the sizes are known only in `close()`
+	file_.write(QByteArray(44, '\0'));
+	return true;
+}
+
+void WavFileOutput::close()
+{
+	if (!file_.isOpen())
+		return;
+
+	constexpr quint16 BLOCK_ALIGN = PcmBuffer::CHANNELS * sizeof(qint16);
+	file_.seek(0);
+	QDataStream header(&file_);
+	header.setByteOrder(QDataStream::LittleEndian);
+	header.writeRawData("RIFF", 4);
+	header << static_cast<quint32>(36 + dataBytes_);
+	header.writeRawData("WAVEfmt ", 8);
+	header << quint32(16) << quint16(1) << quint16(PcmBuffer::CHANNELS) << quint32(PcmBuffer::SAMPLE_RATE)
+		   << quint32(PcmBuffer::SAMPLE_RATE * BLOCK_ALIGN) << BLOCK_ALIGN << quint16(16);
+	header.writeRawData("data", 4);
+	header << static_cast<quint32>(dataBytes_);
+	file_.close();
+}
+
+qsizetype WavFileOutput::getWritableFrames()
+{
+	return std::numeric_limits<qsizetype>::max();
+}
+
+void WavFileOutput::write(const float* frames, qsizetype frameCount)
+{
+	toSamples(frames, frameCount, samples_);
+	//WAV is little-endian, as are the platforms this runs on
+	const qint64 bytes = static_cast<qint64>(samples_.size() * sizeof(qint16));
+	file_.write(reinterpret_cast<const char*>(samples_.data()), bytes);
+	dataBytes_ += bytes;
+}
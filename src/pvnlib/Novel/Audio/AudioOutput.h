@@ -0,0 +1,67 @@
+#pragma once
+#include <QFile>
+#include <QString>
+#include <memory>
+#include <vector>
+
+class QAudioSink;
+class QIODevice;
+
+/// Where the AudioEngine's mix goes
+/// The frames are interleaved stereo floats at `PcmBuffer::SAMPLE_RATE`, clipped to [-1.0, 1.0] by the output
+class AudioOutput
+{
+public:
+	virtual ~AudioOutput() = default;
+
+	/// \return Whether the output is ready to accept frames
+	virtual bool open()  = 0;
+	virtual void close() = 0;
+
+	/// \return How many frames can be written right now without blocking
+	virtual qsizetype getWritableFrames() = 0;
+	virtual void write(const float* frames, qsizetype frameCount) = 0;
+};
+
+/// Plays the mix on the default audio device through QAudioSink in push mode
+/// Must be created, used and destroyed on the mixing thread
+class AudioDeviceOutput final : public AudioOutput
+{
+public:
+	AudioDeviceOutput();
+	~AudioDeviceOutput() override;
+
+	bool open()  override;
+	void close() override;
+
+	qsizetype getWritableFrames() override;
+	void write(const float* frames, qsizetype frameCount) override;
+
+private:
+	std::unique_ptr<QAudioSink> audioSink_;
+	/// Owned by `audioSink_`
+	QIODevice* device_ = nullptr;
+	/// Frames converted to 16-bit samples, reused by every `write()`
+	std::vector<qint16> samples_;
+};
+
+/// Writes the mix into a 16-bit stereo WAV file as fast as it's rendered, so the AudioEngine can run without a sound device (e.g. in tests)
+class WavFileOutput final : public AudioOutput
+{
+public:
+	explicit WavFileOutput(const QString& filePath);
+	~WavFileOutput() override;
+
+	bool open()  override;
+	/// Fills in the sizes in the WAV header
+	void close() override;
+
+	/// Offline, so it always accepts frames
+	qsizetype getWritableFrames() override;
+	void write(const float* frames, qsizetype frameCount) override;
+
+private:
+	QFile file_;
+	qint64 dataBytes_ = 0;
+	std::vector<qint16> samples_;
+};
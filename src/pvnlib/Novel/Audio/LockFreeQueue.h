@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/// Bounded queue for exactly one producer thread and one consumer thread
+/// Neither side ever locks or allocates, so it's safe to use from the real-time audio thread
+/// \tparam Capacity Must be a power of two, one slot is always left empty
+template<typename T, size_t Capacity>
+class LockFreeQueue final
+{
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "LockFreeQueue's capacity must be a power of two");
+
+public:
+	LockFreeQueue() = default;
+	LockFreeQueue(const LockFreeQueue&)            = delete;
+	LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+	/// Producer only
+	/// \return Whether there was room for the item
+	bool push(const T& item) noexcept
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		const size_t next = (tail + 1) & (Capacity - 1);
+		if (next == head_.load(std::memory_order_acquire))
+			return false;
+
+		items_[tail] = item;
+		tail_.store(next, std::memory_order_release);
+		return true;
+	}
+
+	/// Consumer only
+	/// \return Whether there was an item to pop
+	bool pop(T& item) noexcept
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if (head == tail_.load(std::memory_order_acquire))
+			return false;
+
+		item = items_[head];
+		head_.store((head + 1) & (Capacity - 1), std::memory_order_release);
+		return true;
+	}
+
+private:
+	std::array<T, Capacity> items_{};
+
+	//On separate cache lines, so the producer and the consumer do not invalidate each other's line on every operation
+	alignas(64) std::atomic<size_t> head_{ 0 };
+	alignas(64) std::atomic<size_t> tail_{ 0 };
+};
@@ -0,0 +1,106 @@
+#include "pvnLib/Novel/Audio/PcmBuffer.h"
+
+#include <QAudioBuffer>
+#include <QAudioDecoder>
+#include <QEventLoop>
+#include <QUrl>
+#include <cmath>
+
+#include "pvnLib/Exceptions.h"
+
+namespace
+{
+	qint16 toSample(float value) noexcept
+	{
+		return static_cast<qint16>(std::lround(qBound(-1.0f, value, 1.0f) * 32767.0f));
+	}
+}
+
+void PcmConverter::append(const QAudioBuffer& audioBuffer, std::vector<qint16>& samples)
+{
+	const QAudioFormat format = audioBuffer.format();
+	const int channelCount    = format.channelCount();
+	const int bytesPerSample  = format.bytesPerSample();
+	if (!format.isValid() || channelCount <= 0 || bytesPerSample <= 0 || format.sampleRate() <= 0)
+		return;
+
+	const double step  = static_cast<double>(format.sampleRate()) / PcmBuffer::SAMPLE_RATE;
+	const char*  frame = audioBuffer.constData<char>();
+	const qsizetype frameCount = audioBuffer.frameCount();
+	samples.reserve(samples.size() + static_cast<size_t>(std::ceil(frameCount / step) + 1) * PcmBuffer::CHANNELS);
+
+	for (qsizetype i = 0; i != frameCount; ++i, frame += bytesPerSample * channelCount)
+	{
+		//Mono is played on both sides, the channels past the stereo ones are dropped
+		const float left  = format.normalizedSampleValue(frame);
+		const float right = channelCount > 1 ? format.normalizedSampleValue(frame + bytesPerSample) : left;
+		if (!bHasPrevious_)
+		{
+			previousLeft_  = left;
+			previousRight_ = right;
+			bHasPrevious_  = true;
+			continue;
+		}
+
+		for (; position_ < 1.0; position_ += step)
+		{
+			const float t = static_cast<float>(position_);
+			samples.push_back(toSample(previousLeft_  + (left  - previousLeft_)  * t));
+			samples.push_back(toSample(previousRight_ + (right - previousRight_) * t));
+		}
+		position_     -= 1.0;
+		previousLeft_  = left;
+		previousRight_ = right;
+	}
+}
+
+void PcmConverter::reset() noexcept
+{
+	bHasPrevious_ = false;
+	position_     = 0.0;
+}
+
+QAudioFormat PcmDecoder::getPreferredFormat()
+{
+	QAudioFormat format;
+	format.setSampleRate(PcmBuffer::SAMPLE_RATE);
+	format.setChannelCount(PcmBuffer::CHANNELS);
+	format.setSampleFormat(QAudioFormat::Int16);
+	return format;
+}
+
+std::shared_ptr<const PcmBuffer> PcmDecoder::decode(const QString& filePath)
+{
+	std::shared_ptr<PcmBuffer> pcmBuffer = std::make_shared<PcmBuffer>();
+	PcmConverter converter;
+	bool bError = false;
+
+	QAudioDecoder decoder;
+	decoder.setAudioFormat(getPreferredFormat());
+	decoder.setSource(QUrl::fromLocalFile(filePath));
+
+	QEventLoop eventLoop;
+	QObject::connect(&decoder, &QAudioDecoder::bufferReady, &eventLoop, [&]
+	{
+		converter.append(decoder.read(), pcmBuffer->samples);
+	});
+	QObject::connect(&decoder, &QAudioDecoder::finished, &eventLoop, &QEventLoop::quit);
+	QObject::connect(&decoder, qOverload<QAudioDecoder::Error>(&QAudioDecoder::error), &eventLoop, [&](QAudioDecoder::Error)
+	{
+		bError = true;
+		eventLoop.quit();
+	});
+
+	decoder.start();
+	//The decoder might have failed already
+	if (!bError && decoder.isDecoding())
+		eventLoop.exec(QEventLoop::ExcludeUserInputEvents);
+
+	if (bError || pcmBuffer->samples.empty())
+	{
+		qCritical() << NovelLib::ErrorType::AudioInvalid << "Could not decode the audio file \"" + filePath + "\":" << decoder.errorString();
+		return nullptr;
+	}
+	pcmBuffer->samples.shrink_to_fit();
+	return pcmBuffer;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <QAudioFormat>
+#include <QString>
+#include <memory>
+#include <vector>
+
+class QAudioBuffer;
+
+/// Decoded audio in the AudioEngine's own format: interleaved stereo, signed 16-bit, `SAMPLE_RATE` Hz
+/// 16-bit samples take half the memory of floats, which matters for the streamed music
+struct PcmBuffer
+{
+	static constexpr int SAMPLE_RATE = 48000;
+	static constexpr int CHANNELS    = 2;
+
+	std::vector<qint16> samples;
+
+	qsizetype frameCount() const noexcept { return static_cast<qsizetype>(samples.size()) / CHANNELS; }
+
+	/// \return Number of frames that last `milliseconds`
+	static qint64 framesFromMilliseconds(qint64 milliseconds) noexcept { return milliseconds * SAMPLE_RATE / 1000; }
+};
+
+/// Converts the buffers produced by QAudioDecoder (any sample format, channel count and rate) into the PcmBuffer's format
+/// Resampling is linear and keeps its state between the buffers, so a stream can be converted buffer by buffer without clicks at the joints
+class PcmConverter final
+{
+public:
+	/// Appends the converted frames of `audioBuffer` to `samples`
+	void append(const QAudioBuffer& audioBuffer, std::vector<qint16>& samples);
+	/// Forgets the previous stream
+	void reset() noexcept;
+
+private:
+	/// Last source frame, the next output frame is interpolated between it and the upcoming one
+	float previousLeft_  = 0.0f,
+		  previousRight_ = 0.0f;
+	bool  bHasPrevious_  = false;
+	/// Position of the next output frame, measured in the source frames after the previous one
+	double position_ = 0.0;
+};
+
+/// Decodes whole audio files into PcmBuffers
+namespace PcmDecoder
+{
+	/// Format requested from QAudioDecoder, some backends ignore it, so the result goes through the PcmConverter anyway
+	QAudioFormat getPreferredFormat();
+
+	/// Decodes the whole file, blocking (with a local event loop) until it's done
+	/// Meant for the short Sounds, music is streamed by the AudioEngine instead
+	/// Called only on the decoding threads of the AudioEngine and the VoiceLineStreamer, so the GUI thread never runs the nested event loop
+	/// \return nullptr if the file could not be decoded
+	std::shared_ptr<const PcmBuffer> decode(const QString& filePath);
+}
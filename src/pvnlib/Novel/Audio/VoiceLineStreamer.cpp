@@ -0,0 +1,113 @@
+#include "pvnLib/Novel/Audio/VoiceLineStreamer.h"
+
+#include <QCoreApplication>
+
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+
+VoiceLineStreamer& VoiceLineStreamer::getInstance()
+{
+	static VoiceLineStreamer instance;
+	return instance;
+}
+
+VoiceLineStreamer::VoiceLineStreamer()
+{
+	decodeThreadPool_.setMaxThreadCount(1);
+	if (QCoreApplication::instance())
+		connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &VoiceLineStreamer::shutdown);
+}
+
+VoiceLineStreamer::~VoiceLineStreamer()
+{
+	shutdown();
+}
+
+void VoiceLineStreamer::setSentences(const std::vector<Sentence>& sentences)
+{
+	release();
+
+	voiceLines_.reserve(sentences.size());
+	for (const Sentence& sentence : sentences)
+		voiceLines_.push_back(VoiceLine{ sentence.voiceLine });
+}
+
+void VoiceLineStreamer::play(uint sentenceIndex)
+{
+	AudioEngine::getInstance().stopVoiceLine();
+	bPlayPending_ = false;
+	if (sentenceIndex >= voiceLines_.size())
+		return;
+	sentenceIndex_.store(sentenceIndex, std::memory_order_relaxed);
+
+	//Lines outside of the window are either spoken already or were skipped over
+	for (uint i = 0; i != voiceLines_.size(); ++i)
+		if (!isInWindow(i))
+		{
+			voiceLines_[i].pcmBuffer.reset();
+			voiceLines_[i].bRequested = false;
+		}
+
+	const uint windowEnd = qMin(sentenceIndex + PREFETCH_LINES + 1, static_cast<uint>(voiceLines_.size()));
+	for (uint i = sentenceIndex; i != windowEnd; ++i)
+	{
+		VoiceLine& voiceLine = voiceLines_[i];
+		if (voiceLine.sound.soundFilePath.isEmpty() || voiceLine.bRequested)
+			continue;
+		voiceLine.bRequested = true;
+
+		decodeThreadPool_.start([this, generation = generation_.load(std::memory_order_relaxed), i, filePath = voiceLine.sound.soundFilePath]
+		{
+			if (generation != generation_.load(std::memory_order_relaxed) || !isInWindow(i))
+				return;
+
+			std::shared_ptr<const PcmBuffer> pcmBuffer = PcmDecoder::decode(filePath);
+			QMetaObject::invokeMethod(this, [this, generation, i, pcmBuffer = std::move(pcmBuffer)]() mutable
+			{
+				onLineDecoded(generation, i, std::move(pcmBuffer));
+			}, Qt::QueuedConnection);
+		});
+	}
+
+	VoiceLine& voiceLine = voiceLines_[sentenceIndex];
+	if (voiceLine.pcmBuffer)
+		AudioEngine::getInstance().playVoiceLine(voiceLine.sound, voiceLine.pcmBuffer);
+	else
+		bPlayPending_ = !voiceLine.sound.soundFilePath.isEmpty();
+}
+
+void VoiceLineStreamer::release()
+{
+	generation_.fetch_add(1, std::memory_order_relaxed);
+	decodeThreadPool_.clear();
+	bPlayPending_ = false;
+	voiceLines_.clear();
+	AudioEngine::getInstance().stopVoiceLine();
+}
+
+bool VoiceLineStreamer::isInWindow(uint sentenceIndex) const noexcept
+{
+	const uint shownIndex = sentenceIndex_.load(std::memory_order_relaxed);
+	return sentenceIndex >= shownIndex && sentenceIndex <= shownIndex + PREFETCH_LINES;
+}
+
+void VoiceLineStreamer::onLineDecoded(quint64 generation, uint sentenceIndex, std::shared_ptr<const PcmBuffer> pcmBuffer)
+{
+	if (generation != generation_.load(std::memory_order_relaxed) || !isInWindow(sentenceIndex) || !voiceLines_[sentenceIndex].bRequested)
+		return;
+
+	voiceLines_[sentenceIndex].pcmBuffer = std::move(pcmBuffer);
+	if (bPlayPending_ && sentenceIndex == sentenceIndex_.load(std::memory_order_relaxed))
+	{
+		bPlayPending_ = false;
+		AudioEngine::getInstance().playVoiceLine(voiceLines_[sentenceIndex].sound, voiceLines_[sentenceIndex].pcmBuffer);
+	}
+}
+
+void VoiceLineStreamer::shutdown()
+{
+	generation_.fetch_add(1, std::memory_order_relaxed);
+	decodeThreadPool_.clear();
+	decodeThreadPool_.waitForDone();
+	bPlayPending_ = false;
+	voiceLines_.clear();
+}
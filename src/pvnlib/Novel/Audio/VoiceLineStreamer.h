@@ -0,0 +1,59 @@
+#pragma once
+#include <QObject>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "pvnLib/Novel/Audio/PcmBuffer.h"
+#include "pvnLib/Novel/Data/Text/Sentence.h"
+
+/// Plays the `voiceLine`s of a dialogue's Sentences through the AudioEngine
+/// Only the shown Sentence and `PREFETCH_LINES` after it are decoded (in the background), the lines already spoken are released, so a fully voiced Scene never sits decoded in the memory
+/// Must be used from the GUI thread
+/// **Singleton**
+class VoiceLineStreamer final : public QObject
+{
+	Q_OBJECT
+public:
+	/// How many upcoming Sentences are decoded ahead of the shown one
+	static constexpr uint PREFETCH_LINES = 3;
+
+	static VoiceLineStreamer& getInstance();
+	VoiceLineStreamer(const VoiceLineStreamer&)            = delete;
+	VoiceLineStreamer& operator=(const VoiceLineStreamer&) = delete;
+	~VoiceLineStreamer() override;
+
+	/// Rebinds the VoiceLineStreamer to another dialogue, dropping the lines of the previous one
+	void setSentences(const std::vector<Sentence>& sentences);
+	/// Plays the line of the `sentenceIndex` Sentence (as soon as it's decoded) and prefetches the next ones
+	void play(uint sentenceIndex);
+	/// Stops the line and drops every decoded one
+	void release();
+
+private:
+	//Nothing can create the VoiceLineStreamer, but its methods
+	VoiceLineStreamer();
+
+	struct VoiceLine
+	{
+		Sound                            sound;
+		std::shared_ptr<const PcmBuffer> pcmBuffer;
+		bool                             bRequested = false;
+	};
+
+	bool isInWindow(uint sentenceIndex) const noexcept;
+	void onLineDecoded(quint64 generation, uint sentenceIndex, std::shared_ptr<const PcmBuffer> pcmBuffer);
+	void shutdown();
+
+	std::vector<VoiceLine> voiceLines_;
+
+	/// Read by the decoding tasks, so they can skip the lines that are no longer needed
+	std::atomic<quint64> generation_{ 0 };
+	std::atomic<uint>    sentenceIndex_{ 0 };
+	/// The shown Sentence's line is played once it's decoded
+	bool bPlayPending_ = false;
+
+	/// Decodes one line at a time, in the order they are needed
+	QThreadPool decodeThreadPool_;
+};
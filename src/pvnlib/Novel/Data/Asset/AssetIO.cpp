@@ -3,6 +3,8 @@
 #include "pvnLib/Novel/Data/Asset/AssetManager.h"
 
 #include <QFile>
+#include <QImageReader>
+#include <QtMath>
 
 template class AssetAnim<AnimNodeDouble1D>;
 template class AssetAnim<AnimNodeDouble2D>;
@@ -111,7 +113,37 @@ void AssetImage::load()
 	//	return;
 	//}	
 	//TODO: add some way to edit Images (even using external editors) in the Editor, then allow for compression to happen
-	img_ = std::unique_ptr<QImage>(new QImage(path));
+	if (TiledImagePack::isTiledImagePack(path, pos))
+	{
+		tiledImagePack_ = std::unique_ptr<TiledImagePack>(new TiledImagePack());
+		if (!tiledImagePack_->open(path, pos))
+		{
+			tiledImagePack_.reset();
+			return;
+		}
+		sourceSize_   = tiledImagePack_->getSourceSize();
+		decodedScale_ = QSizeF(1.0, 1.0);
+		return;
+	}
+
+	//QImageReader reads the size from the header, so the image can be downscaled while decoding, without ever holding the full-resolution pixels
+	QImageReader reader(path);
+	sourceSize_ = reader.size();
+
+	decodedScale_ = QSizeF(1.0, 1.0);
+	if (sourceSize_.isValid())
+	{
+		const QSize scaledSize = getDecodeSize();
+		if (scaledSize != sourceSize_)
+		{
+			reader.setScaledSize(scaledSize);
+			decodedScale_ = QSizeF(static_cast<double>(scaledSize.width()) / sourceSize_.width(), static_cast<double>(scaledSize.height()) / sourceSize_.height());
+		}
+	}
+
+	img_ = std::unique_ptr<QImage>(new QImage(reader.read()));
+	if (img_->isNull())
+		qCritical() << NovelLib::ErrorType::AssetImageLoad << "Could not load the AssetImage \"" + name + "\" from \"" + path + "\":" << reader.errorString();
 	//img = std::unique_ptr<QImage>();
 	//QFile file(path);
 	//if (!file.open(QIODevice::ReadOnly))
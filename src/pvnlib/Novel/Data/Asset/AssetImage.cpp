@@ -1,5 +1,7 @@
 #include "pvnLib/Novel/Data/Asset/AssetImage.h"
 
+#include <QtMath>
+
 AssetImage::AssetImage(const QString& name, uint size, uint pos, const QString& path, bool bErrorCheck)
 	: Asset(name, size, pos, path)
 {
@@ -9,15 +11,91 @@ AssetImage::AssetImage(const QString& name, uint size, uint pos, const QString&
 
 bool AssetImage::isLoaded() const 
 { 
-	return img_.get() != nullptr; 
+	return img_.get() != nullptr || tiledImagePack_.get() != nullptr; 
 }
 
 void AssetImage::unload() noexcept
 { 
+	if (onUnload_)
+		onUnload_(*this);
 	img_.reset();
+	tiledImagePack_.reset();
 }
 
 const QImage* AssetImage::getImage() const noexcept
 {
 	return img_.get();
 }
+
+const TiledImagePack* AssetImage::getTiledImagePack() const noexcept
+{
+	return tiledImagePack_.get();
+}
+
+void AssetImage::requestDisplayScale(double displayScale)
+{
+	displayScale_ = qMax(displayScale_, qAbs(displayScale));
+	unloadIfTooSmall();
+}
+
+void AssetImage::setDisplaySize(const QSize& displaySize)
+{
+	if (displaySize_ == displaySize)
+	{
+		unloadIfTooSmall();
+		return;
+	}
+
+	displaySize_ = displaySize;
+	if (isLoaded())
+		unload();
+}
+
+void AssetImage::setViewScale(double viewScale) noexcept
+{
+	viewScale_ = qMax(viewScale, 0.0);
+}
+
+void AssetImage::setOnUnloadListener(std::function<void(const AssetImage& assetImage)> onUnload)
+{
+	onUnload_ = std::move(onUnload);
+}
+
+QSize AssetImage::getDecodeSize() const
+{
+	if (!sourceSize_.isValid())
+		return sourceSize_;
+
+	if (displaySize_.isValid())
+		return sourceSize_.boundedTo((QSizeF(displaySize_) * viewScale_).toSize().expandedTo(QSize(1, 1)));
+
+	if (displayScale_ > 0.0)
+	{
+		const double scale = qMin(displayScale_ * viewScale_, 1.0);
+		//Rounding up, so the image is never displayed upscaled
+		return QSize(qMax(1, qCeil(sourceSize_.width() * scale)), qMax(1, qCeil(sourceSize_.height() * scale)));
+	}
+	return sourceSize_;
+}
+
+void AssetImage::unloadIfTooSmall()
+{
+	if (!img_ || img_->isNull())
+		return;
+
+	//The decoded pixels would be upscaled, so they need to be decoded again
+	const QSize decodeSize = getDecodeSize();
+	if (img_->width() < decodeSize.width() || img_->height() < decodeSize.height())
+		unload();
+}
+
+QSize AssetImage::getSourceSize() const noexcept
+{
+	return sourceSize_;
+}
+
+QSizeF AssetImage::getSourceScale() const noexcept
+{
+	return QSizeF(decodedScale_.width()  > 0.0 ? 1.0 / decodedScale_.width()  : 1.0,
+	              decodedScale_.height() > 0.0 ? 1.0 / decodedScale_.height() : 1.0);
+}
@@ -1,7 +1,9 @@
 #pragma once
 #include "pvnLib/Novel/Data/Asset/Asset.h"
+#include "pvnLib/Novel/Data/Asset/TiledImagePack.h"
 
 #include <QImage>
+#include <functional>
 
 /// Allows Image loading and its memory management
 class AssetImage final : public Asset
@@ -29,8 +31,48 @@ public:
 	/// \todo implement this
 	void save() override;
 
+	/// \return nullptr if the AssetImage is a TiledImagePack, as it is never decoded whole
 	const QImage* getImage() const noexcept;
+	/// \return nullptr if the AssetImage is a regular image
+	const TiledImagePack* getTiledImagePack() const noexcept;
+
+	/// Raises the largest scale at which the image is displayed in the scene (1.0 means one image pixel per scene pixel)
+	/// The image is decoded at most at this scale (multiplied by the view scale) and never above its native size, so the full-resolution pixels are not stored when they would be downscaled anyway
+	/// If the image is already decoded with fewer pixels, it is unloaded and needs to be loaded again
+	void requestDisplayScale(double displayScale);
+	/// The image is stretched to this size (in scene pixels) when displayed (e.g. a background filling the scene), so it is decoded at most at this size (multiplied by the view scale)
+	/// If the image is already decoded at another size, it is unloaded and needs to be loaded again
+	/// \param displaySize An invalid QSize disables the limit
+	void setDisplaySize(const QSize& displaySize);
+	/// Sets how many device pixels the SceneWidget uses for a single scene pixel
+	/// Affects the images decoded afterwards, the loaded ones are decoded again by their next `requestDisplayScale()`/`setDisplaySize()` if they have too few pixels
+	static void setViewScale(double viewScale) noexcept;
+	/// Registers the function called (if not nullptr) by `unload()` of every AssetImage, before the image is freed, so the widgets can drop what they made from it
+	/// The function must not throw, as `unload()` is noexcept
+	static void setOnUnloadListener(std::function<void(const AssetImage& assetImage)> onUnload);
+
+	/// \return Size of the image file, which might be larger than the decoded image
+	QSize getSourceSize() const noexcept;
+	/// \return How many source pixels are covered by a single decoded pixel on each axis, the image has to be scaled by it to keep the size it would have at full resolution
+	QSizeF getSourceScale() const noexcept;
 
 protected:
+	/// \return Size at which the image should be decoded, given its display scale/size and the view scale
+	QSize getDecodeSize() const;
+	/// Unloads the image if it was decoded with fewer pixels than `getDecodeSize()`
+	void unloadIfTooSmall();
+
 	std::unique_ptr<QImage> img_ = nullptr;
+	/// Oversized images are split into tiles, only the index is loaded and the tiles are streamed by the widgets
+	std::unique_ptr<TiledImagePack> tiledImagePack_ = nullptr;
+
+	/// 0.0 means that no scale was requested and the image is decoded at full resolution
+	double displayScale_ = 0.0;
+	/// Scale at which `img_` was decoded, the axes differ if the image was stretched or rounded
+	QSizeF decodedScale_ = QSizeF(1.0, 1.0);
+	QSize  displaySize_;
+	QSize  sourceSize_;
+
+	static inline double viewScale_ = 1.0;
+	static inline std::function<void(const AssetImage& assetImage)> onUnload_ = nullptr;
 };
\ No newline at end of file
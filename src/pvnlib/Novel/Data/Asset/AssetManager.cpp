@@ -90,7 +90,9 @@ AssetAnimScale* AssetManager::addAssetAnimScale(const QString& name, uint size,
 
 AssetImage* AssetManager::addAssetImageSceneryBackground(const QString& name, uint size, uint pos, const QString& path)
 {
-	return NovelLib::Helpers::mapSet(backgroundImages_, std::move(AssetImage(name, size, pos, path)), "Asset", NovelLib::ErrorType::General, "", "", "", "", false);
+	//Panoramas and other oversized backgrounds are streamed tile by tile, the ones embedded in a larger file (at `pos`) are expected to be packed already
+	const QString imagePath = (pos == 0 && !path.isEmpty()) ? TiledImagePack::packIfOversized(path) : path;
+	return NovelLib::Helpers::mapSet(backgroundImages_, std::move(AssetImage(name, size, pos, imagePath)), "Asset", NovelLib::ErrorType::General, "", "", "", "", false);
 }
 
 AssetImage* AssetManager::addAssetImageSceneryObject(const QString& name, uint size, uint pos, const QString& path)
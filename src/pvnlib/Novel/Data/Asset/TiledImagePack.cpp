@@ -0,0 +1,191 @@
+#include "pvnLib/Novel/Data/Asset/TiledImagePack.h"
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QImageReader>
+
+#include "pvnLib/Exceptions.h"
+
+/// Magic, version, source width and height, tile size, column and row count
+static constexpr qint64 HEADER_SIZE = 7 * sizeof(qint32);
+
+bool TiledImagePack::build(const QString& imagePath, const QString& packPath, int tileSize)
+{
+	if (tileSize <= 0)
+	{
+		qCritical() << NovelLib::ErrorType::General << "Tried to build a TiledImagePack with a non-positive tile size (" << tileSize << ')';
+		return false;
+	}
+
+	QImageReader reader(imagePath);
+	const QImage image = reader.read();
+	if (image.isNull())
+	{
+		qCritical() << NovelLib::ErrorType::AssetImageLoad << "Could not read the image \"" + imagePath + "\":" << reader.errorString();
+		return false;
+	}
+	const QSize sourceSize = image.size();
+
+	QFile file(packPath);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		qCritical() << NovelLib::ErrorType::General << "Couldn't open \"" + packPath + "\" File";
+		return false;
+	}
+
+	const int columns = (sourceSize.width()  + tileSize - 1) / tileSize,
+			  rows    = (sourceSize.height() + tileSize - 1) / tileSize;
+
+	QDataStream dataStream(&file);
+	dataStream << MAGIC << VERSION << qint32(sourceSize.width()) << qint32(sourceSize.height()) << qint32(tileSize) << qint32(columns) << qint32(rows);
+
+	//The index is written with placeholders first and filled once the tiles' sizes are known
+	std::vector<qint64> tileOffsets(static_cast<size_t>(columns) * rows + 1, 0);
+	for (qint64 tileOffset : tileOffsets)
+		dataStream << tileOffset;
+
+	size_t tileIndex = 0;
+	for (int row = 0; row != rows; ++row)
+	{
+		for (int column = 0; column != columns; ++column)
+		{
+			QByteArray tileData;
+			QBuffer buffer(&tileData);
+			buffer.open(QIODevice::WriteOnly);
+			image.copy(QRect(column * tileSize, row * tileSize, tileSize, tileSize).intersected(image.rect())).save(&buffer, "PNG");
+
+			tileOffsets[tileIndex++] = file.pos();
+			file.write(tileData);
+		}
+	}
+	tileOffsets[tileIndex] = file.pos();
+
+	file.seek(HEADER_SIZE);
+	for (qint64 tileOffset : tileOffsets)
+		dataStream << tileOffset;
+
+	if (dataStream.status() != QDataStream::Ok)
+	{
+		qCritical() << NovelLib::ErrorType::General << "Could not write to File \"" + packPath + '\"';
+		return false;
+	}
+	return true;
+}
+
+QString TiledImagePack::packIfOversized(const QString& imagePath)
+{
+	if (isTiledImagePack(imagePath))
+		return imagePath;
+
+	//Only the header is read to check the size
+	const QSize sourceSize = QImageReader(imagePath).size();
+	if (!sourceSize.isValid() || (sourceSize.width() <= OVERSIZED_DIMENSION && sourceSize.height() <= OVERSIZED_DIMENSION))
+		return imagePath;
+
+	const QString packPath = imagePath + ".pvnt";
+	const QFileInfo packInfo(packPath);
+	if (packInfo.exists() && packInfo.lastModified() >= QFileInfo(imagePath).lastModified() && isTiledImagePack(packPath))
+		return packPath;
+
+	return build(imagePath, packPath) ? packPath : imagePath;
+}
+
+bool TiledImagePack::isTiledImagePack(const QString& path, qint64 offset)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly) || !file.seek(offset))
+		return false;
+
+	QDataStream dataStream(&file);
+	quint32 magic = 0;
+	dataStream >> magic;
+	return dataStream.status() == QDataStream::Ok && magic == MAGIC;
+}
+
+bool TiledImagePack::open(const QString& path, qint64 offset)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly) || !file.seek(offset))
+	{
+		qCritical() << NovelLib::ErrorType::AssetImageFileMissing << "Could not open the File \"" + path + '\"';
+		return false;
+	}
+
+	QDataStream dataStream(&file);
+	quint32 magic = 0, version = 0;
+	qint32 width = 0, height = 0, tileSize = 0, columns = 0, rows = 0;
+	dataStream >> magic >> version >> width >> height >> tileSize >> columns >> rows;
+	if (dataStream.status() != QDataStream::Ok || magic != MAGIC || version != VERSION || tileSize <= 0 || columns <= 0 || rows <= 0)
+	{
+		qCritical() << NovelLib::ErrorType::AssetImageInvalid << "The TiledImagePack \"" + path + "\" is corrupted or has an unsupported version";
+		return false;
+	}
+
+	std::vector<qint64> tileOffsets(static_cast<size_t>(columns) * rows + 1);
+	for (qint64& tileOffset : tileOffsets)
+		dataStream >> tileOffset;
+	if (dataStream.status() != QDataStream::Ok)
+	{
+		qCritical() << NovelLib::ErrorType::AssetImageInvalid << "The TiledImagePack \"" + path + "\" has a truncated tile index";
+		return false;
+	}
+
+	path_        = path;
+	offset_      = offset;
+	sourceSize_  = QSize(width, height);
+	tileSize_    = tileSize;
+	columns_     = columns;
+	rows_        = rows;
+	tileOffsets_ = std::move(tileOffsets);
+	return true;
+}
+
+QImage TiledImagePack::readTile(int column, int row) const
+{
+	if (column < 0 || column >= columns_ || row < 0 || row >= rows_)
+	{
+		qCritical() << NovelLib::ErrorType::General << "Tried to read a tile (" << column << ',' << row << ") outside of the TiledImagePack \"" + path_ + '\"';
+		return QImage();
+	}
+
+	const size_t tileIndex = static_cast<size_t>(row) * columns_ + column;
+	QFile file(path_);
+	if (!file.open(QIODevice::ReadOnly) || !file.seek(offset_ + tileOffsets_[tileIndex]))
+	{
+		qCritical() << NovelLib::ErrorType::AssetImageFileMissing << "Could not open the File \"" + path_ + '\"';
+		return QImage();
+	}
+
+	QImage tile = QImage::fromData(file.read(tileOffsets_[tileIndex + 1] - tileOffsets_[tileIndex]), "PNG");
+	if (tile.isNull())
+		qCritical() << NovelLib::ErrorType::AssetImageLoad << "Could not decode a tile (" << column << ',' << row << ") of the TiledImagePack \"" + path_ + '\"';
+
+	return tile;
+}
+
+QRect TiledImagePack::getTileRect(int column, int row) const noexcept
+{
+	return QRect(column * tileSize_, row * tileSize_, tileSize_, tileSize_).intersected(QRect(QPoint(0, 0), sourceSize_));
+}
+
+QSize TiledImagePack::getSourceSize() const noexcept
+{
+	return sourceSize_;
+}
+
+int TiledImagePack::getTileSize() const noexcept
+{
+	return tileSize_;
+}
+
+int TiledImagePack::getColumnCount() const noexcept
+{
+	return columns_;
+}
+
+int TiledImagePack::getRowCount() const noexcept
+{
+	return rows_;
+}
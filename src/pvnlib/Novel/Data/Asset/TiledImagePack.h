@@ -0,0 +1,67 @@
+#pragma once
+#include <QImage>
+#include <QRect>
+#include <QString>
+#include <vector>
+
+/// Image split into fixed-size tiles, each one compressed separately, so a single tile can be decoded without touching the rest of the image
+/// Used for oversized (e.g. panoramic) backgrounds, which would take hundreds of megabytes if decoded whole
+/// The pack might be embedded in a larger binary file, starting at some offset
+class TiledImagePack final
+{
+public:
+	/// Identifies the pack, so AssetImage can tell it apart from a regular image file
+	static constexpr quint32 MAGIC   = 0x50564E54; //"PVNT"
+	static constexpr quint32 VERSION = 1;
+
+	/// Images with a larger width or height are turned into a TiledImagePack by `packIfOversized()`
+	static constexpr int OVERSIZED_DIMENSION = 4096;
+
+	/// Splits the image into tiles and saves them in a pack
+	/// The image is decoded once for the whole build, it is only done when the pack is (re)built, never during the gameplay
+	/// \exception Error Could not read the image or write the pack
+	/// \return Whether the pack was built
+	static bool build(const QString& imagePath, const QString& packPath, int tileSize = 512);
+
+	/// Builds a pack next to the image (with ".pvnt" appended to its path) if it is larger than `OVERSIZED_DIMENSION`, unless the pack is already newer than the image
+	/// \exception Error Could not read the image or write the pack
+	/// \return Path of the pack, or `imagePath` if the image is not oversized or the pack could not be built
+	static QString packIfOversized(const QString& imagePath);
+
+	/// \return Whether there is a TiledImagePack at `offset` in the file
+	static bool isTiledImagePack(const QString& path, qint64 offset = 0);
+
+	TiledImagePack()                                 = default;
+	TiledImagePack(const TiledImagePack&)            = delete;
+	TiledImagePack& operator=(const TiledImagePack&) = delete;
+
+	/// Reads only the header and the tile index
+	/// \exception Error Could not open/read the pack or it is corrupted
+	/// \return Whether the pack was opened
+	bool open(const QString& path, qint64 offset = 0);
+
+	/// Decodes a single tile, the pack file is opened only for the time of reading, so it can be called from any thread
+	/// \exception Error Could not read the tile or `column`/`row` is out of the pack
+	/// \return Decoded tile or a null QImage if an Error has occurred
+	QImage readTile(int column, int row) const;
+
+	/// \return Area of the whole image covered by the tile, the tiles at the right and bottom edges might be smaller than `tileSize`
+	QRect getTileRect(int column, int row) const noexcept;
+
+	QSize getSourceSize() const noexcept;
+	int   getTileSize()   const noexcept;
+	int   getColumnCount() const noexcept;
+	int   getRowCount()    const noexcept;
+
+private:
+	QString path_   = "";
+	qint64  offset_ = 0;
+
+	QSize sourceSize_;
+	int   tileSize_ = 0;
+	int   columns_  = 0;
+	int   rows_     = 0;
+
+	/// Positions of the tiles' data relative to `offset_`, with one more entry marking the end of the last tile
+	std::vector<qint64> tileOffsets_;
+};
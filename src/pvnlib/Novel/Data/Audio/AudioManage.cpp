@@ -1,8 +1,25 @@
 #include "pvnLib/Novel/Data/Audio/MusicPlaylist.h"
 #include "pvnLib/Novel/Data/Audio/Sound.h"
 
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+
 #include <random>
 
+namespace
+{
+	/// Seeded once per session, so reshuffling does not hit `std::random_device` (which may block) and can be reproduced with `MusicPlaylist::setShuffleSeed()`
+	std::mt19937& getShuffleGenerator()
+	{
+		static std::mt19937 generator(std::random_device{}());
+		return generator;
+	}
+}
+
+void MusicPlaylist::setShuffleSeed(quint32 seed)
+{
+	getShuffleGenerator().seed(seed);
+}
+
 const std::pair<QString, QString> MusicPlaylist::nextSong()
 {
 	if (!songs.size())
@@ -10,13 +27,12 @@ const std::pair<QString, QString> MusicPlaylist::nextSong()
 	if (currentlyPlayedSongID_ == -1)
 		return songs[currentlyPlayedSongID_ = 0];
 
-	if (++currentlyPlayedSongID_ > songs.size())
+	if (++currentlyPlayedSongID_ >= static_cast<int>(songs.size()))
 	{
 		if (bRandomizePlaylist && songs.size() > 1)
 		{
 			std::pair<QString, QString> previous = songs[(currentlyPlayedSongID_ == 0) ? (songs.size() - 1) : (currentlyPlayedSongID_ - 1)];
-			std::random_device randomDevice;
-			std::mt19937 generator(randomDevice());
+			std::mt19937& generator = getShuffleGenerator();
 			do
 				std::shuffle(songs.begin(), songs.end(), generator);
 			while (songs[0] == previous);
@@ -28,13 +44,15 @@ const std::pair<QString, QString> MusicPlaylist::nextSong()
 
 void Sound::load()
 {
+	AudioEngine::getInstance().loadSound(soundFilePath);
 }
 
 bool Sound::isLoaded() const
 {
-	return true;
+	return AudioEngine::getInstance().isSoundLoaded(soundFilePath);
 }
 
 void Sound::unload()
 {
+	AudioEngine::getInstance().unloadSound(soundFilePath);
 }
\ No newline at end of file
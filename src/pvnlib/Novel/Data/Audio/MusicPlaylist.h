@@ -28,9 +28,13 @@ public:
 	/// \todo check if the format is right
 	bool errorCheck(bool bComprehensive = false) const;
 
-	/// \todo QT random replace
+	/// Advances to the next Song, reshuffling the MusicPlaylist whenever it wraps around (if `bRandomizePlaylist` is set)
+	/// The AudioEngine calls it once the previous Song is decoded and the music queued ahead of the mixer runs low, so the next one is decoded just in time to follow it
 	const std::pair<QString, QString> nextSong();
 
+	/// Makes every following reshuffle deterministic, otherwise the shuffling is seeded once per session
+	static void setShuffleSeed(quint32 seed);
+
 	AudioSettings audioSettings;
 
 	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
@@ -6,7 +6,7 @@
 
 class ActionVisitorCorrectSounds;
 
-/// Holds data for QSoundEffect, to play some Sound
+/// Holds data for the AudioEngine, to play some Sound
 class Sound final
 {
 	friend ActionVisitorCorrectSounds;
@@ -25,13 +25,11 @@ public:
 	bool operator==(const Sound& obj) const noexcept = default;
 	bool operator!=(const Sound& obj) const noexcept = default;
 
-	/// \todo Setup audioSettings as well
-	/// \todo Connect with our new class
-	void load();// if (!qSoundEffect_) qSoundEffect_ = std::unique_ptr<QSoundEffect>(new QSoundEffect()); qSoundEffect_->setSource(soundFilePath);
-	/// \todo Connect with our new class
-	bool isLoaded() const;// return qSoundEffect_ != nullptr; }
-	/// \todo Connect with our new class
-	void unload();// qSoundEffect_.clear(); }
+	/// Starts decoding the Sound File in the background into the AudioEngine's cache, which is shared by all Sounds with the same `soundFilePath`
+	void load();
+	bool isLoaded() const;
+	/// Drops the decoded Sound File from the AudioEngine's cache
+	void unload();
 
 	/// \exception Error `soundFilePath` is invalid / Sound File's content cannot be read (whatever the reason)
 	/// \return Whether an Error has occurred
@@ -0,0 +1,108 @@
+#include "pvnLib/Novel/Data/JumpIndex.h"
+
+#include "pvnLib/Novel/Data/Scene.h"
+#include "pvnLib/Novel/Event/EventChoice.h"
+#include "pvnLib/Novel/Event/EventJump.h"
+
+void JumpIndex::indexScene(const Scene& scene)
+{
+	removeScene(scene.name);
+
+	std::vector<Jump> jumps;
+	for (const std::shared_ptr<Event>& event : *scene.getEvents())
+	{
+		switch (event->getComponentEventType())
+		{
+		case EventSubType::EVENT_JUMP:
+			if (const QString& jumpToSceneName = static_cast<const EventJump*>(event.get())->jumpToSceneName; !jumpToSceneName.isEmpty())
+				jumps.push_back(Jump{ scene.name, event.get(), -1, jumpToSceneName });
+			break;
+		case EventSubType::EVENT_CHOICE:
+		{
+			const std::vector<Choice>& choices = *static_cast<const EventChoice*>(event.get())->getChoices();
+			for (int i = 0; i != static_cast<int>(choices.size()); ++i)
+				if (!choices[i].jumpToSceneName.isEmpty())
+					jumps.push_back(Jump{ scene.name, event.get(), i, choices[i].jumpToSceneName });
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	for (const Jump& jump : jumps)
+		jumpsTo_[jump.targetSceneName].push_back(jump);
+	if (!jumps.empty())
+		jumpsFrom_[scene.name] = std::move(jumps);
+}
+
+void JumpIndex::removeScene(const QString& sceneName)
+{
+	auto it = jumpsFrom_.find(sceneName);
+	if (it == jumpsFrom_.end())
+		return;
+
+	for (const Jump& jump : it->second)
+	{
+		auto targetIt = jumpsTo_.find(jump.targetSceneName);
+		if (targetIt == jumpsTo_.end())
+			continue;
+		std::erase_if(targetIt->second, [&sceneName](const Jump& targetJump) { return targetJump.sourceSceneName == sceneName; });
+		if (targetIt->second.empty())
+			jumpsTo_.erase(targetIt);
+	}
+	jumpsFrom_.erase(it);
+}
+
+void JumpIndex::renameScene(const QString& oldName, const QString& newName)
+{
+	//Jumps out of the Scene
+	if (auto it = jumpsFrom_.find(oldName); it != jumpsFrom_.end())
+	{
+		std::vector<Jump> jumps = std::move(it->second);
+		jumpsFrom_.erase(it);
+		for (Jump& jump : jumps)
+		{
+			jump.sourceSceneName = newName;
+			for (Jump& targetJump : jumpsTo_[jump.targetSceneName])
+				if (targetJump.event == jump.event && targetJump.choiceIndex == jump.choiceIndex)
+					targetJump.sourceSceneName = newName;
+		}
+		jumpsFrom_[newName] = std::move(jumps);
+	}
+
+	//Jumps into the Scene, including the ones from the Scene itself, which are already moved above
+	if (auto it = jumpsTo_.find(oldName); it != jumpsTo_.end())
+	{
+		std::vector<Jump> jumps = std::move(it->second);
+		jumpsTo_.erase(it);
+		for (Jump& jump : jumps)
+		{
+			jump.targetSceneName = newName;
+			for (Jump& sourceJump : jumpsFrom_[jump.sourceSceneName])
+				if (sourceJump.event == jump.event && sourceJump.choiceIndex == jump.choiceIndex)
+					sourceJump.targetSceneName = newName;
+		}
+		jumpsTo_[newName] = std::move(jumps);
+	}
+}
+
+void JumpIndex::clear() noexcept
+{
+	jumpsFrom_.clear();
+	jumpsTo_.clear();
+}
+
+const std::vector<JumpIndex::Jump>& JumpIndex::getJumpsFrom(const QString& sceneName) const
+{
+	static const std::vector<Jump> noJumps;
+	auto it = jumpsFrom_.find(sceneName);
+	return it != jumpsFrom_.end() ? it->second : noJumps;
+}
+
+const std::vector<JumpIndex::Jump>& JumpIndex::getJumpsTo(const QString& sceneName) const
+{
+	static const std::vector<Jump> noJumps;
+	auto it = jumpsTo_.find(sceneName);
+	return it != jumpsTo_.end() ? it->second : noJumps;
+}
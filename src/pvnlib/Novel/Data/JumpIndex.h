@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QString>
+#include <unordered_map>
+#include <vector>
+
+class Event;
+class Scene;
+
+/// Jumps between the Scenes (EventJumps and Choices), indexed both by the Scene they start from and the Scene they lead to
+/// Lets the Novel retarget or clear the Jumps into a renamed or removed Scene without scanning every Event of every Scene
+class JumpIndex final
+{
+public:
+	struct Jump
+	{
+		QString sourceSceneName;
+		/// EventJump or EventChoice containing the Jump
+		Event*  event       = nullptr;
+		/// Index of the Choice in the EventChoice, -1 for an EventJump
+		int     choiceIndex = -1;
+		QString targetSceneName;
+	};
+
+	/// Replaces the Jumps out of the Scene with the ones its Events contain now
+	void indexScene(const Scene& scene);
+	/// Forgets the Jumps out of the Scene, the Jumps into it stay indexed as long as their Events point to it
+	void removeScene(const QString& sceneName);
+	/// Moves the Jumps out of and into `oldName` to `newName`, it changes only the JumpIndex, not the Events
+	void renameScene(const QString& oldName, const QString& newName);
+	void clear() noexcept;
+
+	const std::vector<Jump>& getJumpsFrom(const QString& sceneName) const;
+	const std::vector<Jump>& getJumpsTo(const QString& sceneName)   const;
+
+private:
+	std::unordered_map<QString, std::vector<Jump>> jumpsFrom_,
+												   jumpsTo_;
+};
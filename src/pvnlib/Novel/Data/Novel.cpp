@@ -1,7 +1,27 @@
 ﻿#include "pvnLib/Novel/Data/Novel.h"
 
 #include "pvnLib/Helpers.h"
+#include "pvnLib/Novel/Event/EventChoice.h"
+#include "pvnLib/Novel/Event/EventJump.h"
 #include <QDirIterator>
+#include <algorithm>
+
+template<typename T>
+void Novel::markAllDirty(DataKind kind, const std::unordered_map<QString, T>& entities, bool bRemoved)
+{
+	for (const std::pair<const QString, T>& entity : entities)
+		if (bRemoved)
+			markRemoved(kind, entity.first);
+		else
+			markDirty(kind, entity.first);
+}
+
+Novel::Novel()
+{
+	frameTimer_.setTimerType(Qt::PreciseTimer);
+	frameTimer_.setInterval(FRAME_INTERVAL);
+	connect(&frameTimer_, &QTimer::timeout, this, &Novel::update);
+}
 
 Novel& Novel::getInstance()
 {
@@ -36,10 +56,18 @@ SceneWidget* Novel::createSceneWidget()
 	sceneWidget_ = new SceneWidget(nullptr);
 	connect(this,         &Novel::pendSceneClear,            sceneWidget_, &SceneWidget::clearScene,            Qt::DirectConnection);
 	connect(this,         &Novel::pendBackgroundDisplay,     sceneWidget_, &SceneWidget::displayBackground);
+	connect(this,         &Novel::pendTiledBackgroundDisplay, sceneWidget_, &SceneWidget::displayTiledBackground);
+	connect(this,         &Novel::pendBackgroundCameraMove,   sceneWidget_, &SceneWidget::moveBackgroundCamera);
 	connect(this,         &Novel::pendSceneryObjectsDisplay, sceneWidget_, &SceneWidget::displaySceneryObjects);
 	connect(this,         &Novel::pendCharactersDisplay,     sceneWidget_, &SceneWidget::displayCharacters);
+	connect(this,         &Novel::pendSceneryTransformsUpdate, sceneWidget_, &SceneWidget::updateSceneryObjectTransforms);
+	connect(this,         &Novel::pendBackgroundTransition,  sceneWidget_, &SceneWidget::transitionBackground);
+	connect(this,         &Novel::pendSceneryObjectImageTransition, sceneWidget_, &SceneWidget::transitionSceneryObjectImage);
+	connect(this,         &Novel::pendTransitionsUpdate,     sceneWidget_, &SceneWidget::advanceTransitions);
+	connect(this,         &Novel::pendSceneryObjectFiltersUpdate, sceneWidget_, &SceneWidget::updateSceneryObjectFilters);
 	connect(this,         &Novel::pendEventChoiceDisplay,    sceneWidget_, &SceneWidget::displayEventChoice);
 	connect(this,         &Novel::pendEventDialogueDisplay,  sceneWidget_, &SceneWidget::displayEventDialogue);
+	connect(this,         &Novel::pendSpritesPack,           sceneWidget_, &SceneWidget::packSprites,           Qt::DirectConnection);
 	connect(sceneWidget_, &SceneWidget::pendNovelEnd,        this,         &Novel::end);
 	connect(sceneWidget_, &SceneWidget::pendChoiceRun,       this,         &Novel::choiceRun);
 
@@ -68,36 +96,56 @@ Chapter* Novel::getChapter(const QString& name)
 
 const std::unordered_map<QString, Chapter>* Novel::setChapters(const std::unordered_map<QString, Chapter>& chapters) noexcept
 {
-	return &(chapters_ = chapters);
+	markAllDirty(DataKind::Chapter, chapters_, true);
+	chapters_ = chapters;
+	markAllDirty(DataKind::Chapter, chapters_);
+	return &chapters_;
 }
 
 const std::unordered_map<QString, Chapter>* Novel::setChapters(std::unordered_map<QString, Chapter>&& chapters) noexcept
 {
-	return &(chapters_ = std::move(chapters));
+	markAllDirty(DataKind::Chapter, chapters_, true);
+	chapters_ = std::move(chapters);
+	markAllDirty(DataKind::Chapter, chapters_);
+	return &chapters_;
 }
 
 Chapter* Novel::setChapter(const Chapter& chapter) noexcept
 {
- 	return NovelLib::Helpers::mapSet(chapters_, chapter, "Chapter", NovelLib::ErrorType::ChapterInvalid);
+	Chapter* storedChapter = NovelLib::Helpers::mapSet(chapters_, chapter, "Chapter", NovelLib::ErrorType::ChapterInvalid);
+	markDirty(DataKind::Chapter, storedChapter->name);
+	return storedChapter;
 }
 
 Chapter* Novel::setChapter(Chapter&& chapter) noexcept
 {
-	return NovelLib::Helpers::mapSet(chapters_, std::move(chapter), "Chapter", NovelLib::ErrorType::ChapterInvalid);
+	Chapter* storedChapter = NovelLib::Helpers::mapSet(chapters_, std::move(chapter), "Chapter", NovelLib::ErrorType::ChapterInvalid);
+	markDirty(DataKind::Chapter, storedChapter->name);
+	return storedChapter;
 }
 
 Chapter* Novel::renameChapter(const QString& oldName, const QString& newName)
 {
-	return NovelLib::Helpers::mapRename(chapters_, oldName, newName, "Chapter", NovelLib::ErrorType::ChapterMissing, NovelLib::ErrorType::ChapterInvalid);
+	Chapter* renamedChapter = NovelLib::Helpers::mapRename(chapters_, oldName, newName, "Chapter", NovelLib::ErrorType::ChapterMissing, NovelLib::ErrorType::ChapterInvalid);
+	if (renamedChapter)
+	{
+		markRemoved(DataKind::Chapter, oldName);
+		markDirty(DataKind::Chapter, newName);
+	}
+	return renamedChapter;
 }
 
 bool Novel::removeChapter(const QString& name)
 {
-	return NovelLib::Helpers::mapRemove(chapters_, name, "Chapter", NovelLib::ErrorType::ChapterMissing);
+	if (!NovelLib::Helpers::mapRemove(chapters_, name, "Chapter", NovelLib::ErrorType::ChapterMissing))
+		return false;
+	markRemoved(DataKind::Chapter, name);
+	return true;
 }
 
 void Novel::clearChapters() noexcept
 {
+	markAllDirty(DataKind::Chapter, chapters_, true);
 	chapters_.clear();
 }
 
@@ -118,37 +166,56 @@ Character* Novel::getDefaultCharacter(const QString& name)
 
 const std::unordered_map<QString, Character>* Novel::setDefaultCharacters(const std::unordered_map<QString, Character>& characters) noexcept
 {
-	return &(characterDefaults_ = characters);
+	markAllDirty(DataKind::Character, characterDefaults_, true);
+	characterDefaults_ = characters;
+	markAllDirty(DataKind::Character, characterDefaults_);
+	return &characterDefaults_;
 }
 
 const std::unordered_map<QString, Character>* Novel::setDefaultCharacters(std::unordered_map<QString, Character>&& characters) noexcept
 {
-	return &(characterDefaults_ = std::move(characters));
+	markAllDirty(DataKind::Character, characterDefaults_, true);
+	characterDefaults_ = std::move(characters);
+	markAllDirty(DataKind::Character, characterDefaults_);
+	return &characterDefaults_;
 }
 
 Character* Novel::setDefaultCharacter(const Character& character) noexcept
 {
-	return NovelLib::Helpers::mapSet(characterDefaults_, character, "Character", NovelLib::ErrorType::CharacterInvalid);
+	Character* storedCharacter = NovelLib::Helpers::mapSet(characterDefaults_, character, "Character", NovelLib::ErrorType::CharacterInvalid);
+	markDirty(DataKind::Character, storedCharacter->name);
+	return storedCharacter;
 }
 
 Character* Novel::setDefaultCharacter(Character&& character) noexcept
 {
-
-	return NovelLib::Helpers::mapSet(characterDefaults_, std::move(character), "Character", NovelLib::ErrorType::CharacterInvalid);
+	Character* storedCharacter = NovelLib::Helpers::mapSet(characterDefaults_, std::move(character), "Character", NovelLib::ErrorType::CharacterInvalid);
+	markDirty(DataKind::Character, storedCharacter->name);
+	return storedCharacter;
 }
 
 Character* Novel::renameDefaultCharacter(const QString& oldName, const QString& newName)
 {
-	return NovelLib::Helpers::mapRename(characterDefaults_, oldName, newName, "Character", NovelLib::ErrorType::CharacterMissing, NovelLib::ErrorType::CharacterInvalid);
+	Character* renamedCharacter = NovelLib::Helpers::mapRename(characterDefaults_, oldName, newName, "Character", NovelLib::ErrorType::CharacterMissing, NovelLib::ErrorType::CharacterInvalid);
+	if (renamedCharacter)
+	{
+		markRemoved(DataKind::Character, oldName);
+		markDirty(DataKind::Character, newName);
+	}
+	return renamedCharacter;
 }
 
 bool Novel::removeDefaultCharacter(const QString& name)
 {
-	return NovelLib::Helpers::mapRemove(characterDefaults_, name, "Character", NovelLib::ErrorType::CharacterMissing);
+	if (!NovelLib::Helpers::mapRemove(characterDefaults_, name, "Character", NovelLib::ErrorType::CharacterMissing))
+		return false;
+	markRemoved(DataKind::Character, name);
+	return true;
 }
 
 void Novel::clearDefaultCharacters() noexcept
 {
+	markAllDirty(DataKind::Character, characterDefaults_, true);
 	characterDefaults_.clear();
 }
 
@@ -170,36 +237,56 @@ SceneryObject* Novel::getDefaultSceneryObject(const QString& name)
 
 const std::unordered_map<QString, SceneryObject>* Novel::setDefaultSceneryObjects(const std::unordered_map<QString, SceneryObject>& sceneryObjects) noexcept
 {
-	return &(sceneryObjectDefaults_ = sceneryObjects);
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_, true);
+	sceneryObjectDefaults_ = sceneryObjects;
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_);
+	return &sceneryObjectDefaults_;
 }
 
 const std::unordered_map<QString, SceneryObject>* Novel::setDefaultSceneryObjects(std::unordered_map<QString, SceneryObject>&& sceneryObjects) noexcept
 {
-	return &(sceneryObjectDefaults_ = std::move(sceneryObjects));
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_, true);
+	sceneryObjectDefaults_ = std::move(sceneryObjects);
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_);
+	return &sceneryObjectDefaults_;
 }
 
 SceneryObject* Novel::setDefaultSceneryObject(const SceneryObject& sceneryObject) noexcept
 {
-	return NovelLib::Helpers::mapSet(sceneryObjectDefaults_, sceneryObject, "SceneryObject", NovelLib::ErrorType::SceneryObjectInvalid);
+	SceneryObject* storedSceneryObject = NovelLib::Helpers::mapSet(sceneryObjectDefaults_, sceneryObject, "SceneryObject", NovelLib::ErrorType::SceneryObjectInvalid);
+	markDirty(DataKind::SceneryObject, storedSceneryObject->name);
+	return storedSceneryObject;
 }
 
 SceneryObject* Novel::setDefaultSceneryObject(SceneryObject&& sceneryObject) noexcept
 {
-	return NovelLib::Helpers::mapSet(sceneryObjectDefaults_, std::move(sceneryObject), "SceneryObject", NovelLib::ErrorType::SceneryObjectInvalid);
+	SceneryObject* storedSceneryObject = NovelLib::Helpers::mapSet(sceneryObjectDefaults_, std::move(sceneryObject), "SceneryObject", NovelLib::ErrorType::SceneryObjectInvalid);
+	markDirty(DataKind::SceneryObject, storedSceneryObject->name);
+	return storedSceneryObject;
 }
 
 SceneryObject* Novel::renameDefaultSceneryObject(const QString& oldName, const QString& newName)
 {
-	return NovelLib::Helpers::mapRename(sceneryObjectDefaults_, oldName, newName, "SceneryObject", NovelLib::ErrorType::SceneryObjectMissing, NovelLib::ErrorType::SceneryObjectInvalid);
+	SceneryObject* renamedSceneryObject = NovelLib::Helpers::mapRename(sceneryObjectDefaults_, oldName, newName, "SceneryObject", NovelLib::ErrorType::SceneryObjectMissing, NovelLib::ErrorType::SceneryObjectInvalid);
+	if (renamedSceneryObject)
+	{
+		markRemoved(DataKind::SceneryObject, oldName);
+		markDirty(DataKind::SceneryObject, newName);
+	}
+	return renamedSceneryObject;
 }
 
 bool Novel::removeDefaultSceneryObject(const QString& name)
 {
-	return NovelLib::Helpers::mapRemove(sceneryObjectDefaults_, name, "SceneryObject", NovelLib::ErrorType::SceneryObjectMissing);
+	if (!NovelLib::Helpers::mapRemove(sceneryObjectDefaults_, name, "SceneryObject", NovelLib::ErrorType::SceneryObjectMissing))
+		return false;
+	markRemoved(DataKind::SceneryObject, name);
+	return true;
 }
 
 void Novel::clearDefaultSceneryObject() noexcept
 {
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_, true);
 	sceneryObjectDefaults_.clear();
 }
 
@@ -220,32 +307,179 @@ Scene* Novel::getScene(const QString& name)
 
 const std::unordered_map<QString, Scene>* Novel::setScenes(std::unordered_map<QString, Scene>&& scenes) noexcept
 {
-	return &(scenes_ = std::move(scenes));
+	markAllDirty(DataKind::Scene, scenes_, true);
+	scenes_ = std::move(scenes);
+	markAllDirty(DataKind::Scene, scenes_);
+
+	jumpIndex_.clear();
+	for (const std::pair<const QString, Scene>& scene : scenes_)
+		jumpIndex_.indexScene(scene.second);
+	return &scenes_;
 }
 
 Scene* Novel::addScene(const Scene& scene) noexcept
 {
-	return NovelLib::Helpers::mapSet(scenes_, scene, "Scene", NovelLib::ErrorType::SceneInvalid);
+	Scene* addedScene = NovelLib::Helpers::mapSet(scenes_, scene, "Scene", NovelLib::ErrorType::SceneInvalid);
+	jumpIndex_.indexScene(*addedScene);
+	markDirty(DataKind::Scene, addedScene->name);
+	return addedScene;
 }
 
 Scene* Novel::addScene(Scene&& scene) noexcept
 {
-	return NovelLib::Helpers::mapSet(scenes_, std::move(scene), "Scene", NovelLib::ErrorType::SceneInvalid);
+	Scene* addedScene = NovelLib::Helpers::mapSet(scenes_, std::move(scene), "Scene", NovelLib::ErrorType::SceneInvalid);
+	jumpIndex_.indexScene(*addedScene);
+	markDirty(DataKind::Scene, addedScene->name);
+	return addedScene;
 }
 
 Scene* Novel::renameScene(const QString& oldName, const QString& newName)
 {
-	return NovelLib::Helpers::mapRename(scenes_, oldName, newName, "Scene", NovelLib::ErrorType::SceneMissing, NovelLib::ErrorType::SceneInvalid);
+	Scene* renamedScene = NovelLib::Helpers::mapRename(scenes_, oldName, newName, "Scene", NovelLib::ErrorType::SceneMissing, NovelLib::ErrorType::SceneInvalid);
+	if (!renamedScene)
+		return nullptr;
+	markRemoved(DataKind::Scene, oldName);
+	markDirty(DataKind::Scene, newName);
+
+	//Retarget the Jumps into the Scene, so they don't point to a Scene that doesn't exist anymore
+	for (const JumpIndex::Jump& jump : jumpIndex_.getJumpsTo(oldName))
+	{
+		if (jump.choiceIndex == -1)
+			static_cast<EventJump*>(jump.event)->jumpToSceneName = newName;
+		else
+			static_cast<EventChoice*>(jump.event)->getChoice(jump.choiceIndex)->jumpToSceneName = newName;
+		if (jump.sourceSceneName != oldName)
+			markDirty(DataKind::Scene, jump.sourceSceneName);
+	}
+	jumpIndex_.renameScene(oldName, newName);
+
+	return renamedScene;
 }
 
 bool Novel::removeScene(const QString& name)
 {
-	return NovelLib::Helpers::mapRemove(scenes_, name, "Scene", NovelLib::ErrorType::SceneMissing);
+	if (!NovelLib::Helpers::mapRemove(scenes_, name, "Scene", NovelLib::ErrorType::SceneMissing))
+		return false;
+	markRemoved(DataKind::Scene, name);
+
+	jumpIndex_.removeScene(name);
+
+	//Clear the Jumps into the removed Scene, the indexed ones are copied, because reindexing their Scenes changes the JumpIndex
+	const std::vector<JumpIndex::Jump> jumpsTo = jumpIndex_.getJumpsTo(name);
+	for (const JumpIndex::Jump& jump : jumpsTo)
+	{
+		if (jump.choiceIndex == -1)
+			static_cast<EventJump*>(jump.event)->jumpToSceneName = "";
+		else
+			static_cast<EventChoice*>(jump.event)->getChoice(jump.choiceIndex)->jumpToSceneName = "";
+	}
+	for (const JumpIndex::Jump& jump : jumpsTo)
+		if (auto it = scenes_.find(jump.sourceSceneName); it != scenes_.end())
+		{
+			jumpIndex_.indexScene(it->second);
+			markDirty(DataKind::Scene, jump.sourceSceneName);
+		}
+
+	return true;
 }
 
 void Novel::clearScenes() noexcept
 {
+	markAllDirty(DataKind::Scene, scenes_, true);
 	scenes_.clear();
+	jumpIndex_.clear();
+}
+
+const JumpIndex& Novel::getJumpIndex() const noexcept
+{
+	return jumpIndex_;
+}
+
+const SearchIndex& Novel::getSearchIndex()
+{
+	searchIndex_.updateStaleScenes(scenes_);
+	return searchIndex_;
+}
+
+void Novel::sceneChanged(const Scene& scene)
+{
+	auto it = scenes_.find(scene.name);
+	if (it == scenes_.end() || &it->second != &scene)
+		return;
+
+	jumpIndex_.indexScene(scene);
+	markDirty(DataKind::Scene, scene.name);
+}
+
+void Novel::markDirty(DataKind kind, const QString& name)
+{
+	DirtyData& dirtyData = dirtyData_[kind];
+	dirtyData.removed.erase(name);
+	dirtyData.changed.insert(name);
+	//Every change of a Scene passes through here, so it is enough to keep the SearchIndex up to date
+	if (kind == DataKind::Scene)
+		searchIndex_.markSceneStale(name);
+}
+
+void Novel::markDirty(const SceneryObject& sceneryObject)
+{
+	if (auto it = sceneryObjectDefaults_.find(sceneryObject.name); it != sceneryObjectDefaults_.end() && &it->second == &sceneryObject)
+	{
+		markDirty(DataKind::SceneryObject, sceneryObject.name);
+		return;
+	}
+	if (auto it = characterDefaults_.find(sceneryObject.name); it != characterDefaults_.end() && &it->second == &sceneryObject)
+	{
+		markDirty(DataKind::Character, sceneryObject.name);
+		return;
+	}
+
+	//Otherwise it's displayed in a Scenery, which is saved with its Scene
+	auto isDisplayedIn = [&sceneryObject](const Scenery& scenery)
+	{
+		for (const SceneryObject& displayedSceneryObject : *scenery.getDisplayedSceneryObjects())
+			if (&displayedSceneryObject == &sceneryObject)
+				return true;
+		for (const Character& displayedCharacter : *scenery.getDisplayedCharacters())
+			if (&displayedCharacter == &sceneryObject)
+				return true;
+		return false;
+	};
+	for (const std::pair<const QString, Scene>& scene : scenes_)
+	{
+		const std::vector<std::shared_ptr<Event>>& events = *scene.second.getEvents();
+		if (isDisplayedIn(scene.second.scenery) || std::any_of(events.cbegin(), events.cend(), [&isDisplayedIn](const std::shared_ptr<Event>& event) { return isDisplayedIn(event->scenery); }))
+		{
+			markDirty(DataKind::Scene, scene.first);
+			return;
+		}
+	}
+}
+
+void Novel::markRemoved(DataKind kind, const QString& name)
+{
+	DirtyData& dirtyData = dirtyData_[kind];
+	dirtyData.changed.erase(name);
+	dirtyData.removed.insert(name);
+	if (kind == DataKind::Scene)
+		searchIndex_.removeScene(name);
+}
+
+void Novel::markAllDataDirty()
+{
+	markAllDirty(DataKind::Chapter,       chapters_);
+	markAllDirty(DataKind::Character,     characterDefaults_);
+	markAllDirty(DataKind::SceneryObject, sceneryObjectDefaults_);
+	markAllDirty(DataKind::Scene,         scenes_);
+	markAllDirty(DataKind::Voice,         voices_);
+}
+
+bool Novel::hasDirtyData() const noexcept
+{
+	for (const std::pair<const DataKind, DirtyData>& dirtyData : dirtyData_)
+		if (!dirtyData.second.changed.empty() || !dirtyData.second.removed.empty())
+			return true;
+	return false;
 }
 
 const std::unordered_map<QString, Voice>* Novel::getVoices() const noexcept
@@ -265,36 +499,56 @@ Voice* Novel::getVoice(const QString& name)
 
 const std::unordered_map<QString, Voice>* Novel::setVoices(const std::unordered_map<QString, Voice>& voices) noexcept
 {
-	return &(voices_ = voices);
+	markAllDirty(DataKind::Voice, voices_, true);
+	voices_ = voices;
+	markAllDirty(DataKind::Voice, voices_);
+	return &voices_;
 }
 
 const std::unordered_map<QString, Voice>* Novel::setVoices(std::unordered_map<QString, Voice>&& voices) noexcept
 {
-	return &(voices_ = std::move(voices));
+	markAllDirty(DataKind::Voice, voices_, true);
+	voices_ = std::move(voices);
+	markAllDirty(DataKind::Voice, voices_);
+	return &voices_;
 }
 
 Voice* Novel::setVoice(const Voice& voice) noexcept
 {
-	return NovelLib::Helpers::mapSet(voices_, voice, "Voice", NovelLib::ErrorType::VoiceInvalid);
+	Voice* storedVoice = NovelLib::Helpers::mapSet(voices_, voice, "Voice", NovelLib::ErrorType::VoiceInvalid);
+	markDirty(DataKind::Voice, storedVoice->name);
+	return storedVoice;
 }
 
 Voice* Novel::setVoice(Voice&& voice) noexcept
 {
-	return NovelLib::Helpers::mapSet(voices_, std::move(voice), "Voice", NovelLib::ErrorType::VoiceInvalid);
+	Voice* storedVoice = NovelLib::Helpers::mapSet(voices_, std::move(voice), "Voice", NovelLib::ErrorType::VoiceInvalid);
+	markDirty(DataKind::Voice, storedVoice->name);
+	return storedVoice;
 }
 
 Voice* Novel::renameVoice(const QString& oldName, const QString& newName)
 {
-	return NovelLib::Helpers::mapRename(voices_, oldName, newName, "Voice", NovelLib::ErrorType::VoiceMissing, NovelLib::ErrorType::VoiceInvalid);
+	Voice* renamedVoice = NovelLib::Helpers::mapRename(voices_, oldName, newName, "Voice", NovelLib::ErrorType::VoiceMissing, NovelLib::ErrorType::VoiceInvalid);
+	if (renamedVoice)
+	{
+		markRemoved(DataKind::Voice, oldName);
+		markDirty(DataKind::Voice, newName);
+	}
+	return renamedVoice;
 }
 
 bool Novel::removeVoice(const QString& name)
 {
-	return NovelLib::Helpers::mapRemove(voices_, name, "Voice", NovelLib::ErrorType::VoiceMissing);
+	if (!NovelLib::Helpers::mapRemove(voices_, name, "Voice", NovelLib::ErrorType::VoiceMissing))
+		return false;
+	markRemoved(DataKind::Voice, name);
+	return true;
 }
 
 void Novel::clearVoices() noexcept
 {
+	markAllDirty(DataKind::Voice, voices_, true);
 	voices_.clear();
 }
 
@@ -306,6 +560,7 @@ void Novel::clearNovel() noexcept
 	stateAtSceneBeginning_ = NovelState();
 	state_                 = NovelState();
 	novelStartElapsedTimer_.restart();
+	frameTimer_.stop();
 	sceneWidget_           = nullptr;
 
 	clearChapters();
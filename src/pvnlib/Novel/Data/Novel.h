@@ -1,8 +1,12 @@
 ﻿#pragma once
 
 #include <QElapsedTimer>
+#include <QTimer>
+#include <unordered_set>
 
+#include "pvnLib/Novel/Data/JumpIndex.h"
 #include "pvnLib/Novel/Data/NovelSettings.h"
+#include "pvnLib/Novel/Data/SearchIndex.h"
 #include "pvnLib/Novel/Data/Save/NovelState.h"
 #include "pvnLib/Novel/Data/Scene.h"
 #include "pvnLib/Novel/Data/Text/Choice.h"
@@ -37,7 +41,33 @@ public:
 	/// 6 - loading Scenes
 	void loadNovel(uint slot, bool createNew);
 
-	void saveNovel(uint slot);
+	/// Writes the NovelState and the data changed since it was last written (see `saveDirty()`)
+	/// \param bFullWrite Writes all the data instead (e.g. into a new slot), not needed for the changes, as they all mark what they change
+	void saveNovel(uint slot, bool bFullWrite = false);
+
+	/// Kinds of the Novel's data, each entity of a kind is written into its own file
+	enum class DataKind
+	{
+		Chapter,
+		Character,
+		SceneryObject,
+		Scene,
+		Voice
+	};
+
+	/// Marks the entity to be written by the next `saveDirty()`
+	/// The Novel's setters, renamers and removers, as well as the Scene's and EventChoice's mutators, mark the entities by themselves, this is for the changes made directly to the entities' members
+	void markDirty(DataKind kind, const QString& name);
+	/// Marks the default SceneryObject or Character, or the Scene displaying the SceneryObject, to be written by the next `saveDirty()`
+	void markDirty(const SceneryObject& sceneryObject);
+	/// Marks every entity of the Novel to be written by the next `saveDirty()`
+	void markAllDataDirty();
+	bool hasDirtyData() const noexcept;
+	/// Writes only the entities changed since they were last written and deletes the files of the removed ones
+	/// The entities are serialized right away, but written by a background thread, so it's cheap enough to autosave every few seconds
+	void saveDirty();
+	/// Waits for the files of the previous `saveDirty()` calls to be written
+	static void waitForDirtySaves();
 
 	/// Creates a new NovelState (resets the old one, if exists) and loads it into the SaveSlot
 	void newState(uint slot);
@@ -110,6 +140,15 @@ public:
 	bool removeScene(const QString& name);
 	void clearScenes() noexcept;
 
+	/// Jumps between the Scenes, kept up to date by the Scene and Event mutators, so the Jumps into a Scene can be found without scanning the whole Novel
+	const JumpIndex& getJumpIndex() const noexcept;
+	/// Updates the JumpIndex and marks the Scene dirty after its Events or their Jumps have changed
+	/// Does nothing if the Scene is not owned by the Novel (e.g. it's being loaded or copied)
+	void sceneChanged(const Scene& scene);
+	/// Words and references of every Scene, for searching the whole Novel
+	/// Scenes are only marked stale when they change, the ones changed since the last call are reindexed here
+	const SearchIndex& getSearchIndex();
+
 	const std::unordered_map<QString, Voice>* getVoices() const noexcept;
 	/// \exception Error Could not find a Voice with this name
 	const Voice* getVoice(const QString& name) const;
@@ -133,13 +172,18 @@ public:
 	SceneWidget* getSceneWidget();
 
 	const NovelState* getStateAtSceneBeginning() noexcept;
+
+	/// Whether the game clock is running, if not (e.g. in the Editor's preview), nothing will advance the Transitions
+	bool isClockRunning() const noexcept;
 	
 	QString novelTitle   = "Пан Тадеуш: реальная история";
 
 	QString defaultScene = "start";
 
 public slots:
+	/// Starts the game clock as well, which calls `update()` every frame
 	void run()    override;
+	/// Advances the Animators and Transitions to the game clock's time and lets the SceneWidget display them
 	void update() override;
 	void choiceRun(uint choiceID);
 	//Not a slot, but closely related to these above, so we place it here for clarity
@@ -148,15 +192,23 @@ public:
 
 signals:
 	void pendBackgroundDisplay(const QImage* img);
+	void pendTiledBackgroundDisplay(const TiledImagePack* tiledImagePack);
+	void pendBackgroundCameraMove(const QPointF& cameraPos);
 	void pendSceneryObjectsDisplay(const std::vector<SceneryObject>& sceneryObjects);
 	void pendCharactersDisplay(const std::vector<Character>& characters);
+	void pendSceneryTransformsUpdate(const std::vector<SceneryObject>& sceneryObjects, const std::vector<Character>& characters);
+	void pendBackgroundTransition(const QImage* img, Transition::Type transitionType, uint transitionTime);
+	void pendSceneryObjectImageTransition(const QString& sceneryObjectName, const AssetImage* assetImage, Transition::Type transitionType, uint transitionTime);
+	void pendTransitionsUpdate(uint elapsedTime);
+	void pendSceneryObjectFiltersUpdate(const QString& sceneryObjectName, const std::vector<ImageFilter>& filters);
 	void pendEventDialogueDisplay(const std::vector<Sentence>& sentences, uint sentenceReadIndex);
 	void pendEventChoiceDisplay(const QString& menuText, const std::vector<Choice>& choices);
 	void pendSceneClear();
+	void pendSpritesPack(const std::vector<const AssetImage*>& sprites);
 
 private:
 	// Nothing can create the Novel, but its methods
-	Novel() = default;
+	Novel();
 
 	// It is supposed to be empty
 	void ensureResourcesAreLoaded() override;
@@ -167,25 +219,26 @@ private:
 	// Doesn't hold any Resources, so there is no distinguishment between Definition and Resource
 	/// \todo implement this
 	void loadChapters();
-	void saveChapters();
 
 	void loadDefaultCharacterDefinitions();
-	void saveDefaultCharacterDefinitions();
 
 	void loadDefaultSceneryObjectsDefinitions();
-	void saveDefaultSceneryObjectsDefinitions();
 
 	void loadNovelEssentials();
 	void saveNovelEssentials();
 
 	/// \todo implement this
 	void loadScenes();
-	void saveScenes();
 
 	// Doesn't hold any Resources, so there is no distinguishment between Definition and Resource
 	/// \todo implement this
 	void loadVoices();
-	void saveVoices();
+
+	/// Marks the file of the entity to be deleted by the next `saveDirty()`
+	void markRemoved(DataKind kind, const QString& name);
+	/// Marks every entity (`bRemoved` - its file) of the container, used when a whole container is replaced or cleared
+	template<typename T>
+	void markAllDirty(DataKind kind, const std::unordered_map<QString, T>& entities, bool bRemoved = false);
 
 	std::unordered_map<QString, Chapter>       chapters_;
 	std::unordered_map<QString, Character>     characterDefaults_;
@@ -193,6 +246,18 @@ private:
 	std::unordered_map<QString, Scene>         scenes_;
 	std::unordered_map<QString, Voice>         voices_;
 
+	JumpIndex jumpIndex_;
+	SearchIndex searchIndex_;
+
+	struct DirtyData
+	{
+		/// Names of the entities to be (re)written
+		std::unordered_set<QString> changed;
+		/// Names of the entities whose files are to be deleted
+		std::unordered_set<QString> removed;
+	};
+	std::unordered_map<DataKind, DirtyData> dirtyData_;
+
 	/// This one refers to the beginning of the current Scene, as the Novel will always be saved at this point if the User chooses to save
 	/// It is preferred to replay the last Scene, so the User does not lose the context of the Novel upon loading, as this contains Media changes that will not be journalized anywhere else
 	NovelState stateAtSceneBeginning_;
@@ -203,6 +268,11 @@ private:
 	/// Calculates time since the Save was loaded
 	QElapsedTimer novelStartElapsedTimer_;
 
+	/// Game clock, calls `update()` every frame once the Novel is run
+	QTimer frameTimer_;
+	/// In milliseconds, a bit more than 60 frames per second
+	static constexpr int FRAME_INTERVAL = 16;
+
 	/// Renders the Scene (its Scenery)
 	SceneWidget* sceneWidget_ = nullptr;
 };
\ No newline at end of file
@@ -1,6 +1,55 @@
 ﻿#include "pvnLib/Novel/Data/Novel.h"
 
 #include <QDirIterator>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QThreadPool>
+
+namespace
+{
+	/// A single thread, so the files are written in the order they were saved
+	/// Its destructor waits for the pending writes, so quitting the application does not drop them
+	QThreadPool& getDataSaveThreadPool()
+	{
+		static QThreadPool dataSaveThreadPool;
+		dataSaveThreadPool.setMaxThreadCount(1);
+		return dataSaveThreadPool;
+	}
+
+	struct DataFileWrite
+	{
+		QString    path;
+		/// Serialized entity, ignored if the file is to be deleted
+		QByteArray data;
+		bool       bRemove = false;
+	};
+
+	/// Serializes the changed entities and clears the dirty sets
+	/// The entities keep changing as the user edits them, so they are serialized on the calling thread, only the writing happens in the background
+	template<typename T>
+	void snapshotDirtyEntities(const std::unordered_map<QString, T>& entities, std::unordered_set<QString>& changed, std::unordered_set<QString>& removed, const QString& directoryPath, std::vector<DataFileWrite>& writes)
+	{
+		for (const QString& name : removed)
+			writes.push_back(DataFileWrite{ directoryPath + name, QByteArray(), true });
+
+		for (const QString& name : changed)
+		{
+			auto entity = entities.find(name);
+			if (entity == entities.cend())
+				continue;
+
+			QByteArray data;
+			{
+				QDataStream dataStream(&data, QIODeviceBase::WriteOnly);
+				dataStream << entity->second;
+			}
+			writes.push_back(DataFileWrite{ directoryPath + name, std::move(data) });
+		}
+
+		changed.clear();
+		removed.clear();
+	}
+}
 
 void NovelSettings::load()
 {
@@ -9,6 +58,9 @@ void NovelSettings::load()
 
 void Novel::loadNovel(uint slot, bool createNew)
 {
+	//The files might still be in the writing
+	waitForDirtySaves();
+
 	//loadNovelEssentials();
 	//NovelSettings::load();
 	/*loadChapters();*/ if (createNew || !loadState(slot)) newState(slot);
@@ -16,9 +68,12 @@ void Novel::loadNovel(uint slot, bool createNew)
 	//loadVoices();
 	loadDefaultSceneryObjectsDefinitions(); loadDefaultCharacterDefinitions();
 	loadScenes();
+
+	//What was just loaded is already in the files
+	dirtyData_.clear();
 }
 
-void Novel::saveNovel(uint slot)
+void Novel::saveNovel(uint slot, bool bFullWrite)
 {
 	// NOTE - todo remove NOTE when done
 	// Loads the entire Novel from multiple files in a stage-based fashion to ensure the objects can setup pointers to the data from previous stage:
@@ -29,13 +84,11 @@ void Novel::saveNovel(uint slot)
 	// 5 - loading SceneryObjects and Characters Definitions
 	// 6 - loading Scenes
 
-	saveScenes();
-	saveDefaultSceneryObjectsDefinitions();
-	saveDefaultCharacterDefinitions();
-	saveVoices();
+	if (bFullWrite)
+		markAllDataDirty();
+	saveDirty();
 	//saveAssetsDefinitions();
 
-	saveChapters();
 	saveState();
 
 	saveNovelEssentials();
@@ -80,22 +133,6 @@ void Novel::loadChapters()
 	}
 }
 
-void Novel::saveChapters()
-{
-	QDir chaptersDir = QDir::currentPath();
-	chaptersDir.mkpath("game\\Chapters");
-
-	for (const std::pair<const QString, Chapter>& defaultChapterPair : chapters_)
-	{
-		const Chapter& defaultChapter = defaultChapterPair.second;
-		QFile serializedFile(chaptersDir.path() + "\\game\\Chapters\\" + defaultChapter.name);
-		serializedFile.open(QIODeviceBase::WriteOnly);
-
-		QDataStream dataStream(&serializedFile);
-		dataStream << defaultChapter;
-	}
-}
-
 void Novel::loadDefaultCharacterDefinitions()
 {
 	QDirIterator it("game\\Characters", QStringList(), QDir::Files, QDirIterator::Subdirectories);
@@ -111,22 +148,6 @@ void Novel::loadDefaultCharacterDefinitions()
 	}
 }
 
-void Novel::saveDefaultCharacterDefinitions()
-{
-	QDir charactersDir = QDir::currentPath();
-	charactersDir.mkpath("game\\Characters");
-
-	for (const std::pair<QString, Character>& defaultCharacterPair : characterDefaults_)
-	{
-		const SceneryObject& defaultCharacter = defaultCharacterPair.second;
-		QFile serializedFile(charactersDir.path() + "\\game\\Characters\\" + defaultCharacter.name);
-		serializedFile.open(QIODeviceBase::WriteOnly);
-
-		QDataStream dataStream(&serializedFile);
-		dataStream << defaultCharacter;
-	}
-}
-
 void Novel::loadDefaultSceneryObjectsDefinitions()
 {
 	QDirIterator it("game\\Objects", QStringList(), QDir::Files, QDirIterator::Subdirectories);
@@ -142,22 +163,6 @@ void Novel::loadDefaultSceneryObjectsDefinitions()
 	}
 }
 
-void Novel::saveDefaultSceneryObjectsDefinitions()
-{
-	QDir objectDir = QDir::currentPath();
-	objectDir.mkpath("game\\Objects");
-
-	for (const std::pair<QString, SceneryObject>& defaultSceneryObjectPair : sceneryObjectDefaults_)
-	{
-		const SceneryObject& defaultSceneryObject = defaultSceneryObjectPair.second;
-		QFile serializedFile(objectDir.path() +  "\\game\\Objects\\" + defaultSceneryObject.name);
-		serializedFile.open(QIODeviceBase::WriteOnly);
-
-		QDataStream dataStream(&serializedFile);
-		dataStream << defaultSceneryObject;
-	}
-}
-
 void Novel::loadNovelEssentials()
 {
 	QString novelTitle = "Пан Тадеуш: реальная история";
@@ -191,22 +196,6 @@ void Novel::loadScenes()
 	}
 }
 
-void Novel::saveScenes()
-{
-	QDir scenesDir = QDir::currentPath();
-	scenesDir.mkpath("game\\Scenes");
-
-	for (const std::pair<const QString, Scene>& scenePair : scenes_)
-	{
-		const Scene& scene = scenePair.second;
-		QFile serializedFile(scenesDir.path() + "\\game\\Scenes\\" + scene.name);
-		serializedFile.open(QIODeviceBase::WriteOnly);
-
-		QDataStream dataStream(&serializedFile);
-		dataStream << scene;
-	}
-}
-
 void Novel::loadVoices()
 {
 	QDirIterator it("game\\Voices", QStringList(), QDir::Files, QDirIterator::Subdirectories);
@@ -222,20 +211,47 @@ void Novel::loadVoices()
 	}
 }
 
-void Novel::saveVoices()
+void Novel::saveDirty()
 {
-	QDir voicesDir = QDir::currentPath();
-	voicesDir.mkpath("game\\Voices");
+	const QString gamePath = QDir::currentPath() + "\\game\\";
+
+	std::vector<DataFileWrite> writes;
+	snapshotDirtyEntities(chapters_,              dirtyData_[DataKind::Chapter].changed,       dirtyData_[DataKind::Chapter].removed,       gamePath + "Chapters\\",    writes);
+	snapshotDirtyEntities(characterDefaults_,     dirtyData_[DataKind::Character].changed,     dirtyData_[DataKind::Character].removed,     gamePath + "Characters\\",  writes);
+	snapshotDirtyEntities(sceneryObjectDefaults_, dirtyData_[DataKind::SceneryObject].changed, dirtyData_[DataKind::SceneryObject].removed, gamePath + "Objects\\",     writes);
+	snapshotDirtyEntities(scenes_,                dirtyData_[DataKind::Scene].changed,         dirtyData_[DataKind::Scene].removed,         gamePath + "Scenes\\",      writes);
+	snapshotDirtyEntities(voices_,                dirtyData_[DataKind::Voice].changed,         dirtyData_[DataKind::Voice].removed,         gamePath + "Voices\\",      writes);
+	if (writes.empty())
+		return;
 
-	for (const std::pair<const QString, Voice>& voicePair : voices_)
+	getDataSaveThreadPool().start([writes = std::move(writes)]
 	{
-		const Voice& voice = voicePair.second;
-		QFile serializedFile(voicesDir.path() + "\\game\\Voices\\" + voice.name);
-		serializedFile.open(QIODeviceBase::WriteOnly);
+		for (const DataFileWrite& write : writes)
+		{
+			if (write.bRemove)
+			{
+				QFile::remove(write.path);
+				continue;
+			}
+
+			QDir().mkpath(QFileInfo(write.path).absolutePath());
+			//QSaveFile writes into a temporary file and renames it over the old one only in `commit()`, so an interrupted autosave does not corrupt the project
+			QSaveFile file(write.path);
+			if (!file.open(QIODeviceBase::WriteOnly))
+			{
+				qCritical() << NovelLib::ErrorType::General << "Could not open the file" << write.path << ':' << file.errorString();
+				continue;
+			}
+			file.write(write.data);
+			if (!file.commit())
+				qCritical() << NovelLib::ErrorType::General << "Could not write the file" << write.path << ", the previous one was kept:" << file.errorString();
+		}
+	});
+}
 
-		QDataStream dataStream(&serializedFile);
-		dataStream << voice;
-	}
+void Novel::waitForDirtySaves()
+{
+	getDataSaveThreadPool().waitForDone();
 }
 
 void Novel::newState(uint slot)
@@ -251,7 +267,8 @@ bool Novel::loadState(uint slot)
 
 void Novel::saveState()
 {
-	state_.save();
+	//Only the readback happens here, the frame is downscaled and encoded by the saving thread
+	state_.save(sceneWidget_ ? sceneWidget_->grabFrame() : QImage());
 }
 
 void Scene::ensureResourcesAreLoaded()
@@ -266,4 +283,14 @@ void Scene::ensureResourcesAreLoaded()
 	}
 
 	events_[eventID]->ensureResourcesAreLoaded();
+}
+
+std::vector<const AssetImage*> Scene::collectSpriteAssetImages()
+{
+	std::vector<const AssetImage*> sprites;
+	scenery.appendSpriteAssetImages(sprites);
+	for (std::shared_ptr<Event>& event : events_)
+		event->scenery.appendSpriteAssetImages(sprites);
+
+	return sprites;
 }
\ No newline at end of file
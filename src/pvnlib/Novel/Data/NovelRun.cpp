@@ -4,12 +4,34 @@
 
 void Novel::run()
 {
-	getScene(state_.sceneName)->run();
+	Scene* scene = getScene(state_.sceneName);
+	//Packing sprites of the whole Scene at once spares GPU uploads and texture switches at every Event
+	if (sceneWidget_)
+		emit pendSpritesPack(scene->collectSpriteAssetImages());
+	scene->run();
+
+	if (!frameTimer_.isActive())
+		frameTimer_.start();
 }
 
 void Novel::update()
 {
+	//Every Animator and Transition is timed by the same clock, so they stay in sync with each other
+	const uint elapsedTime = static_cast<uint>(novelStartElapsedTimer_.elapsed());
+	state_.update(elapsedTime);
 	getScene(state_.sceneName)->update();
+
+	//Only transformations are updated, the SceneryObjectWidgets are not rebuilt
+	if (sceneWidget_)
+	{
+		emit pendSceneryTransformsUpdate(*state_.scenery.getDisplayedSceneryObjects(), *state_.scenery.getDisplayedCharacters());
+		emit pendTransitionsUpdate(elapsedTime);
+	}
+}
+
+bool Novel::isClockRunning() const noexcept
+{
+	return frameTimer_.isActive();
 }
 
 void Novel::choiceRun(uint choiceID)
@@ -34,6 +34,7 @@ void NovelSettings::defaultLanguageChange(const QString& newDefaultLanguage)
     const QString oldDefaultLanguage = defaultLanguage;
     defaultLanguage = newDefaultLanguage;
     for (std::pair<const QString, Scene>& scene : Novel::getInstance().scenes_)
+    {
         for (std::shared_ptr<Event>& event : scene.second.events_)
         {
             EventDialogue* eventDialog = dynamic_cast<EventDialogue*>(event.get());
@@ -41,4 +42,6 @@ void NovelSettings::defaultLanguageChange(const QString& newDefaultLanguage)
                 for (Sentence& sentence : eventDialog->sentences_)
                     sentence.translation.defaultLanguageChangeFix(oldDefaultLanguage);
         }
+        Novel::getInstance().markDirty(Novel::DataKind::Scene, scene.first);
+    }
 }
\ No newline at end of file
@@ -63,7 +63,41 @@ NovelState::NovelState(const QDate& saveDate, const QImage& screenshot, uint sav
 
 void NovelState::serializableLoad(QDataStream& dataStream)
 {
-    dataStream >> saveDate >> screenshot >> scenery >> saveSlot >> sceneName >> eventID >> sentenceID;
+    serializableLoad(dataStream, SAVE_FORMAT_VERSION);
+}
+
+void NovelState::serializableLoad(QDataStream& dataStream, quint32 formatVersion)
+{
+    dataStream >> saveDate;
+    if (formatVersion >= 2)
+    {
+        QByteArray encodedScreenshot;
+        dataStream >> encodedScreenshot;
+        screenshot = QImage::fromData(encodedScreenshot, "JPG");
+    }
+    else
+        dataStream >> screenshot;
+
+    if (formatVersion < 3)
+    {
+        serializableLoadProgress(dataStream);
+        return;
+    }
+    QByteArray progress;
+    dataStream >> progress;
+    progress = qUncompress(progress);
+    if (progress.isEmpty())
+    {
+        qCritical() << NovelLib::ErrorType::SaveCritical << "The Save in the slot" << saveSlot << "is corrupted and could not be decompressed";
+        return;
+    }
+    QDataStream progressStream(progress);
+    serializableLoadProgress(progressStream);
+}
+
+void NovelState::serializableLoadProgress(QDataStream& dataStream)
+{
+    dataStream >> scenery >> saveSlot >> sceneName >> eventID >> sentenceID;
 
     uint statsSize = 0;
     dataStream >> statsSize;
@@ -99,7 +133,17 @@ void NovelState::serializableLoad(QDataStream& dataStream)
 
 void NovelState::serializableSave(QDataStream& dataStream) const
 {
-    dataStream << saveDate << screenshot << scenery << saveSlot << sceneName << eventID << sentenceID << static_cast<uint>(stats_.size());
+    QByteArray progress;
+    {
+        QDataStream progressStream(&progress, QIODeviceBase::WriteOnly);
+        serializableSaveProgress(progressStream);
+    }
+    dataStream << saveDate << encodeScreenshot(screenshot) << qCompress(progress);
+}
+
+void NovelState::serializableSaveProgress(QDataStream& dataStream) const
+{
+    dataStream << scenery << saveSlot << sceneName << eventID << sentenceID << static_cast<uint>(stats_.size());
 
     for (const std::pair<const QString, std::shared_ptr<Stat>>& stat : stats_)
         dataStream << *(stat.second.get());
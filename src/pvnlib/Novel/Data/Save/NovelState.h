@@ -2,6 +2,7 @@
 
 #include <QDate>
 #include <QImage>
+#include <QSize>
 #include <qhashfunctions.h>
 #include <unordered_map>
 
@@ -30,9 +31,20 @@ public:
     bool operator!=(const NovelState& obj) const noexcept = default;
 
     static NovelState* getCurrentlyLoadedState();
+    /// Waits for the pending `save()` of this slot, so the newest Save is loaded
     static NovelState load(uint saveSlot);
     static NovelState reset(uint saveSlot);
-    void save();
+    /// Snapshots the NovelState and returns, the snapshot is serialized, compressed and written by a background thread
+    /// The file is replaced atomically (written to a temporary file and then renamed), so a crash in the middle of saving leaves the previous Save intact
+    /// Saves are written in the order they were requested, so the newest one always wins
+    /// \param frame Full-size frame grabbed from the SceneWidget (`SceneWidget::grabFrame()`), it's downscaled and encoded by the background thread and replaces the `screenshot`; if null, the `screenshot` is saved
+    void save(const QImage& frame = QImage()) const;
+    /// Blocks until all the pending Saves are written
+    static void waitForSaves();
+
+    /// Directory that contains all the Saves and their SaveSlotIndex
+    static QString getSaveDirectoryPath();
+    static QString getSaveFilePath(uint saveSlot);
 
     /// \exception Error 'screenshot`/`scenery` is invalid
     /// \return Whether an Error has occurred
@@ -56,7 +68,9 @@ public:
 
     QDate saveDate    = QDate::currentDate();
 
+    /// Stored downscaled to fit `SCREENSHOT_SIZE` and encoded as a JPEG
     QImage screenshot;
+    static constexpr QSize SCREENSHOT_SIZE = QSize(480, 270);
 
     //[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
     /// Current Media
@@ -77,6 +91,25 @@ public:
     uint sentenceID   = 0;
 
 private:
+    /// 0 - uncompressed, the `screenshot` stored as a QImage
+    /// 1 - compressed, the `screenshot` stored as a QImage
+    /// 2 - compressed, the `screenshot` stored as a JPEG
+    /// 3 - the `screenshot` stored as a JPEG, only the progress that follows it compressed, as the JPEG does not shrink any further
+    static constexpr quint32 SAVE_FORMAT_VERSION = 3;
+
+    /// \return `frame` scaled down to fit `SCREENSHOT_SIZE`
+    static QImage downscaleScreenshot(const QImage& frame);
+    static QByteArray encodeScreenshot(const QImage& screenshot);
+
+    /// Loads a Save written in an older format
+    void serializableLoad(QDataStream& dataStream, quint32 formatVersion);
+
+    /// Saves everything that follows the `screenshot` in `serializableSave()`, uncompressed
+    /// Split out, so the JPEG encoding of the screenshot and the compression can happen on the saving thread, while the rest is snapshotted on the GUI thread
+    void serializableSaveProgress(QDataStream& dataStream) const;
+    /// Loads what `serializableSaveProgress()` saved
+    void serializableLoadProgress(QDataStream& dataStream);
+
     /// Loads Stats definitions (meaning they will be reset to the default values) from a single file
     /// \todo implement this
     void loadStats();
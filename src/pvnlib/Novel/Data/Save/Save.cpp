@@ -1,9 +1,14 @@
+#include <QBuffer>
 #include <QDir>
 
 #include "pvnLib/Novel/Data/Novel.h"
+#include "pvnLib/Novel/Data/Save/SaveSlotIndex.h"
 
 #include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
 #include <QStandardPaths>
+#include <QThreadPool>
 
 bool NovelState::errorCheck(bool bComprehensive) const
 {
@@ -25,34 +30,150 @@ bool NovelState::errorCheck(bool bComprehensive) const
 }
 
 
+namespace
+{
+    /// Marks a compressed Save, older Saves are plain QDataStream dumps and start with the `saveDate` instead
+    constexpr quint32 SAVE_MAGIC = 0x50564E53; //"PVNS"
+
+    /// A single thread, so the Saves are written in the order they were requested
+    /// Its destructor waits for the pending Saves, so quitting the application does not drop them
+    QThreadPool& getSaveThreadPool()
+    {
+        static QThreadPool saveThreadPool;
+        saveThreadPool.setMaxThreadCount(1);
+        return saveThreadPool;
+    }
+}
+
+QString NovelState::getSaveDirectoryPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) + "/NAMSC";
+}
+
+QString NovelState::getSaveFilePath(uint saveSlot)
+{
+    return getSaveDirectoryPath() + '/' + QString::number(saveSlot) + ".sav";
+}
+
 NovelState NovelState::load(uint saveSlot)
 {
-    QFile save(QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) + "/NAMSC/" + QString::number(saveSlot) + ".sav");
-    save.open(QIODeviceBase::ReadOnly);
-    QDataStream dataStream(&save);
+    //A Save of this slot might still be in the writing
+    waitForSaves();
+
     NovelState novelState;
-    dataStream >> novelState;
+    QFile save(getSaveFilePath(saveSlot));
+    if (!save.open(QIODeviceBase::ReadOnly))
+        return novelState;
+
+    QByteArray data = save.readAll();
+    quint32 magic = 0, version = 0;
+    {
+        QDataStream headerStream(data);
+        headerStream >> magic >> version;
+    }
+    if (magic == SAVE_MAGIC)
+    {
+        if (version > SAVE_FORMAT_VERSION)
+        {
+            qCritical() << NovelLib::ErrorType::SaveCritical << "The Save in the slot" << saveSlot << "was made by a newer version (" << version << ')';
+            return novelState;
+        }
+        //Since the version 3 only the progress is compressed, which `serializableLoad()` takes care of
+        if (version >= 3)
+            data.remove(0, 2 * sizeof(quint32));
+        else
+            data = qUncompress(reinterpret_cast<const uchar*>(data.constData()) + 2 * sizeof(quint32), data.size() - 2 * sizeof(quint32));
+        if (data.isEmpty())
+        {
+            qCritical() << NovelLib::ErrorType::SaveCritical << "The Save in the slot" << saveSlot << "is corrupted and could not be decompressed";
+            return novelState;
+        }
+    }
+
+    QDataStream dataStream(data);
+    novelState.serializableLoad(dataStream, magic == SAVE_MAGIC ? version : 0);
     return novelState;
 }
 
 NovelState NovelState::reset(uint saveSlot)
 {
-    QFile save(QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) + "/NAMSC/" + QString::number(saveSlot) + ".sav");
-    QDataStream dataStream(&save);
     NovelState novelState;
     novelState.saveSlot = saveSlot;
     novelState.sceneName = Novel::getInstance().defaultScene;
     return novelState;
 }
 
-void NovelState::save()
+QImage NovelState::downscaleScreenshot(const QImage& frame)
+{
+    if (frame.width() <= SCREENSHOT_SIZE.width() && frame.height() <= SCREENSHOT_SIZE.height())
+        return frame;
+    return frame.scaled(SCREENSHOT_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+QByteArray NovelState::encodeScreenshot(const QImage& screenshot)
+{
+    //JPEG has no alpha, the frame is opaque anyway
+    QByteArray encoded;
+    QBuffer    buffer(&encoded);
+    buffer.open(QIODeviceBase::WriteOnly);
+    screenshot.convertToFormat(QImage::Format_RGB32).save(&buffer, "JPG", 85);
+    return encoded;
+}
+
+void NovelState::save(const QImage& frame) const
+{
+    //Snapshot: everything, but the screenshot, is serialized right away, because the Scenery and Stats keep changing as the game runs
+    //QImage is implicitly shared, so it's only copied if the game draws into it before the saving thread is done
+    QByteArray progress;
+    {
+        QDataStream progressStream(&progress, QIODeviceBase::WriteOnly);
+        serializableSaveProgress(progressStream);
+    }
+    const QString path = getSaveFilePath(saveSlot);
+
+    SaveSlotInfo saveSlotInfo;
+    saveSlotInfo.saveSlot  = saveSlot;
+    saveSlotInfo.saveDate  = saveDate;
+    saveSlotInfo.sceneName = sceneName;
+    const std::unordered_map<QString, Scene>* scenes = Novel::getInstance().getScenes();
+    auto scene = scenes->find(sceneName);
+    if (scene != scenes->cend())
+        saveSlotInfo.chapterName = scene->second.getChapterName();
+
+    getSaveThreadPool().start([path, saveSlotInfo = std::move(saveSlotInfo), screenshot = frame.isNull() ? screenshot : frame, bDownscale = !frame.isNull(), progress = std::move(progress)]() mutable
+    {
+        const int slot = saveSlotInfo.saveSlot;
+        if (bDownscale)
+            screenshot = downscaleScreenshot(screenshot);
+
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        //QSaveFile writes into a temporary file and renames it over the old Save only in `commit()`
+        QSaveFile save(path);
+        if (!save.open(QIODeviceBase::WriteOnly))
+        {
+            qCritical() << NovelLib::ErrorType::SaveCritical << "Could not open the Save file for the slot" << slot << ':' << save.errorString();
+            return;
+        }
+        {
+            //The JPEG is already compressed, so only the progress goes through qCompress (same layout as `serializableSave()`)
+            QDataStream dataStream(&save);
+            dataStream << SAVE_MAGIC << SAVE_FORMAT_VERSION << saveSlotInfo.saveDate << encodeScreenshot(screenshot) << qCompress(progress);
+        }
+        if (!save.commit())
+        {
+            qCritical() << NovelLib::ErrorType::SaveCritical << "Could not write the Save for the slot" << slot << ", the previous Save was kept:" << save.errorString();
+            return;
+        }
+
+        //Only after the Save is in place, so the index never lists a Save that does not exist
+        saveSlotInfo.thumbnail = SaveSlotIndex::createThumbnail(screenshot);
+        SaveSlotIndex::update(saveSlotInfo);
+    });
+}
+
+void NovelState::waitForSaves()
 {
-    NovelState& novelState = Novel::getInstance().state_;
-    QDir(QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation)).mkpath("NAMSC");
-    QFile save(QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) + "/NAMSC/" + QString::number(saveSlot) + ".sav");
-    save.open(QIODeviceBase::WriteOnly);
-    QDataStream dataStream(&save);
-    dataStream << novelState;
+    getSaveThreadPool().waitForDone();
 }
 
 void NovelState::update(uint elapsedTime)
@@ -0,0 +1,168 @@
+#include "pvnLib/Novel/Data/Save/SaveSlotIndex.h"
+
+#include <QBuffer>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+
+#include "pvnLib/Novel/Data/Novel.h"
+
+namespace
+{
+    constexpr quint32 INDEX_FORMAT_VERSION = 1;
+}
+
+void SaveSlotInfo::serializableLoad(QDataStream& dataStream)
+{
+    QByteArray encodedThumbnail;
+    dataStream >> saveSlot >> saveDate >> sceneName >> chapterName >> encodedThumbnail;
+    thumbnail = QImage::fromData(encodedThumbnail, "JPG");
+}
+
+void SaveSlotInfo::serializableSave(QDataStream& dataStream) const
+{
+    //JPEG keeps a thumbnail at a few kilobytes, QImage's own serialization would store a PNG, which is several times bigger
+    QByteArray encodedThumbnail;
+    QBuffer    buffer(&encodedThumbnail);
+    buffer.open(QIODeviceBase::WriteOnly);
+    thumbnail.save(&buffer, "JPG", 85);
+
+    dataStream << saveSlot << saveDate << sceneName << chapterName << encodedThumbnail;
+}
+
+QString SaveSlotIndex::getIndexFilePath()
+{
+    return NovelState::getSaveDirectoryPath() + "/index.dat";
+}
+
+std::vector<SaveSlotInfo> SaveSlotIndex::load()
+{
+    NovelState::waitForSaves();
+
+    bool bExists = false;
+    std::vector<SaveSlotInfo> saveSlotInfos = read(bExists);
+    if (!bExists)
+        return rebuild();
+    return saveSlotInfos;
+}
+
+void SaveSlotIndex::update(const SaveSlotInfo& saveSlotInfo)
+{
+    bool bExists = false;
+    std::vector<SaveSlotInfo> saveSlotInfos = read(bExists);
+    //An index of only this slot would hide the older Saves for good, so it's left missing and `load()` rebuilds it from all of them
+    //Rebuilding here is not an option, as `rebuild()` waits for the Saves, which would deadlock this (saving) thread
+    if (!bExists)
+    {
+        QFile::remove(getIndexFilePath());
+        return;
+    }
+
+    auto it = std::lower_bound(saveSlotInfos.begin(), saveSlotInfos.end(), saveSlotInfo.saveSlot, [](const SaveSlotInfo& lhs, int saveSlot) { return lhs.saveSlot < saveSlot; });
+    if (it != saveSlotInfos.end() && it->saveSlot == saveSlotInfo.saveSlot)
+        *it = saveSlotInfo;
+    else
+        saveSlotInfos.insert(it, saveSlotInfo);
+
+    write(saveSlotInfos);
+}
+
+std::vector<SaveSlotInfo> SaveSlotIndex::rebuild()
+{
+    std::vector<SaveSlotInfo> saveSlotInfos;
+
+    const QDir saveDirectory(NovelState::getSaveDirectoryPath());
+    for (const QFileInfo& saveFile : saveDirectory.entryInfoList(QStringList() << "*.sav", QDir::Files))
+    {
+        bool bNumber  = false;
+        uint saveSlot = saveFile.completeBaseName().toUInt(&bNumber);
+        if (!bNumber)
+            continue;
+
+        NovelState novelState = NovelState::load(saveSlot);
+
+        SaveSlotInfo saveSlotInfo;
+        saveSlotInfo.saveSlot  = saveSlot;
+        saveSlotInfo.saveDate  = novelState.saveDate;
+        saveSlotInfo.sceneName = novelState.sceneName;
+        saveSlotInfo.thumbnail = createThumbnail(novelState.screenshot);
+
+        const std::unordered_map<QString, Scene>* scenes = Novel::getInstance().getScenes();
+        auto scene = scenes->find(novelState.sceneName);
+        if (scene != scenes->cend())
+            saveSlotInfo.chapterName = scene->second.getChapterName();
+
+        saveSlotInfos.push_back(std::move(saveSlotInfo));
+    }
+    std::sort(saveSlotInfos.begin(), saveSlotInfos.end(), [](const SaveSlotInfo& lhs, const SaveSlotInfo& rhs) { return lhs.saveSlot < rhs.saveSlot; });
+
+    if (!saveSlotInfos.empty())
+        write(saveSlotInfos);
+    return saveSlotInfos;
+}
+
+QImage SaveSlotIndex::createThumbnail(const QImage& screenshot)
+{
+    if (screenshot.isNull())
+        return QImage();
+    return screenshot.scaled(THUMBNAIL_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+std::vector<SaveSlotInfo> SaveSlotIndex::read(bool& bExists)
+{
+    std::vector<SaveSlotInfo> saveSlotInfos;
+
+    QFile index(getIndexFilePath());
+    bExists = index.open(QIODeviceBase::ReadOnly);
+    if (!bExists)
+        return saveSlotInfos;
+
+    QDataStream dataStream(&index);
+    quint32 version = 0, size = 0;
+    dataStream >> version >> size;
+    if (version != INDEX_FORMAT_VERSION)
+    {
+        //Unknown layout, treated as if there was no index, so it gets rebuilt
+        bExists = false;
+        return saveSlotInfos;
+    }
+
+    saveSlotInfos.reserve(size);
+    for (quint32 i = 0; i != size && dataStream.status() == QDataStream::Ok; ++i)
+    {
+        SaveSlotInfo saveSlotInfo;
+        dataStream >> saveSlotInfo;
+        saveSlotInfos.push_back(std::move(saveSlotInfo));
+    }
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        qCritical() << NovelLib::ErrorType::SaveCritical << "The Save index is corrupted, it will be rebuilt";
+        bExists = false;
+        saveSlotInfos.clear();
+    }
+    return saveSlotInfos;
+}
+
+bool SaveSlotIndex::write(const std::vector<SaveSlotInfo>& saveSlotInfos)
+{
+    QDir().mkpath(NovelState::getSaveDirectoryPath());
+    QSaveFile index(getIndexFilePath());
+    if (!index.open(QIODeviceBase::WriteOnly))
+    {
+        qCritical() << NovelLib::ErrorType::SaveCritical << "Could not open the Save index:" << index.errorString();
+        return false;
+    }
+
+    QDataStream dataStream(&index);
+    dataStream << INDEX_FORMAT_VERSION << static_cast<quint32>(saveSlotInfos.size());
+    for (const SaveSlotInfo& saveSlotInfo : saveSlotInfos)
+        dataStream << saveSlotInfo;
+
+    if (!index.commit())
+    {
+        qCritical() << NovelLib::ErrorType::SaveCritical << "Could not write the Save index:" << index.errorString();
+        return false;
+    }
+    return true;
+}
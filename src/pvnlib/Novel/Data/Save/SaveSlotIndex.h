@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QDataStream>
+#include <QDate>
+#include <QImage>
+#include <QSize>
+#include <vector>
+
+#include "pvnLib/Serialization.h"
+
+/// Describes a Save just enough to display its slot in a save/load menu
+struct SaveSlotInfo
+{
+    int     saveSlot    = -1;
+    QDate   saveDate;
+    QString sceneName   = "";
+    QString chapterName = "";
+    /// Screenshot scaled down to fit `SaveSlotIndex::THUMBNAIL_SIZE`
+    QImage  thumbnail;
+
+    //---SERIALIZATION---
+    /// Loading an object from a binary file
+    /// \param dataStream Stream (presumably connected to a QFile) to read from
+    void serializableLoad(QDataStream& dataStream);
+    /// Saving an object to a binary file
+    /// \param dataStream Stream (presumably connected to a QFile) to save to
+    void serializableSave(QDataStream& dataStream) const;
+};
+
+/// Index of all the Saves, stored as a single small file next to them
+/// A save/load menu reads only the index, a NovelState is deserialized (`NovelState::load()`) only when its slot is actually chosen
+/// The index is kept up to date by the saving thread, right after a Save is written
+class SaveSlotIndex final
+{
+public:
+    SaveSlotIndex() = delete;
+
+    static constexpr QSize THUMBNAIL_SIZE = QSize(320, 180);
+
+    /// Reads the index, waiting for the pending Saves first, so it lists all of them
+    /// If there is no index yet (Saves made by an older version), it's rebuilt from the Saves once
+    /// \return Slots sorted by their numbers
+    static std::vector<SaveSlotInfo> load();
+
+    /// Adds the slot or replaces its old entry
+    /// If there is no (readable) index, nothing is written, so the next `load()` rebuilds it with all the Saves
+    /// Called by the saving thread, so it's not synchronized with `load()`, which waits for that thread instead
+    static void update(const SaveSlotInfo& saveSlotInfo);
+
+    /// Deserializes every Save to recreate the index, slow
+    /// Must not be called from the saving thread, as loading a Save waits for that thread
+    static std::vector<SaveSlotInfo> rebuild();
+
+    /// \return `screenshot` scaled down to a thumbnail
+    static QImage createThumbnail(const QImage& screenshot);
+
+private:
+    static QString getIndexFilePath();
+
+    /// \param bExists Set to whether the index file exists
+    static std::vector<SaveSlotInfo> read(bool& bExists);
+    /// Writes the index atomically, so a crash cannot leave a half-written index
+    static bool write(const std::vector<SaveSlotInfo>& saveSlotInfos);
+};
@@ -243,45 +243,69 @@ std::shared_ptr<Event> Scene::getEvent(const QString& name)
 
 const std::vector<std::shared_ptr<Event>>* Scene::setEvents(std::vector<std::shared_ptr<Event>>&& events) noexcept
 {
-    return &(events_ = std::move(events));
+    events_ = std::move(events);
+    Novel::getInstance().sceneChanged(*this);
+    return &events_;
 }
 
 std::shared_ptr<Event> Scene::addEvent(Event* event) noexcept
 {
-    return *NovelLib::Helpers::listAdd(events_, std::move(std::shared_ptr<Event>(event)), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    std::shared_ptr<Event> addedEvent = *NovelLib::Helpers::listAdd(events_, std::move(std::shared_ptr<Event>(event)), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    Novel::getInstance().sceneChanged(*this);
+    return addedEvent;
 }
 
 std::shared_ptr<Event> Scene::addEvent(std::shared_ptr<Event>&& event) noexcept
 {
-    return *NovelLib::Helpers::listAdd(events_, std::move(event), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    std::shared_ptr<Event> addedEvent = *NovelLib::Helpers::listAdd(events_, std::move(event), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    Novel::getInstance().sceneChanged(*this);
+    return addedEvent;
 }
 
 std::shared_ptr<Event> Scene::insertEvent(uint index, Event* event)
 {
-    return *NovelLib::Helpers::listInsert(events_, index, std::move(std::shared_ptr<Event>(event)), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    std::shared_ptr<Event> insertedEvent = *NovelLib::Helpers::listInsert(events_, index, std::move(std::shared_ptr<Event>(event)), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    Novel::getInstance().sceneChanged(*this);
+    return insertedEvent;
 }
 
 std::shared_ptr<Event> Scene::insertEvent(uint index, std::shared_ptr<Event>&& event)
 {
-    return *NovelLib::Helpers::listInsert(events_, index, std::move(event), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    std::shared_ptr<Event> insertedEvent = *NovelLib::Helpers::listInsert(events_, index, std::move(event), "Event", NovelLib::ErrorType::EventInvalid, "Scene", name);
+    Novel::getInstance().sceneChanged(*this);
+    return insertedEvent;
 }
 
 std::shared_ptr<Event> Scene::reinsertEvent(uint index, uint newIndex)
 {
-    return *NovelLib::Helpers::listReinsert(events_, index, newIndex, "Event", NovelLib::ErrorType::EventMissing, NovelLib::ErrorType::EventInvalid, "Scene", name);
+    std::shared_ptr<Event> reinsertedEvent = *NovelLib::Helpers::listReinsert(events_, index, newIndex, "Event", NovelLib::ErrorType::EventMissing, NovelLib::ErrorType::EventInvalid, "Scene", name);
+    Novel::getInstance().sceneChanged(*this);
+    return reinsertedEvent;
 }
 
 bool Scene::removeEvent(uint index)
 {
-    return NovelLib::Helpers::listRemove(events_, index, "Event", NovelLib::ErrorType::EventMissing, "Scene", name);
+    if (!NovelLib::Helpers::listRemove(events_, index, "Event", NovelLib::ErrorType::EventMissing, "Scene", name))
+        return false;
+    Novel::getInstance().sceneChanged(*this);
+    return true;
 }
 
 bool Scene::removeEvent(const QString& name)
 {
-    return NovelLib::Helpers::listRemove(events_, name, "Event", NovelLib::ErrorType::EventMissing, "Scene", this->name);
+    if (!NovelLib::Helpers::listRemove(events_, name, "Event", NovelLib::ErrorType::EventMissing, "Scene", this->name))
+        return false;
+    Novel::getInstance().sceneChanged(*this);
+    return true;
 }
 
 void Scene::clearEvents() noexcept
 {
     events_.clear();
+    Novel::getInstance().sceneChanged(*this);
+}
+
+QString Scene::getChapterName() const noexcept
+{
+    return chapterName_;
 }
\ No newline at end of file
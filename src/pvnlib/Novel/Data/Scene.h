@@ -29,6 +29,9 @@ public:
 	/// \return Whether an Error has occurred
 	bool errorCheck(bool bComprehensive = false) const override;
 	void ensureResourcesAreLoaded() override;
+	/// Loads the sprites displayed by every Event of the Scene, so the whole Scene can be drawn from a single SpriteAtlas
+	/// \return Sprites with duplicates, SpriteAtlas removes them
+	std::vector<const AssetImage*> collectSpriteAssetImages();
 
 	QString nextFreeEventName();
 
@@ -66,6 +69,8 @@ public:
 	bool removeEvent(const QString& name);
 	void clearEvents() noexcept;
 
+	QString getChapterName() const noexcept;
+
 	/// Automatically assigned upon creation or changed by the Editor User
 	QString	name                = "";
 
@@ -0,0 +1,351 @@
+#include "pvnLib/Novel/Data/SearchIndex.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "pvnLib/Novel/Action/ActionAll.h"
+#include "pvnLib/Novel/Action/Visitor/ActionVisitor.h"
+#include "pvnLib/Novel/Data/Scene.h"
+#include "pvnLib/Novel/Event/EventAll.h"
+#include "pvnLib/Novel/Event/Visitor/EventVisitor.h"
+
+/// Orders the Locations of a single Scene, so the Postings of different terms can be intersected in linear time
+static bool locationLess(const SearchIndex::Location& lhs, const SearchIndex::Location& rhs) noexcept
+{
+	if (lhs.event != rhs.event)
+		return std::less<const Event*>()(lhs.event, rhs.event);
+	return lhs.elementIndex < rhs.elementIndex;
+}
+
+/// Visits a Scene's Events and their Actions and adds everything they reference to the SearchIndex
+class SceneIndexer final : public EventVisitor, public ActionVisitor
+{
+public:
+	SceneIndexer(SearchIndex& searchIndex, const QString& sceneName)
+		: searchIndex_(searchIndex), location_{ sceneName }
+	{
+	}
+
+	void indexScene(const Scene& scene)
+	{
+		indexScenery(scene.scenery);
+
+		for (const std::shared_ptr<Event>& event : *scene.getEvents())
+		{
+			location_ = SearchIndex::Location{ scene.name, event.get() };
+			add(SearchIndex::ReferenceType::Label, event->label);
+			indexScenery(event->scenery);
+			for (const std::shared_ptr<Action>& action : *event->getActions())
+				action->acceptVisitor(this);
+
+			event->acceptVisitor(this);
+		}
+	}
+
+	void visitEventChoice(EventChoice* event) override
+	{
+		indexTranslation(*event->getMenuText());
+
+		const std::vector<Choice>& choices = *event->getChoices();
+		for (int i = 0; i != static_cast<int>(choices.size()); ++i)
+		{
+			location_.elementIndex = i;
+			indexTranslation(choices[i].translation);
+			add(SearchIndex::ReferenceType::JumpTarget, choices[i].jumpToSceneName);
+			indexExpression(choices[i].condition);
+		}
+		location_.elementIndex = -1;
+	}
+
+	void visitEventIf(EventIf* event) override
+	{
+		indexExpression(event->condition);
+	}
+
+	void visitEventInput(EventInput* event) override
+	{
+		add(SearchIndex::ReferenceType::Stat, event->getInputStatName());
+		indexExpression(event->logicalExpression);
+		add(SearchIndex::ReferenceType::JumpTarget, event->logicalExpression_failureJumpToSceneName);
+	}
+
+	void visitEventJump(EventJump* event) override
+	{
+		add(SearchIndex::ReferenceType::JumpTarget, event->jumpToSceneName);
+		indexExpression(event->condition);
+	}
+
+	void visitEventDialogue(EventDialogue* event) override
+	{
+		const std::vector<Sentence>& sentences = *event->getSentences();
+		for (int i = 0; i != static_cast<int>(sentences.size()); ++i)
+		{
+			location_.elementIndex = i;
+			indexTranslation(sentences[i].translation);
+			for (const QString& word : SearchIndex::splitWords(sentences[i].displayedName))
+				add(SearchIndex::ReferenceType::Word, word);
+			add(SearchIndex::ReferenceType::Character,  sentences[i].getCharacterName());
+			add(SearchIndex::ReferenceType::Voice,      sentences[i].getVoiceName());
+			add(SearchIndex::ReferenceType::AssetImage, sentences[i].getAssetImageName());
+		}
+		location_.elementIndex = -1;
+	}
+
+	void visitActionStatSetValue(ActionStatSetValue* action) override
+	{
+		add(SearchIndex::ReferenceType::Stat, action->getStatName());
+		indexExpression(action->expression);
+	}
+
+	void visitActionSceneryObjectAnimColor(ActionSceneryObjectAnimColor* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+	}
+
+	void visitActionSceneryObjectAnimMove(ActionSceneryObjectAnimMove* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+	}
+
+	void visitActionSceneryObjectAnimRotate(ActionSceneryObjectAnimRotate* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+	}
+
+	void visitActionSceneryObjectAnimScale(ActionSceneryObjectAnimScale* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+	}
+
+	void visitActionSceneryObjectAnimFade(ActionSceneryObjectAnimFade* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+	}
+
+	void visitActionSceneryObjectSetImage(ActionSceneryObjectSetImage* action) override
+	{
+		add(SearchIndex::ReferenceType::SceneryObject, action->getSceneryObjectName());
+		add(SearchIndex::ReferenceType::AssetImage,    action->getAssetImageName());
+	}
+
+	void visitActionCharacterSetVoice(ActionCharacterSetVoice* action) override
+	{
+		add(SearchIndex::ReferenceType::Character, action->getCharacterName());
+		add(SearchIndex::ReferenceType::Voice,     action->getVoiceName());
+	}
+
+	void visitActionSetBackground(ActionSetBackground* action) override
+	{
+		add(SearchIndex::ReferenceType::AssetImage, action->getAssetImageName());
+	}
+
+private:
+	void add(SearchIndex::ReferenceType type, const QString& term)
+	{
+		if (!term.isEmpty())
+			searchIndex_.add(type, term, location_);
+	}
+
+	void indexTranslation(const Translation& translation)
+	{
+		for (const std::pair<const QString, QString>& text : *translation.getTranslations())
+			for (const QString& word : SearchIndex::splitWords(text.second))
+				add(SearchIndex::ReferenceType::Word, word);
+	}
+
+	void indexExpression(const QString& expression)
+	{
+		for (const QString& identifier : SearchIndex::splitIdentifiers(expression))
+			add(SearchIndex::ReferenceType::Stat, identifier);
+	}
+
+	void indexScenery(const Scenery& scenery)
+	{
+		add(SearchIndex::ReferenceType::AssetImage, scenery.getBackgroundAssetImageName());
+		for (const Character& character : *scenery.getDisplayedCharacters())
+		{
+			add(SearchIndex::ReferenceType::Character,  character.name);
+			add(SearchIndex::ReferenceType::AssetImage, character.getAssetImageName());
+		}
+		for (const SceneryObject& sceneryObject : *scenery.getDisplayedSceneryObjects())
+		{
+			add(SearchIndex::ReferenceType::SceneryObject, sceneryObject.name);
+			add(SearchIndex::ReferenceType::AssetImage,    sceneryObject.getAssetImageName());
+		}
+	}
+
+	SearchIndex&          searchIndex_;
+	SearchIndex::Location location_;
+};
+
+void SearchIndex::indexScene(const Scene& scene)
+{
+	removeScene(scene.name);
+
+	SceneIndexer sceneIndexer(*this, scene.name);
+	sceneIndexer.indexScene(scene);
+
+	//Only the terms of this Scene are touched, so the cost depends on the Scene's size, not the Novel's
+	if (auto it = sceneTerms_.find(scene.name); it != sceneTerms_.end())
+		for (const std::pair<ReferenceType, QString>& term : it->second)
+		{
+			std::vector<Location>& locations = index_[static_cast<size_t>(term.first)][term.second][scene.name];
+			std::sort(locations.begin(), locations.end(), locationLess);
+			locations.erase(std::unique(locations.begin(), locations.end()), locations.end());
+		}
+}
+
+void SearchIndex::removeScene(const QString& sceneName)
+{
+	staleScenes_.erase(sceneName);
+
+	auto it = sceneTerms_.find(sceneName);
+	if (it == sceneTerms_.end())
+		return;
+
+	for (const std::pair<ReferenceType, QString>& term : it->second)
+	{
+		std::unordered_map<QString, Postings>& terms = index_[static_cast<size_t>(term.first)];
+		auto termIt = terms.find(term.second);
+		if (termIt == terms.end())
+			continue;
+		termIt->second.erase(sceneName);
+		if (termIt->second.empty())
+			terms.erase(termIt);
+	}
+	sceneTerms_.erase(it);
+}
+
+void SearchIndex::markSceneStale(const QString& sceneName)
+{
+	staleScenes_.insert(sceneName);
+}
+
+void SearchIndex::updateStaleScenes(const std::unordered_map<QString, Scene>& scenes)
+{
+	const std::unordered_set<QString> staleScenes = std::move(staleScenes_);
+	staleScenes_.clear();
+
+	for (const QString& sceneName : staleScenes)
+	{
+		if (auto it = scenes.find(sceneName); it != scenes.cend())
+			indexScene(it->second);
+		else
+			removeScene(sceneName);
+	}
+}
+
+void SearchIndex::clear() noexcept
+{
+	for (std::unordered_map<QString, Postings>& terms : index_)
+		terms.clear();
+	sceneTerms_.clear();
+	staleScenes_.clear();
+}
+
+std::vector<SearchIndex::Location> SearchIndex::findText(const QString& text) const
+{
+	const std::unordered_map<QString, Postings>& words = index_[static_cast<size_t>(ReferenceType::Word)];
+
+	std::vector<const Postings*> postingsOfWords;
+	for (const QString& word : splitWords(text))
+	{
+		auto it = words.find(word);
+		if (it == words.cend())
+			return {};
+		postingsOfWords.push_back(&it->second);
+	}
+	if (postingsOfWords.empty())
+		return {};
+
+	//Start from the rarest word, every other word can only narrow its Locations down
+	std::sort(postingsOfWords.begin(), postingsOfWords.end(), [](const Postings* lhs, const Postings* rhs) { return lhs->size() < rhs->size(); });
+
+	std::vector<Location> locations;
+	for (const std::pair<const QString, std::vector<Location>>& sceneLocations : *postingsOfWords.front())
+	{
+		std::vector<Location> candidates = sceneLocations.second;
+		for (auto postings = postingsOfWords.cbegin() + 1; postings != postingsOfWords.cend() && !candidates.empty(); ++postings)
+		{
+			auto it = (*postings)->find(sceneLocations.first);
+			if (it == (*postings)->cend())
+			{
+				candidates.clear();
+				break;
+			}
+			std::vector<Location> intersection;
+			std::set_intersection(candidates.cbegin(), candidates.cend(), it->second.cbegin(), it->second.cend(), std::back_inserter(intersection), locationLess);
+			candidates = std::move(intersection);
+		}
+		locations.insert(locations.end(), candidates.cbegin(), candidates.cend());
+	}
+	return locations;
+}
+
+std::vector<SearchIndex::Location> SearchIndex::findReferences(ReferenceType type, const QString& name) const
+{
+	const std::unordered_map<QString, Postings>& terms = index_[static_cast<size_t>(type)];
+	auto it = terms.find(type == ReferenceType::Word ? name.toCaseFolded() : name);
+	if (it == terms.cend())
+		return {};
+
+	std::vector<Location> locations;
+	for (const std::pair<const QString, std::vector<Location>>& sceneLocations : it->second)
+		locations.insert(locations.end(), sceneLocations.second.cbegin(), sceneLocations.second.cend());
+	return locations;
+}
+
+QStringList SearchIndex::splitWords(const QString& text)
+{
+	QStringList words;
+	qsizetype wordBegin = -1;
+	for (qsizetype i = 0; i <= text.size(); ++i)
+	{
+		const bool bWordCharacter = i != text.size() && text[i].isLetterOrNumber();
+		if (bWordCharacter && wordBegin == -1)
+			wordBegin = i;
+		else if (!bWordCharacter && wordBegin != -1)
+		{
+			words.append(text.sliced(wordBegin, i - wordBegin).toCaseFolded());
+			wordBegin = -1;
+		}
+	}
+	return words;
+}
+
+QStringList SearchIndex::splitIdentifiers(const QString& expression)
+{
+	QStringList identifiers;
+	qsizetype identifierBegin = -1;
+	for (qsizetype i = 0; i <= expression.size(); ++i)
+	{
+		const bool bIdentifierCharacter = i != expression.size() && (expression[i].isLetterOrNumber() || expression[i] == '_');
+		if (bIdentifierCharacter && identifierBegin == -1)
+		{
+			//Numbers are not identifiers
+			if (!expression[i].isDigit())
+				identifierBegin = i;
+			else
+				while (i + 1 < expression.size() && (expression[i + 1].isLetterOrNumber() || expression[i + 1] == '.'))
+					++i;
+		}
+		else if (!bIdentifierCharacter && identifierBegin != -1)
+		{
+			identifiers.append(expression.sliced(identifierBegin, i - identifierBegin));
+			identifierBegin = -1;
+		}
+	}
+	return identifiers;
+}
+
+void SearchIndex::add(ReferenceType type, const QString& term, const Location& location)
+{
+	std::vector<Location>& locations = index_[static_cast<size_t>(type)][term][location.sceneName];
+	if (locations.empty())
+		sceneTerms_[location.sceneName].emplace_back(type, term);
+	//Locations are indexed one after another, so a repeated term can only repeat the last one
+	else if (locations.back() == location)
+		return;
+	locations.push_back(location);
+}
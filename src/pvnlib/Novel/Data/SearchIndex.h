@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Event;
+class Scene;
+
+/// Inverted index of the words of the Translations and of the names referenced by the Scenes (Assets, Characters, Stats, Jump targets, etc.)
+/// Lets the Editor search the whole Novel without walking every Scene, Event and Sentence
+/// A changed Scene is only marked stale, it is reindexed by `updateStaleScenes()` before the next search, so editing costs nothing until something is searched
+class SearchIndex final
+{
+public:
+	enum class ReferenceType
+	{
+		/// A word of a Translation (in any language) or of a displayed name, case insensitive
+		Word,
+		/// Label of an Event
+		Label,
+		AssetImage,
+		Character,
+		SceneryObject,
+		Voice,
+		/// Stat set by an Action or an EventInput, or used in a condition or an expression
+		Stat,
+		/// Name of the Scene that an EventJump, a Choice or an EventInput jumps to
+		JumpTarget,
+		Count
+	};
+
+	struct Location
+	{
+		QString sceneName;
+		/// nullptr if it is the Scene's own Scenery
+		Event*  event        = nullptr;
+		/// Index of the Sentence or Choice in the Event, -1 if it is in the Event itself
+		int     elementIndex = -1;
+
+		bool operator==(const Location& obj) const noexcept = default;
+	};
+
+	/// Replaces everything indexed for the Scene with what it contains now
+	void indexScene(const Scene& scene);
+	/// Forgets everything indexed for the Scene
+	void removeScene(const QString& sceneName);
+	/// The Scene will be reindexed by the next `updateStaleScenes()`
+	void markSceneStale(const QString& sceneName);
+	/// Reindexes the Scenes marked stale, the ones missing from `scenes` are removed
+	void updateStaleScenes(const std::unordered_map<QString, Scene>& scenes);
+	void clear() noexcept;
+
+	/// Finds the places containing every word of `text`, in any order and case
+	std::vector<Location> findText(const QString& text) const;
+	/// Finds the places referencing `name` as the given ReferenceType
+	std::vector<Location> findReferences(ReferenceType type, const QString& name) const;
+
+	/// Splits the text into case folded words, the way the Translations are indexed
+	static QStringList splitWords(const QString& text);
+	/// Extracts the identifiers (possible Stat names) from a condition or an expression
+	static QStringList splitIdentifiers(const QString& expression);
+
+private:
+	friend class SceneIndexer;
+
+	/// Locations grouped by their Scene, so a reindexed Scene removes only its own entry
+	/// Each Scene's Locations are sorted once it is indexed, so `findText()` can intersect them
+	using Postings = std::unordered_map<QString, std::vector<Location>>;
+
+	/// Adds the Location to the term's Postings, skipping the term if it was already found at the same Location
+	void add(ReferenceType type, const QString& term, const Location& location);
+
+	std::array<std::unordered_map<QString, Postings>, static_cast<size_t>(ReferenceType::Count)> index_;
+	/// Terms indexed for each Scene, so they can be removed without scanning the whole index
+	std::unordered_map<QString, std::vector<std::pair<ReferenceType, QString>>> sceneTerms_;
+	std::unordered_set<QString> staleScenes_;
+};
@@ -26,7 +26,6 @@ void swap(Choice::ChoiceDisplayOptions& first, Choice::ChoiceDisplayOptions& sec
 	std::swap(first.bHideIfConditionNotMet, second.bHideIfConditionNotMet);
 	std::swap(first.buttonWeight,           second.buttonWeight);
 	std::swap(first.spacerWeight,           second.spacerWeight);
-	std::swap(first.font_,                  second.font_);
 }
 
 Choice::Choice(EventChoice* const parentEvent, const Translation& translation, const QString& jumpToSceneName, const QString& condition, const ChoiceDisplayOptions& choiceDisplayOptions)
@@ -54,7 +53,6 @@ Choice::ChoiceDisplayOptions::ChoiceDisplayOptions(const QString& fontName, uint
 	buttonWeight(buttonWeight),
 	spacerWeight(spacerWeight)
 {
-	font_ = QFont(fontName);
 }
 
 //defaulted
@@ -63,8 +61,7 @@ Choice::ChoiceDisplayOptions::ChoiceDisplayOptions(const QString& fontName, uint
 //	fontSize(obj.fontSize),
 //	bHideIfConditionNotMet(obj.bHideIfConditionNotMet),
 //	buttonWeight(obj.buttonWeight),
-//	spacerWeight(obj.spacerWeight),
-//	font_(obj.font_)
+//	spacerWeight(obj.spacerWeight)
 //{
 //}
 
@@ -154,18 +151,12 @@ QString Choice::ChoiceDisplayOptions::getFontName() const noexcept
 	return fontName_;
 }
 
-const QFont* Choice::ChoiceDisplayOptions::getFont() const noexcept
+std::shared_ptr<const FontRegistry::Font> Choice::ChoiceDisplayOptions::getFont() const
 {
-	return &font_; 
-}
-
-QFont* Choice::ChoiceDisplayOptions::getFont() noexcept
-{
-	return &font_;
+	return FontRegistry::getInstance().getFont(fontName_, static_cast<int>(fontSize));
 }
 
 void Choice::ChoiceDisplayOptions::setFont(const QString& fontName) noexcept
 {
 	fontName_ = fontName;
-	font_     = QFont(fontName);
 }
\ No newline at end of file
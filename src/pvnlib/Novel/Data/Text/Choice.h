@@ -1,8 +1,9 @@
 #pragma once
 
-#include <QFont>
+#include <memory>
 
 #include "pvnLib/Novel/Data/Asset/AssetImage.h"
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
 #include "pvnLib/Novel/Data/Text/Translation.h"
 #include "pvnLib/Novel/Event/EventJump.h"
 #include "pvnLib/Serialization.h"
@@ -20,7 +21,7 @@ public:
 	public:
 		ChoiceDisplayOptions()                                           noexcept = default;
 		/// \param bHideIfConditionNotMet Normally, if the Choice is not available, it will be greyed out, setting this to `true` will make the Choice not appear at all
-		/// \exception Error The found `font_` might be the wrong one (Qt finds the closest one, not the specific one) or could not be read at all
+		/// \exception Error The found font might be the wrong one (Qt finds the closest one, not the specific one) or could not be read at all
 		explicit ChoiceDisplayOptions(const QString& fontName, uint fontSize = 11, bool bHideIfConditionNotMet = false, uint buttonWeight = 0, uint spacerWeight = 0);
 		ChoiceDisplayOptions(const ChoiceDisplayOptions& obj)            noexcept = default;
 		ChoiceDisplayOptions(ChoiceDisplayOptions&& obj)                 noexcept = default;
@@ -29,7 +30,7 @@ public:
 		bool operator==(const ChoiceDisplayOptions& obj) const           noexcept = default;
 		bool operator!=(const ChoiceDisplayOptions& obj) const           noexcept = default;
 
-		/// \exception Error `font_`/`assetImage` is invalid
+		/// \exception Error `fontName_`/`assetImage` is invalid
 		/// \return Whether an Error has occurred
 		bool errorCheck(bool bComprehensive = false) const;
 
@@ -43,13 +44,12 @@ public:
 			 spacerWeight = 0;
 
 		QString getFontName()  const noexcept;
-		const QFont* getFont() const noexcept;
-		QFont*       getFont()       noexcept;
+		/// \return Font shared through the FontRegistry, resolved from the font's name and `fontSize`
+		std::shared_ptr<const FontRegistry::Font> getFont() const;
 		void setFont(const QString& fontName) noexcept;
 
 	private:
 		QString fontName_ = "";
-		QFont   font_;
 
 		//QString     buttonAssetImageName = "";
 		/// Custom Image for a button
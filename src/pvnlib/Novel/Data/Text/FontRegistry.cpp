@@ -0,0 +1,33 @@
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
+
+size_t qHash(const FontRegistry::Key& key, size_t seed) noexcept
+{
+	return qHashMulti(seed, key.family, key.pointSize, key.bBold, key.bItalic);
+}
+
+FontRegistry::Font::Font(const QFont& font)
+	: font(font),
+	metrics(font)
+{
+}
+
+FontRegistry& FontRegistry::getInstance() noexcept
+{
+	static FontRegistry fontRegistry;
+	return fontRegistry;
+}
+
+std::shared_ptr<const FontRegistry::Font> FontRegistry::getFont(const QString& family, int pointSize, bool bBold, bool bItalic)
+{
+	const Key key{ family, pointSize, bBold, bItalic };
+	auto it = fonts_.constFind(key);
+	if (it != fonts_.cend())
+		return it.value();
+
+	QFont font(family, pointSize, bBold ? QFont::Bold : QFont::Normal, bItalic);
+	font.setStyleHint(QFont::Helvetica, QFont::PreferAntialias);
+	//Creating the metrics forces the match, so it happens here and not during the first paint
+	std::shared_ptr<const Font> resolved = std::make_shared<const Font>(font);
+	fonts_.insert(key, resolved);
+	return resolved;
+}
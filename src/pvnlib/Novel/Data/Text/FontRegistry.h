@@ -0,0 +1,50 @@
+#pragma once
+#include <QFont>
+#include <QFontMetricsF>
+#include <QHash>
+#include <QString>
+#include <memory>
+
+/// Resolves every font (family, size and style) only once and shares it between all the widgets, Voices and ChoiceDisplayOptions
+/// Matching a QFont against the installed fonts is slow, so the QFont and its metrics are created the first time they are requested and then only looked up
+/// Must be used from the GUI thread
+/// **Singleton**
+class FontRegistry final
+{
+public:
+	/// Resolved font, immutable, so it can be shared
+	struct Font
+	{
+		explicit Font(const QFont& font);
+
+		const QFont         font;
+		const QFontMetricsF metrics;
+	};
+
+	static FontRegistry& getInstance() noexcept;
+	FontRegistry(const FontRegistry&)            noexcept = delete;
+	FontRegistry(FontRegistry&&)                 noexcept = delete;
+	FontRegistry& operator=(const FontRegistry&) noexcept = delete;
+
+	/// \param family If empty or not installed, Qt picks the closest match (Helvetica-like and antialiased)
+	/// \param pointSize Size in points
+	/// \return Shared font
+	std::shared_ptr<const Font> getFont(const QString& family, int pointSize, bool bBold = false, bool bItalic = false);
+
+private:
+	//Nothing can create the FontRegistry, but its methods
+	FontRegistry() = default;
+
+	struct Key
+	{
+		QString family;
+		int     pointSize = 0;
+		bool    bBold     = false,
+				bItalic   = false;
+
+		bool operator==(const Key& obj) const noexcept = default;
+	};
+	friend size_t qHash(const Key& key, size_t seed) noexcept;
+
+	QHash<Key, std::shared_ptr<const Font>> fonts_;
+};
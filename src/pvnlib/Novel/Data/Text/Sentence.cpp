@@ -23,6 +23,7 @@ void swap(Sentence& first, Sentence& second) noexcept
 	swap(first.cpsOverwrite,           second.cpsOverwrite);
 	swap(first.bEndWithInput,          second.bEndWithInput);
 	swap(first.waitBeforeContinueTime, second.waitBeforeContinueTime);
+	swap(first.voiceLine,              second.voiceLine);
 	swap(first.character_,             second.character_);
 	swap(first.voice_,                 second.voice_);
 	swap(first.assetImage_,            second.assetImage_);
@@ -57,6 +58,7 @@ Sentence::Sentence(const Sentence& obj) noexcept
 	cpsOverwrite(obj.cpsOverwrite),
 	bEndWithInput(obj.bEndWithInput),
 	waitBeforeContinueTime(obj.waitBeforeContinueTime),
+	voiceLine(obj.voiceLine),
 	character_(obj.character_),
 	voice_(obj.voice_),
 	assetImage_(obj.assetImage_)
@@ -75,19 +77,27 @@ bool Sentence::operator==(const Sentence& obj) const noexcept
 		   cpsMultiplier          == obj.cpsMultiplier          &&
 		   cpsOverwrite           == obj.cpsOverwrite           &&
 		   bEndWithInput          == obj.bEndWithInput          &&
-		   waitBeforeContinueTime == obj.waitBeforeContinueTime;
+		   waitBeforeContinueTime == obj.waitBeforeContinueTime &&
+		   voiceLine              == obj.voiceLine;
 }
 
 void Sentence::serializableLoad(QDataStream& dataStream)
 {
+	//Scenes written before the `voiceLine` was added have no version
+	const quint32 version = NovelLib::loadSerializationVersion(dataStream);
 	dataStream >> translation >> displayedName >> characterName_ >> voiceName_ >> assetImageName_ >> cpsMultiplier >> cpsOverwrite >> bEndWithInput >> waitBeforeContinueTime;
+	if (version >= 1)
+		dataStream >> voiceLine;
+	else
+		voiceLine = Sound();
 
 	//voice_ = Novel::getInstance().getVoice(voiceName_);
 }
 
 void Sentence::serializableSave(QDataStream& dataStream) const
 {
-	dataStream << translation << displayedName << characterName_ << voiceName_ << assetImageName_ << cpsMultiplier << cpsOverwrite << bEndWithInput << waitBeforeContinueTime;
+	NovelLib::saveSerializationVersion(dataStream, SERIALIZATION_VERSION);
+	dataStream << translation << displayedName << characterName_ << voiceName_ << assetImageName_ << cpsMultiplier << cpsOverwrite << bEndWithInput << waitBeforeContinueTime << voiceLine;
 }
 
 //  MEMBER_FIELD_SECTION_CHANGE END
@@ -95,6 +95,10 @@ public:
 	/// If the `bEndWithInput_` is set to false, this is the time in milliseconds that the Engine will wait after the text is rendered before moving to a new Sentence
 	uint waitBeforeContinueTime  = 1000;
 
+	/// Recorded line spoken during this Sentence, streamed by the VoiceLineStreamer only a few Sentences ahead
+	/// Empty `soundFilePath` means the Sentence is not voiced
+	Sound voiceLine;
+
 private:
 	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
 	/// A temporary AssetImage for the Character to show some facial expresions or anything else
@@ -108,6 +112,10 @@ private:
 	QString     characterName_  = "";
 	Character*  character_      = nullptr;
 
+	/// 0 - without the `voiceLine`
+	/// 1 - with the `voiceLine`
+	static constexpr quint32 SERIALIZATION_VERSION = 1;
+
 public:
 	//---SERIALIZATION---
 	/// Loading an object from a binary file
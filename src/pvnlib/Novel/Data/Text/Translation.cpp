@@ -90,6 +90,11 @@ void Translation::defaultLanguageChangeFix(const QString& oldDefaultLanguage)
 		qInfo() << "Copying old defaultLanguage Translation translation to the new defaultLanguage. Possible inconsistency: languages should differ, but to fill the empty space, we copy the very probably wrong one, so any text can be displayed at all";
 }
 
+const std::unordered_map<QString, QString>* Translation::getTranslations() const noexcept
+{
+	return &translations_;
+}
+
 QString Translation::text(const QString language) const noexcept
 {
 	if (translations_.contains(language))
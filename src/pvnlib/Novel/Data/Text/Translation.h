@@ -30,6 +30,8 @@ public:
 	/// Returns the text in the given language
 	/// \param language Returns text in this language, or if it doesn't have it - in default one (`NovelSettings::defaultLanguage`)
 	QString text(const QString language = NovelSettings::getInstance().language) const noexcept;
+	/// Returns the text in every language
+	const std::unordered_map<QString, QString>* getTranslations() const noexcept;
 
 	/// Adds or replaces a Translation to the `translations` map
 	void setTranslation(const QString& language, const QString& newText);
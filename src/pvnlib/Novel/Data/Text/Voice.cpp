@@ -19,7 +19,6 @@ void swap(Voice& first, Voice& second) noexcept
 	swap(first.color,         second.color);
 	swap(first.alignment,     second.alignment);
 	swap(first.lipSync,       second.lipSync);
-	swap(first.font_,         second.font_);
 }
 
 Voice::Voice(const QString& name, const QString& fontName, uint fontSize, bool bold, bool italic, bool underscore, const QColor color, double cpsMultiplier, uint cpsOverwrite, const Qt::AlignmentFlag alignment, const LipSyncType lipSync) noexcept
@@ -35,7 +34,6 @@ Voice::Voice(const QString& name, const QString& fontName, uint fontSize, bool b
 	alignment(alignment), 
 	lipSync(lipSync)
 {
-	font_ = QFont(fontName, fontSize_);
 	errorCheck(true);
 }
 
@@ -51,8 +49,7 @@ Voice::Voice(const QString& name, const QString& fontName, uint fontSize, bool b
 //	cpsOverwrite(obj.cpsOverwrite),
 //	color(obj.color),
 //	alignment(obj.alignment),
-//	lipSync(obj.lipSync),
-//	font_(obj.font_)
+//	lipSync(obj.lipSync)
 //{
 //}
 
@@ -108,18 +105,13 @@ QString Voice::getFontName() const noexcept
 	return fontName_;
 }
 
-const QFont* Voice::getFont() const noexcept
+std::shared_ptr<const FontRegistry::Font> Voice::getFont() const
 {
-	return &font_; 
-}
-
-QFont* Voice::getFont() noexcept
-{
-	return &font_;
+	//Only a lookup, the font is matched once for all the Voices that share it
+	return FontRegistry::getInstance().getFont(fontName_, static_cast<int>(fontSize_), bold, italic);
 }
 
 void Voice::setFont(const QString& fontName) noexcept
 { 
 	fontName_ = fontName; 
-	font_     = QFont(fontName);
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <QColor>
-#include <QFont>
+#include <memory>
 
 #include "pvnLib/Novel/Data/Audio/Sound.h"
 #include "pvnLib/Novel/Data/Asset/AssetManager.h"
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
 
 /// Tells how the text should be displayed
 /// [optional] And if there should be any lip syncing done (if the Character is Live2D compatible)
@@ -35,13 +36,13 @@ public:
 	bool operator==(const Voice& obj) const noexcept;
 	bool operator!=(const Voice& obj) const noexcept = default;
 
-	/// \exception Error `font_` is invalid
+	/// \exception Error `fontName_` is invalid
 	/// \return Whether an Error has occurred
 	bool errorCheck(bool bComprehensive = false) const;
 
 	QString getFontName()  const noexcept;
-	const QFont* getFont() const noexcept;
-	QFont*       getFont()       noexcept;
+	/// \return Font shared through the FontRegistry, resolved from the font's name, size, `bold` and `italic`
+	std::shared_ptr<const FontRegistry::Font> getFont() const;
 	void setFont(const QString& fontName) noexcept;
 
 	QString name                = "";
@@ -84,7 +85,6 @@ public:
 
 private:
 	QString fontName_           = "";
-	QFont   font_;
 	uint    fontSize_           = 12;
 
 public:
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+#include "pvnLib/Novel/Data/Visual/Animation/AnimNode.h"
+
+/// Interpolation kernels used by the Animators to calculate a state between two AnimNodes
+/// Every kernel is specialized at compile-time on the AnimNode's dimension and the AnimInterpolationMethod, so the per-sample work is a fixed-size loop without any branching
+/// The method is picked only once per Animation segment (see `selectInterpolator()`), when the Animator's track is built
+namespace NovelLib::Interpolation
+{
+	using Method = AnimNodeBase::AnimInterpolationMethod;
+
+	/// Signature shared by all the kernels
+	/// \param from State at the beginning of the segment
+	/// \param to State at the end of the segment (its `interpolationMethod` and `bezierControlPoints` describe the segment)
+	/// \param out Must already hold `AnimNode::dimension` elements, will receive the interpolated state
+	/// \param progress Normalized time in the segment, in the [0, 1] range
+	template<typename AnimNode>
+	using Interpolator = void (*)(const AnimNode& from, const AnimNode& to, AnimNode& out, double progress);
+
+	/// Finds the curve parameter for which the X coordinate of a cubic Bézier (with P0 = (0, 0) and P3 = (1, 1)) equals `x`, then returns the Y coordinate at that parameter
+	/// Uses a few Newton-Raphson iterations and falls back to bisection when the derivative is too flat
+	constexpr double cubicBezier(double x, double x1, double y1, double x2, double y2) noexcept
+	{
+		//Polynomial coefficients of B(t) = ((a * t + b) * t + c) * t
+		const double cx = 3.0 * x1,
+					 bx = 3.0 * (x2 - x1) - cx,
+					 ax = 1.0 - cx - bx,
+					 cy = 3.0 * y1,
+					 by = 3.0 * (y2 - y1) - cy,
+					 ay = 1.0 - cy - by;
+
+		auto sampleX     = [&](double t) { return ((ax * t + bx) * t + cx) * t; };
+		auto sampleY     = [&](double t) { return ((ay * t + by) * t + cy) * t; };
+		auto sampleSlope = [&](double t) { return (3.0 * ax * t + 2.0 * bx) * t + cx; };
+
+		constexpr double epsilon = 1e-7;
+
+		double t = x;
+		for (int i = 0; i != 8; ++i)
+		{
+			const double error = sampleX(t) - x;
+			if (error < epsilon && error > -epsilon)
+				return sampleY(t);
+
+			const double slope = sampleSlope(t);
+			if (slope < 1e-6 && slope > -1e-6)
+				break;
+
+			t -= error / slope;
+		}
+
+		double low  = 0.0,
+			   high = 1.0;
+		t = x;
+		while (low < high)
+		{
+			const double current = sampleX(t);
+			if (current - x < epsilon && current - x > -epsilon)
+				break;
+
+			if (x > current)
+				low  = t;
+			else
+				high = t;
+
+			t = (high - low) * 0.5 + low;
+			if (high - low < epsilon)
+				break;
+		}
+		return sampleY(t);
+	}
+
+	/// Maps linear progress of a segment into an eased progress
+	/// \param controlPoints Used only by `Method::CubicBezier`
+	template<Method method>
+	inline double ease(double progress, const std::array<double, 4>& controlPoints) noexcept
+	{
+		if constexpr (method == Method::Linear)
+			return progress;
+		else if constexpr (method == Method::Exponential)
+			//Normalized `2^(10t)`, so it starts at 0 and ends at 1
+			return (std::exp2(10.0 * progress) - 1.0) / 1023.0;
+		else if constexpr (method == Method::Hyperbolic)
+			//Normalized hyperbolic tangent, fast start and smooth landing
+			return std::tanh(3.0 * progress) / std::tanh(3.0);
+		else if constexpr (method == Method::CubicBezier)
+			return cubicBezier(progress, controlPoints[0], controlPoints[1], controlPoints[2], controlPoints[3]);
+		else
+			static_assert(method == Method::Linear, "Unhandled AnimInterpolationMethod");
+	}
+
+	/// Interpolates every element of the state, the loop has a compile-time trip count
+	template<typename AnimNode, Method method>
+	void interpolate(const AnimNode& from, const AnimNode& to, AnimNode& out, double progress)
+	{
+		using ValueType = typename AnimNode::ValueType;
+
+		const double factor = ease<method>(progress, to.bezierControlPoints);
+		for (uint i = 0u; i != AnimNode::dimension; ++i)
+		{
+			if constexpr (std::is_integral_v<ValueType>)
+				out.state_[i] = from.state_[i] + static_cast<ValueType>(std::llround((to.state_[i] - from.state_[i]) * factor));
+			else
+				out.state_[i] = from.state_[i] + (to.state_[i] - from.state_[i]) * factor;
+		}
+	}
+
+	/// Resolves the AnimInterpolationMethod into a kernel, so the choice is made once per segment and not per sample
+	template<typename AnimNode>
+	Interpolator<AnimNode> selectInterpolator(Method method) noexcept
+	{
+		switch (method)
+		{
+		case Method::Exponential:
+			return &interpolate<AnimNode, Method::Exponential>;
+		case Method::Hyperbolic:
+			return &interpolate<AnimNode, Method::Hyperbolic>;
+		case Method::CubicBezier:
+			return &interpolate<AnimNode, Method::CubicBezier>;
+		case Method::Linear:
+		default:
+			return &interpolate<AnimNode, Method::Linear>;
+		}
+	}
+}
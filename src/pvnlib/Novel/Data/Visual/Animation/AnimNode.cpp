@@ -5,9 +5,10 @@ AnimNodeBase::~AnimNodeBase() = default;
 //If you add/remove a member field, remember to update these
 //  MEMBER_FIELD_SECTION_CHANGE BEGIN
 
-AnimNodeBase::AnimNodeBase(uint timeStamp, AnimInterpolationMethod interpolationMethod)
+AnimNodeBase::AnimNodeBase(uint timeStamp, AnimInterpolationMethod interpolationMethod, const std::array<double, 4>& bezierControlPoints)
     : timeStamp(timeStamp), 
-    interpolationMethod(interpolationMethod)
+    interpolationMethod(interpolationMethod),
+    bezierControlPoints(bezierControlPoints)
 {
 }
 
@@ -19,11 +20,20 @@ bool AnimNodeBase::operator==(const AnimNodeBase& rhs) const noexcept
 void AnimNodeBase::serializableLoad(QDataStream& dataStream)
 {
     dataStream >> timeStamp >> interpolationMethod;
+
+    //Control points are stored only when they are used, so Nodes with other methods keep their old layout
+    if (interpolationMethod == AnimInterpolationMethod::CubicBezier)
+        for (double& controlPoint : bezierControlPoints)
+            dataStream >> controlPoint;
 }
 
 void AnimNodeBase::serializableSave(QDataStream& dataStream) const
 {
     dataStream << timeStamp << interpolationMethod;
+
+    if (interpolationMethod == AnimInterpolationMethod::CubicBezier)
+        for (double controlPoint : bezierControlPoints)
+            dataStream << controlPoint;
 }
 
 //template<uint dimension>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <QDataStream>
 #include <QVarLengthArray>
 #include "pvnLib/Serialization.h"
@@ -17,11 +18,14 @@ struct AnimNodeBase
 	enum class AnimInterpolationMethod
 	{
 		Linear,
-		Exponential,	//[optional]
-		Hyperbolic		//[optional]
+		Exponential,
+		Hyperbolic,
+		CubicBezier
 	};
 	/// \param timeStamp Time point (in milliseconds) when the Animation will achieve this Node's state
-	AnimNodeBase(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear);
+	/// \param interpolationMethod How the state changes on the way from the previous Node to this one
+	/// \param bezierControlPoints Control points (x1, y1, x2, y2) of the easing curve, used only if `interpolationMethod` is `AnimInterpolationMethod::CubicBezier`
+	AnimNodeBase(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear, const std::array<double, 4>& bezierControlPoints = { 0.25, 0.1, 0.25, 1.0 });
 	virtual ~AnimNodeBase() = 0;
 
 	bool operator<(const AnimNodeBase& rhs)  const noexcept;
@@ -33,8 +37,13 @@ struct AnimNodeBase
 	/// Time point (in milliseconds) when the Animation will achieve this Node's state
 	uint timeStamp = 0;
 
+	/// How the state changes on the way from the previous Node to this one
 	AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear;
 
+	/// Control points (x1, y1, x2, y2) of the easing curve, used only if `interpolationMethod` is `AnimInterpolationMethod::CubicBezier`
+	/// The curve always starts at (0, 0) and ends at (1, 1), `x1` and `x2` need to be in the [0, 1] range
+	std::array<double, 4> bezierControlPoints = { 0.25, 0.1, 0.25, 1.0 };
+
 protected:
 
 public:
@@ -48,17 +57,21 @@ public:
 };
 
 /// Animation Node, which state is an array of `double`
-template<uint dimension>
+template<uint dimensionCount>
 struct AnimNodeDouble final : public AnimNodeBase
 {
 	/// \param timeStamp Time point (in milliseconds) when the Animation will achieve this Node's state
 	/// \param state This state will be reached exactly at `timeStamp` time point
-	AnimNodeDouble(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear, const QVarLengthArray<double, dimension>& state = QVarLengthArray<double, dimension>())
-		: AnimNodeBase(timeStamp, interpolationMethod),
+	/// \param bezierControlPoints Control points (x1, y1, x2, y2) of the easing curve, used only if `interpolationMethod` is `AnimInterpolationMethod::CubicBezier`
+	AnimNodeDouble(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear, const QVarLengthArray<double, dimensionCount>& state = QVarLengthArray<double, dimensionCount>(), const std::array<double, 4>& bezierControlPoints = { 0.25, 0.1, 0.25, 1.0 })
+		: AnimNodeBase(timeStamp, interpolationMethod, bezierControlPoints),
 		state_(state)
 	{
 	}
 
+	static constexpr uint dimension = dimensionCount;
+	using ValueType = double;
+
 	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
 	/// This state will be reached exactly at `timeStamp` time point
 	QVarLengthArray<double, dimension> state_;
@@ -73,8 +86,9 @@ public:
 	{
 		AnimNodeBase::serializableLoad(dataStream);
 
+		state_.resize(dimension);
 		for (uint i = 0u; i != dimension; ++i)
-			dataStream >> state_[dimension];
+			dataStream >> state_[i];
 	}
 	/// Saving an object to a binary file
 	/// \param dataStream Stream (presumably connected to a QFile) to save to
@@ -83,22 +97,26 @@ public:
 		AnimNodeBase::serializableSave(dataStream);
 
 		for (uint i = 0u; i != dimension; ++i)
-			dataStream << state_[dimension];
+			dataStream << state_[i];
 	}
 };
 
 /// Animation Node, which state is an array of `double`
-template<uint dimension>
+template<uint dimensionCount>
 struct AnimNodeLongLong final : public AnimNodeBase
 {
 	/// \param timeStamp Time point (in milliseconds) when the Animation will achieve this Node's state
 	/// \param state This state will be reached exactly at `timeStamp` time point
-	AnimNodeLongLong(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear, const QVarLengthArray<long long, dimension>& state = QVarLengthArray<long long, dimension>())
-		: AnimNodeBase(timeStamp, interpolationMethod),
+	/// \param bezierControlPoints Control points (x1, y1, x2, y2) of the easing curve, used only if `interpolationMethod` is `AnimInterpolationMethod::CubicBezier`
+	AnimNodeLongLong(uint timeStamp = 0, AnimInterpolationMethod interpolationMethod = AnimInterpolationMethod::Linear, const QVarLengthArray<long long, dimensionCount>& state = QVarLengthArray<long long, dimensionCount>(), const std::array<double, 4>& bezierControlPoints = { 0.25, 0.1, 0.25, 1.0 })
+		: AnimNodeBase(timeStamp, interpolationMethod, bezierControlPoints),
 		state_(state)
 	{
 	}
 
+	static constexpr uint dimension = dimensionCount;
+	using ValueType = long long;
+
 	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
 	/// This state will be reached exactly at `timeStamp` time point
 	QVarLengthArray<long long, dimension> state_;
@@ -113,8 +131,9 @@ public:
 	{
 		AnimNodeBase::serializableLoad(dataStream);
 
+		state_.resize(dimension);
 		for (uint i = 0u; i != dimension; ++i)
-			dataStream >> state_[dimension];
+			dataStream >> state_[i];
 	}
 	/// Saving an object to a binary file
 	/// \param dataStream Stream (presumably connected to a QFile) to save to
@@ -123,7 +142,7 @@ public:
 		AnimNodeBase::serializableSave(dataStream);
 
 		for (uint i = 0u; i != dimension; ++i)
-			dataStream << state_[dimension];
+			dataStream << state_[i];
 	}
 };
 
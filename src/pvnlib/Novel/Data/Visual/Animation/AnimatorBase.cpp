@@ -18,4 +18,7 @@
 //  MEMBER_FIELD_SECTION_CHANGE END
 
 //template<typename AnimNode>
-//uint AnimatorBase<AnimNode>::getDuration()
\ No newline at end of file
+//uint AnimatorBase<AnimNode>::getDuration()
+
+//template<typename AnimNode>
+//void AnimatorBase<AnimNode>::buildSegments()
\ No newline at end of file
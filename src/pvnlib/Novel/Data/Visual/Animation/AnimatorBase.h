@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "pvnLib/Novel/Data/Asset/AssetAnim.h"
+#include "pvnLib/Novel/Data/Visual/Animation/AnimInterpolation.h"
 #include "pvnLib/Novel/Data/Visual/Animation/AnimatorInterface.h"
 
 /// \todo Add AssetAnim name
@@ -52,6 +53,7 @@ public:
 	{
 		using std::swap;
 		swap(this->adjustedNodes_, second.adjustedNodes_);
+		swap(this->segments_,      second.segments_);
 		swap(this->currentNode_, second.currentNode_);
 		swap(this->nextNode_, second.nextNode_);
 	}
@@ -64,6 +66,32 @@ protected:
 	/// \todo check if the first Node is necessary to be added
 	std::vector<AnimNode> adjustedNodes_;
 
+	/// Resolved once per pair of consecutive `adjustedNodes_`, so sampling does not need to look at the AnimInterpolationMethod
+	struct Segment
+	{
+		NovelLib::Interpolation::Interpolator<AnimNode> interpolator = nullptr;
+		/// `1 / (nextNode.timeStamp - currentNode.timeStamp)`, 0 for segments without duration
+		double inverseDuration = 0.0;
+	};
+
+	/// Builds `segments_` from `adjustedNodes_`, needs to be called every time `adjustedNodes_` are rebuilt
+	void buildSegments()
+	{
+		segments_.clear();
+		if (adjustedNodes_.size() < 2)
+			return;
+
+		segments_.reserve(adjustedNodes_.size() - 1);
+		for (auto it = adjustedNodes_.cbegin() + 1; it != adjustedNodes_.cend(); ++it)
+		{
+			const uint duration = it->timeStamp - (it - 1)->timeStamp;
+			segments_.push_back(Segment{ NovelLib::Interpolation::selectInterpolator<AnimNode>(it->interpolationMethod), duration != 0 ? 1.0 / duration : 0.0 });
+		}
+	}
+
+	/// `segments_[i]` interpolates from `adjustedNodes_[i]` to `adjustedNodes_[i + 1]`
+	std::vector<Segment> segments_;
+
 	AssetAnim<AnimNode>* const assetAnim_;
 
 	/// Nodes containing current state and next state that we interpolate into
@@ -7,15 +7,23 @@ void swap(AnimatorSceneryObjectFade& first, AnimatorSceneryObjectFade& second) n
 {
 	using std::swap;
 	swap(static_cast<AnimatorSceneryObjectInterface<AnimNodeDouble1D>&>(first), static_cast<AnimatorSceneryObjectInterface<AnimNodeDouble1D>&>(second));
+	swap(first.duration,   second.duration);
+	swap(first.bAppear,    second.bAppear);
+	swap(first.startTime_, second.startTime_);
 }
 
-AnimatorSceneryObjectFade::AnimatorSceneryObjectFade(SceneryObject* const parentSceneryObject, uint priority, uint startDelay, double speed, int timesPlayed, bool bFinishAnimationAtEventEnd)
-	: AnimatorSceneryObjectInterface<AnimNodeDouble1D>(parentSceneryObject, nullptr, priority, startDelay, speed, timesPlayed, bFinishAnimationAtEventEnd)
+AnimatorSceneryObjectFade::AnimatorSceneryObjectFade(SceneryObject* const parentSceneryObject, uint priority, uint startDelay, double speed, int timesPlayed, bool bFinishAnimationAtEventEnd, uint duration, bool bAppear)
+	: AnimatorSceneryObjectInterface<AnimNodeDouble1D>(parentSceneryObject, nullptr, priority, startDelay, speed, timesPlayed, bFinishAnimationAtEventEnd),
+	duration(duration),
+	bAppear(bAppear)
 {
 }
 
 AnimatorSceneryObjectFade::AnimatorSceneryObjectFade(const AnimatorSceneryObjectFade& obj) noexcept
-	: AnimatorSceneryObjectInterface<AnimNodeDouble1D>(obj.parentSceneryObject_, nullptr, obj.priority, obj.startDelay, obj.speed, obj.timesPlayed, obj.bFinishAnimationAtEventEnd)
+	: AnimatorSceneryObjectInterface<AnimNodeDouble1D>(obj.parentSceneryObject_, nullptr, obj.priority, obj.startDelay, obj.speed, obj.timesPlayed, obj.bFinishAnimationAtEventEnd),
+	duration(obj.duration),
+	bAppear(obj.bAppear),
+	startTime_(obj.startTime_)
 {
 }
 
@@ -25,7 +33,9 @@ bool AnimatorSceneryObjectFade::operator==(const AnimatorSceneryObjectFade& obj)
 		return true;
 
 	return AnimatorSceneryObjectInterface<AnimNodeDouble1D>::operator==(obj) &&
-		   parentSceneryObject_ == parentSceneryObject_;
+		   parentSceneryObject_ == parentSceneryObject_                       &&
+		   duration             == obj.duration                               &&
+		   bAppear              == obj.bAppear;
 }
 
 //  MEMBER_FIELD_SECTION_CHANGE END
@@ -2,6 +2,7 @@
 #include "pvnLib/Novel/Data/Visual/Animation/AnimatorSceneryObjectInterface.h"
 
 /// Does the maths behind Fade Animation
+/// It does not use an AssetAnim, the `alphaMultiplier` goes linearly between 0.0 and 1.0 over the `duration`
 class AnimatorSceneryObjectFade final : public AnimatorSceneryObjectInterface<AnimNodeDouble1D>
 {
 	/// Swap trick
@@ -13,7 +14,9 @@ public:
 	/// \param speed Cannot be negative
 	/// \param timesPlayed If set to -1, it will be looped infinitely
 	/// \param bFinishAnimationAtEventEnd Incompatible with `timesPlayed = -1`, but it is possible to place same Animator in subsequent Events and continue Animation without an interruption
-	explicit AnimatorSceneryObjectFade(SceneryObject* const parentSceneryObject, uint priority = 0, uint startDelay = 0, double speed = 1.0, int timesPlayed = 1, bool bFinishAnimationAtEventEnd = false);
+	/// \param duration In milliseconds
+	/// \param bAppear Whether to appear or disappear
+	explicit AnimatorSceneryObjectFade(SceneryObject* const parentSceneryObject, uint priority = 0, uint startDelay = 0, double speed = 1.0, int timesPlayed = 1, bool bFinishAnimationAtEventEnd = false, uint duration = 100, bool bAppear = true);
 	AnimatorSceneryObjectFade(const AnimatorSceneryObjectFade& obj)     noexcept;
 	AnimatorSceneryObjectFade(AnimatorSceneryObjectFade&& obj)          noexcept;
 	AnimatorSceneryObjectFade& operator=(AnimatorSceneryObjectFade obj) noexcept;
@@ -22,5 +25,18 @@ public:
 
 	void run() override;
 	/// Changes transparency of the SceneryObject
+	/// The first call marks the beginning of the Animation
 	bool update(uint elapsedTime) override;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// In milliseconds
+	uint duration = 100;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// Whether to appear or disappear
+	bool bAppear  = true;
+
+private:
+	/// Game clock's time of the first `update()`, -1 before it
+	qint64 startTime_ = -1;
 };
\ No newline at end of file
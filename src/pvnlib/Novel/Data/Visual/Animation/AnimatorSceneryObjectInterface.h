@@ -47,6 +47,7 @@ public:
 			AnimatorBase<AnimNode>::adjustedNodes_.emplace_back(node);
 			AnimatorBase<AnimNode>::adjustedNodes_.back().timeStamp = qRound(AnimatorBase<AnimNode>::adjustedNodes_.back().timeStamp * AnimatorInterface::speed) + offset;
 		}
+		AnimatorBase<AnimNode>::buildSegments();
 		AnimatorBase<AnimNode>::currentNode_ = AnimatorBase<AnimNode>::adjustedNodes_.cbegin();
 		AnimatorBase<AnimNode>::nextNode_ = AnimatorBase<AnimNode>::currentNode_ + 1;
 	}
@@ -72,21 +73,21 @@ public:
 			AnimatorBase<AnimNode>::currentNode_ = AnimatorBase<AnimNode>::adjustedNodes_.cbegin();
 			AnimatorBase<AnimNode>::nextNode_ = AnimatorBase<AnimNode>::currentNode_ + 1;
 		}
+
+		//Move to the segment that contains `elapsedTime`
+		while (AnimatorBase<AnimNode>::nextNode_ != AnimatorBase<AnimNode>::adjustedNodes_.cend() && elapsedTime >= AnimatorBase<AnimNode>::nextNode_->timeStamp)
+		{
+			++AnimatorBase<AnimNode>::currentNode_;
+			++AnimatorBase<AnimNode>::nextNode_;
+		}
+
 		AnimNode ret = *AnimatorBase<AnimNode>::currentNode_;
 
-		if (AnimatorBase<AnimNode>::nextNode_ == AnimatorBase<AnimNode>::adjustedNodes_.cend())
+		if (AnimatorBase<AnimNode>::nextNode_ == AnimatorBase<AnimNode>::adjustedNodes_.cend() || elapsedTime <= AnimatorBase<AnimNode>::currentNode_->timeStamp)
 			return ret;
 
-		double	deltaTime = elapsedTime - AnimatorBase<AnimNode>::currentNode_->timeStamp,
-			duration = AnimatorBase<AnimNode>::nextNode_->timeStamp - AnimatorBase<AnimNode>::currentNode_->timeStamp;
-		switch (AnimatorBase<AnimNode>::nextNode_->interpolationMethod)
-		{
-		case AnimNode::AnimInterpolationMethod::Linear:
-		default:
-			for (uint i = 0; i != (sizeof(ret.state_) / sizeof(ret.state_[0])); ++i)
-				ret.state_[i] += (AnimatorBase<AnimNode>::nextNode_->state_[i] - ret.state_[i]) * (deltaTime / duration);
-			break;
-		}
+		const typename AnimatorBase<AnimNode>::Segment& segment = AnimatorBase<AnimNode>::segments_[AnimatorBase<AnimNode>::currentNode_ - AnimatorBase<AnimNode>::adjustedNodes_.cbegin()];
+		segment.interpolator(*AnimatorBase<AnimNode>::currentNode_, *AnimatorBase<AnimNode>::nextNode_, ret, (elapsedTime - AnimatorBase<AnimNode>::currentNode_->timeStamp) * segment.inverseDuration);
 		return ret;
 	}
 
@@ -19,7 +19,17 @@ bool AnimatorSceneryObjectColor::update(uint elapsedTime)
 
 bool AnimatorSceneryObjectFade::update(uint elapsedTime)
 {
-    return false;
+    if (startTime_ < 0)
+        startTime_ = elapsedTime;
+
+    const qint64 playedTime = elapsedTime - startTime_ - startDelay;
+    if (playedTime < 0)
+        return false;
+
+    const double progress = duration == 0 ? 1.0 : qMin(1.0, playedTime * speed / duration);
+    parentSceneryObject_->alphaMultiplier = bAppear ? progress : 1.0 - progress;
+
+    return progress >= 1.0;
 }
 
 bool AnimatorSceneryObjectMove::update(uint elapsedTime)
@@ -0,0 +1,6 @@
+#pragma once
+
+/// Size of the scene, every SceneryObject is positioned in these coordinates and the SceneWidget scales them to its own size
+/// \todo support other resolutions
+#define RESOLUTION_X 1600.0
+#define RESOLUTION_Y 900.0
@@ -0,0 +1,47 @@
+#include "pvnLib/Novel/Data/Visual/Scenery/ImageFilter.h"
+
+#include <QHash>
+
+//If you add/remove a member field, remember to update these
+//  MEMBER_FIELD_SECTION_CHANGE BEGIN
+
+ImageFilter::ImageFilter(Type type, double intensivness, double strength) noexcept
+	: type(type),
+	intensivness(intensivness),
+	strength(strength)
+{
+}
+
+void ImageFilter::serializableLoad(QDataStream& dataStream)
+{
+	dataStream >> type >> intensivness >> strength;
+}
+
+void ImageFilter::serializableSave(QDataStream& dataStream) const
+{
+	dataStream << type << intensivness << strength;
+}
+
+size_t qHash(const std::vector<ImageFilter>& filters, size_t seed) noexcept
+{
+	for (const ImageFilter& filter : filters)
+		seed = qHashMulti(seed, static_cast<int>(filter.type), filter.intensivness, filter.strength);
+
+	return seed;
+}
+
+//  MEMBER_FIELD_SECTION_CHANGE END
+
+bool ImageFilter::isColorFilter() const noexcept
+{
+	switch (type)
+	{
+	case Type::Brightness:
+	case Type::Hue:
+	case Type::Negative:
+	case Type::Saturation:
+		return true;
+	default:
+		return false;
+	}
+}
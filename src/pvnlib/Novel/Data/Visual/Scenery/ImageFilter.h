@@ -0,0 +1,66 @@
+#pragma once
+#include <QDataStream>
+#include <vector>
+
+#include "pvnLib/Serialization.h"
+
+/// A single step of the filter chain applied to a SceneryObject's image
+/// The chain is evaluated by the widgets only when it changes (see `ImageFilterPipeline`), so the filtered image is not recalculated every frame
+struct ImageFilter
+{
+	enum class Type
+	{
+		GaussianBlur,
+		BoxBlur,
+		Brightness,
+		Dilation,
+		Erosion,
+		Hue,
+		Negative,
+		Saturation
+	};
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// \param type What the ImageFilter does
+	/// \param intensivness How much of the filtered image is blended with the unfiltered one, defined in percentage. Accepted values: 0.0 - 100.0
+	/// \param strength Meaning depends on the `type`:
+	/// - GaussianBlur, BoxBlur, Dilation, Erosion: radius in pixels
+	/// - Brightness: value added to every color channel, where 1.0 turns the image white and -1.0 black
+	/// - Hue: rotation of the hue in degrees
+	/// - Saturation: saturation multiplier, 0.0 makes the image grayscale
+	/// - Negative: unused
+	ImageFilter(Type type = Type::Negative, double intensivness = 100.0, double strength = 1.0) noexcept;
+	bool operator==(const ImageFilter& obj) const noexcept = default;
+	bool operator!=(const ImageFilter& obj) const noexcept = default;
+
+	/// Whether the ImageFilter changes every pixel independently of its neighbours, so it can be expressed as a color matrix and fused with the neighbouring ImageFilters of that kind
+	bool isColorFilter() const noexcept;
+
+	//[Meta] Remember to copy the description to the constructor (and all delegating) parameter description as well, if it changes
+	/// What the ImageFilter does
+	Type type = Type::Negative;
+
+	/// How much of the filtered image is blended with the unfiltered one, defined in percentage
+	/// Accepted values: 0.0 - 100.0
+	double intensivness = 100.0;
+
+	/// Meaning depends on the `type`:
+	/// - GaussianBlur, BoxBlur, Dilation, Erosion: radius in pixels
+	/// - Brightness: value added to every color channel, where 1.0 turns the image white and -1.0 black
+	/// - Hue: rotation of the hue in degrees
+	/// - Saturation: saturation multiplier, 0.0 makes the image grayscale
+	/// - Negative: unused
+	double strength = 1.0;
+
+public:
+	//---SERIALIZATION---
+	/// Loading an object from a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to read from
+	void serializableLoad(QDataStream& dataStream);
+	/// Saving an object to a binary file
+	/// \param dataStream Stream (presumably connected to a QFile) to save to
+	void serializableSave(QDataStream& dataStream) const;
+};
+
+/// \return Hash identifying the whole chain, so the results can be cached per chain
+size_t qHash(const std::vector<ImageFilter>& filters, size_t seed = 0) noexcept;
@@ -21,6 +21,7 @@ void swap(Scenery& first, Scenery& second) noexcept
 {
 	using std::swap;
 	swap(first.backgroundAssetImageName_, second.backgroundAssetImageName_);
+	swap(first.backgroundCameraPos_,      second.backgroundCameraPos_);
 	swap(first.musicPlaylist,             second.musicPlaylist);
 	swap(first.displayedCharacters_,      second.displayedCharacters_);
 	swap(first.displayedSceneryObjects_,  second.displayedSceneryObjects_);
@@ -28,13 +29,14 @@ void swap(Scenery& first, Scenery& second) noexcept
 	swap(first.backgroundAssetImage_,     second.backgroundAssetImage_);
 }
 
-Scenery::Scenery(const Scene* const parentScene, const QString& backgroundAssetImageName, const MusicPlaylist& musicPlaylist, const std::vector<Character>& displayedCharacters, const std::vector<SceneryObject>& displayedSceneryObjects, const std::vector<Sound>& sounds, AssetImage* backgroundAssetImage)
+Scenery::Scenery(const Scene* const parentScene, const QString& backgroundAssetImageName, const MusicPlaylist& musicPlaylist, const std::vector<Character>& displayedCharacters, const std::vector<SceneryObject>& displayedSceneryObjects, const std::vector<Sound>& sounds, const QPointF& backgroundCameraPos, AssetImage* backgroundAssetImage)
 	: parentScene(parentScene),
 	backgroundAssetImageName_(backgroundAssetImageName),
 	musicPlaylist(musicPlaylist), 
 	displayedCharacters_(displayedCharacters), 
 	displayedSceneryObjects_(displayedSceneryObjects), 
 	sounds_(sounds),
+	backgroundCameraPos_(backgroundCameraPos),
 	backgroundAssetImage_(backgroundAssetImage)
 {
 	if (!backgroundAssetImage_)
@@ -49,6 +51,7 @@ Scenery::Scenery(const Scenery& obj) noexcept
 	displayedCharacters_(obj.displayedCharacters_),
 	displayedSceneryObjects_(obj.displayedSceneryObjects_),
 	sounds_(obj.sounds_),
+	backgroundCameraPos_(obj.backgroundCameraPos_),
 	backgroundAssetImage_(obj.backgroundAssetImage_)
 {
 }
@@ -63,6 +66,7 @@ Scenery& Scenery::operator=(const Scenery& obj) noexcept
 	displayedCharacters_      = obj.displayedCharacters_;
 	displayedSceneryObjects_  = obj.displayedSceneryObjects_;
 	sounds_                   = obj.sounds_;
+	backgroundCameraPos_      = obj.backgroundCameraPos_;
 	backgroundAssetImage_     = obj.backgroundAssetImage_;
 
 	return *this;
@@ -77,12 +81,18 @@ bool Scenery::operator==(const Scenery& obj) const noexcept
 		   musicPlaylist             == obj.musicPlaylist             &&
 		   displayedCharacters_      == obj.displayedCharacters_      &&
 		   displayedSceneryObjects_  == obj.displayedSceneryObjects_  &&
-		   sounds_                   == obj.sounds_;
+		   sounds_                   == obj.sounds_                   &&
+		   backgroundCameraPos_      == obj.backgroundCameraPos_;
 }
 
 void Scenery::serializableLoad(QDataStream& dataStream)
 {
+	//Scenes and Saves written before the `backgroundCameraPos_` was added have no version
+	const quint32 version = NovelLib::loadSerializationVersion(dataStream);
 	dataStream >> backgroundAssetImageName_ >> musicPlaylist;
+	backgroundCameraPos_ = QPointF(0.0, 0.0);
+	if (version >= 1)
+		dataStream >> backgroundCameraPos_;
 	uint displayedCharactersSize, displayedSceneryObjectsSize, soundsSize;
 	dataStream >> displayedCharactersSize >> displayedSceneryObjectsSize >> soundsSize;
 	for (uint i = 0; i != displayedCharactersSize; ++i)
@@ -111,7 +121,8 @@ void Scenery::serializableLoad(QDataStream& dataStream)
 
 void Scenery::serializableSave(QDataStream& dataStream) const
 {
-	dataStream << backgroundAssetImageName_ << musicPlaylist;
+	NovelLib::saveSerializationVersion(dataStream, SERIALIZATION_VERSION);
+	dataStream << backgroundAssetImageName_ << musicPlaylist << backgroundCameraPos_;
 	dataStream << static_cast<uint>(displayedCharacters_.size()) << static_cast<uint>(displayedSceneryObjects_.size()) << static_cast<uint>(sounds_.size());
 	for (const Character& character : displayedCharacters_)
 		dataStream << character;
@@ -200,6 +211,16 @@ void Scenery::setBackgroundAssetImage(const QString& backgroundAssetImageName, A
 	errorCheck(true);
 }
 
+QPointF Scenery::getBackgroundCameraPos() const noexcept
+{
+	return backgroundCameraPos_;
+}
+
+void Scenery::setBackgroundCameraPos(const QPointF& backgroundCameraPos) noexcept
+{
+	backgroundCameraPos_ = backgroundCameraPos;
+}
+
 const std::vector<Character>* Scenery::getDisplayedCharacters() const noexcept
 {
 	return &displayedCharacters_;
@@ -14,8 +14,9 @@ class Scenery final
 	friend void swap(Scenery& first, Scenery& second) noexcept;
 public:
 	explicit Scenery(const Scene* const parentScene) noexcept;
+	/// \param backgroundCameraPos Top-left corner of the scene on a background streamed from a TiledImagePack (e.g. a panorama), ignored for the other backgrounds
 	/// \param backgroundAssetImage Copies the AssetImage pointer. It's okay to leave it as nullptr, as it will be loaded later. This is a very minor optimization
-	Scenery(const Scene* const parentScene, const QString& backgroundAssetImageName, const MusicPlaylist& musicPlaylist = MusicPlaylist(), const std::vector<Character>& displayedCharacters = std::vector<Character>(), const std::vector<SceneryObject>& displayedSceneryObjects = std::vector<SceneryObject>(), const std::vector<Sound>& sounds = std::vector<Sound>(), AssetImage* backgroundAssetImage = nullptr);
+	Scenery(const Scene* const parentScene, const QString& backgroundAssetImageName, const MusicPlaylist& musicPlaylist = MusicPlaylist(), const std::vector<Character>& displayedCharacters = std::vector<Character>(), const std::vector<SceneryObject>& displayedSceneryObjects = std::vector<SceneryObject>(), const std::vector<Sound>& sounds = std::vector<Sound>(), const QPointF& backgroundCameraPos = QPointF(0.0, 0.0), AssetImage* backgroundAssetImage = nullptr);
 	Scenery(const Scenery& obj)               noexcept;
 	Scenery(Scenery&& obj)                    noexcept;
 	///This one needs to be optimized at the cost of strong exception safety, as it is frequently assigned during gameplay (so the performance is a priority here)
@@ -38,6 +39,9 @@ public:
 	/// Ensures Assets and Sounds are loaded and if not - loads them
 	void ensureResourcesAreLoaded();
 
+	/// Loads the sprites of the displayed Characters and SceneryObjects and appends them to `sprites`, so they can be packed into a SpriteAtlas
+	void appendSpriteAssetImages(std::vector<const AssetImage*>& sprites);
+
 	void addAnimator(AnimatorSceneryObjectColor&&  animatorColor);
 	void addAnimator(AnimatorSceneryObjectFade&&   animatorFade);
 	void addAnimator(AnimatorSceneryObjectMove&&   animatorMove);
@@ -54,6 +58,10 @@ public:
 	AssetImage*       getBackgroundAssetImage()       noexcept;
 	void setBackgroundAssetImage(const QString& backgroundAssetImageName, AssetImage* backgroundAssetImage = nullptr) noexcept;
 
+	QPointF getBackgroundCameraPos() const noexcept;
+	/// Pans the camera over a background streamed from a TiledImagePack, it is clamped to the background's edges when displayed
+	void setBackgroundCameraPos(const QPointF& backgroundCameraPos) noexcept;
+
 	const std::vector<Character>* getDisplayedCharacters() const noexcept;
 	const Character* getDisplayedCharacter(uint index)     const;
 	Character*       getDisplayedCharacter(uint index);
@@ -124,6 +132,9 @@ private:
 	QString     backgroundAssetImageName_ = "";
 	AssetImage* backgroundAssetImage_     = nullptr;
 
+	/// Top-left corner of the scene on a background streamed from a TiledImagePack, in the scene's units
+	QPointF     backgroundCameraPos_      = { 0.0, 0.0 };
+
 	std::vector<Character>     displayedCharacters_;
 
 	std::vector<SceneryObject> displayedSceneryObjects_;
@@ -132,6 +143,10 @@ private:
 	/// `void update()` should remove already played ones
 	std::vector<Sound> sounds_;
 
+	/// 0 - without the `backgroundCameraPos_`
+	/// 1 - with the `backgroundCameraPos_`
+	static constexpr quint32 SERIALIZATION_VERSION = 1;
+
 public:
 	//---SERIALIZATION---
 	/// Loading an object from a binary file
@@ -15,6 +15,7 @@ void swap(SceneryObject& first, SceneryObject& second) noexcept
 	swap(first.colorMultiplier, second.colorMultiplier);
 	swap(first.alphaMultiplier, second.alphaMultiplier);
 	swap(first.bVisible,        second.bVisible);
+	swap(first.filters,         second.filters);
 	swap(first.assetImage_,     second.assetImage_);
 }
 
@@ -63,13 +64,30 @@ bool SceneryObject::operator==(const SceneryObject& obj) const noexcept
 		   rotationDegree  == obj.rotationDegree  &&
 		   colorMultiplier == obj.colorMultiplier &&
 		   alphaMultiplier == obj.alphaMultiplier && 
-		   bVisible        == obj.bVisible;
+		   bVisible        == obj.bVisible        &&
+		   filters         == obj.filters;
 }
 
 void SceneryObject::serializableLoad(QDataStream& dataStream)
 {
+	//Scenes and Saves written before the `filters` were added have no version
+	const quint32 version = NovelLib::loadSerializationVersion(dataStream);
 	dataStream >> name >> assetImageName_ >> bMirrored >> pos >> scale >> rotationDegree >> colorMultiplier[0] >> colorMultiplier[1] >> colorMultiplier[2] >> colorMultiplier[3] >> alphaMultiplier >> bVisible;
 
+	filters.clear();
+	if (version >= 1)
+	{
+		uint filtersSize;
+		dataStream >> filtersSize;
+		filters.reserve(filtersSize);
+		for (uint i = 0u; i != filtersSize; ++i)
+		{
+			ImageFilter filter;
+			dataStream >> filter;
+			filters.push_back(filter);
+		}
+	}
+
 	if (!assetImageName_.isEmpty())
 		assetImage_ = AssetManager::getInstance().getAssetImageSceneryObject(assetImageName_);
 	SceneryObject::errorCheck();
@@ -77,7 +95,10 @@ void SceneryObject::serializableLoad(QDataStream& dataStream)
 
 void SceneryObject::serializableSave(QDataStream& dataStream) const
 {
-	dataStream << name << assetImageName_ << bMirrored << pos << scale << rotationDegree << colorMultiplier[0] << colorMultiplier[1] << colorMultiplier[2] << colorMultiplier[3] << alphaMultiplier << bVisible;
+	NovelLib::saveSerializationVersion(dataStream, SERIALIZATION_VERSION);
+	dataStream << name << assetImageName_ << bMirrored << pos << scale << rotationDegree << colorMultiplier[0] << colorMultiplier[1] << colorMultiplier[2] << colorMultiplier[3] << alphaMultiplier << bVisible << static_cast<uint>(filters.size());
+	for (const ImageFilter& filter : filters)
+		dataStream << filter;
 }
 
 //  MEMBER_FIELD_SECTION_CHANGE END
@@ -6,6 +6,7 @@
 #include "pvnLib/Novel/Data/Asset/AssetManager.h"
 
 #include "pvnLib/Novel/Data/Visual/Animation/AnimatorAll.h"
+#include "pvnLib/Novel/Data/Visual/Scenery/ImageFilter.h"
 
 /// Holds data for a drawable object
 class SceneryObject : public SceneComponent
@@ -66,6 +67,9 @@ public:
 
 	bool bVisible               = false;
 
+	/// Applied to the image in order, set by the ActionFilters
+	std::vector<ImageFilter> filters;
+
 	//todo: do not botch
 	QString getComponentTypeName()        const noexcept override;
 	QString getComponentSubTypeName()     const noexcept override;
@@ -92,6 +96,10 @@ protected:
 private:
 	bool errorChecked = false;
 
+	/// 0 - without the `filters`
+	/// 1 - with the `filters`
+	static constexpr quint32 SERIALIZATION_VERSION = 1;
+
 public:
 	//---SERIALIZATION---
 	/// Loading an object from a binary file
@@ -10,7 +10,15 @@ void Scenery::render(SceneWidget* sceneWidget) const
 	{
 		Novel& novel = Novel::getInstance();
 		if (backgroundAssetImage_)
-			emit novel.pendBackgroundDisplay(backgroundAssetImage_->getImage());
+		{
+			if (backgroundAssetImage_->getTiledImagePack())
+			{
+				emit novel.pendTiledBackgroundDisplay(backgroundAssetImage_->getTiledImagePack());
+				emit novel.pendBackgroundCameraMove(backgroundCameraPos_);
+			}
+			else
+				emit novel.pendBackgroundDisplay(backgroundAssetImage_->getImage());
+		}
 
 		emit novel.pendSceneryObjectsDisplay(displayedSceneryObjects_);
 
@@ -1,5 +1,7 @@
 #include "pvnLib/Novel/Data/Visual/Scenery/Scenery.h"
 
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
+
 void SceneryObject::ensureResourcesAreLoaded()
 {
 	if (!assetImage_)
@@ -9,6 +11,8 @@ void SceneryObject::ensureResourcesAreLoaded()
 		qCritical() << NovelLib::ErrorType::AssetImageMissing << "Sprite AssetImage \"" + assetImageName_ + "\" does not exist. Definition file might be corrupted";
 		return;
 	}
+	//The sprite is never displayed larger than this, so there is no need to decode more pixels
+	assetImage_->requestDisplayScale(qMax(qAbs(scale.width()), qAbs(scale.height())));
 	if (!assetImage_->isLoaded())
 		assetImage_->load();
 }
@@ -26,6 +30,27 @@ void Scenery::ensureResourcesAreLoaded()
 		if (!sound.isLoaded())
 			sound.load();
 
+	//Background is stretched over the whole scene
+	backgroundAssetImage_->setDisplaySize(QSizeF(RESOLUTION_X, RESOLUTION_Y).toSize());
 	if (!backgroundAssetImage_->isLoaded())
 		backgroundAssetImage_->load();
+}
+
+void Scenery::appendSpriteAssetImages(std::vector<const AssetImage*>& sprites)
+{
+	sprites.reserve(sprites.size() + displayedCharacters_.size() + displayedSceneryObjects_.size());
+
+	for (Character& character : displayedCharacters_)
+	{
+		character.ensureResourcesAreLoaded();
+		if (character.getAssetImage())
+			sprites.push_back(character.getAssetImage());
+	}
+
+	for (SceneryObject& sceneryObject : displayedSceneryObjects_)
+	{
+		sceneryObject.ensureResourcesAreLoaded();
+		if (sceneryObject.getAssetImage())
+			sprites.push_back(sceneryObject.getAssetImage());
+	}
 }
\ No newline at end of file
@@ -72,6 +72,34 @@ Event::Event(Scene* const parentScene, const QString& label, const std::vector<s
 			clone = new ActionSetBackground(this);
 			*static_cast<ActionSetBackground*>(clone) = *(static_cast<ActionSetBackground*>(action.get()));
 			break;
+		case NovelLib::SerializationID::ActionFilterBlur:
+			clone = new ActionFilterBlur(this);
+			*static_cast<ActionFilterBlur*>(clone) = *(static_cast<ActionFilterBlur*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterBrightness:
+			clone = new ActionFilterBrightness(this);
+			*static_cast<ActionFilterBrightness*>(clone) = *(static_cast<ActionFilterBrightness*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterDilation:
+			clone = new ActionFilterDilation(this);
+			*static_cast<ActionFilterDilation*>(clone) = *(static_cast<ActionFilterDilation*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterErosion:
+			clone = new ActionFilterErosion(this);
+			*static_cast<ActionFilterErosion*>(clone) = *(static_cast<ActionFilterErosion*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterHue:
+			clone = new ActionFilterHue(this);
+			*static_cast<ActionFilterHue*>(clone) = *(static_cast<ActionFilterHue*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterNegative:
+			clone = new ActionFilterNegative(this);
+			*static_cast<ActionFilterNegative*>(clone) = *(static_cast<ActionFilterNegative*>(action.get()));
+			break;
+		case NovelLib::SerializationID::ActionFilterSaturation:
+			clone = new ActionFilterSaturation(this);
+			*static_cast<ActionFilterSaturation*>(clone) = *(static_cast<ActionFilterSaturation*>(action.get()));
+			break;
 		default:
 			qCritical() << NovelLib::ErrorType::General << "Invalid Action's type" << static_cast<int>(action->getType());
 			continue;
@@ -129,6 +157,27 @@ void Event::serializableLoad(QDataStream& dataStream)
 		case NovelLib::SerializationID::ActionSetBackground:
 			action = new ActionSetBackground(this);
 			break;
+		case NovelLib::SerializationID::ActionFilterBlur:
+			action = new ActionFilterBlur(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterBrightness:
+			action = new ActionFilterBrightness(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterDilation:
+			action = new ActionFilterDilation(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterErosion:
+			action = new ActionFilterErosion(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterHue:
+			action = new ActionFilterHue(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterNegative:
+			action = new ActionFilterNegative(this);
+			break;
+		case NovelLib::SerializationID::ActionFilterSaturation:
+			action = new ActionFilterSaturation(this);
+			break;
 		default:
 			qCritical() << NovelLib::ErrorType::General << "Invalid Action's type" << static_cast<int>(type);
 			continue;
@@ -1,6 +1,6 @@
 #include "pvnLib/Novel/Event/EventChoice.h"
 
-#include "pvnLib/Novel/Data/Scene.h"
+#include "pvnLib/Novel/Data/Novel.h"
 #include "pvnLib/Helpers.h"
 
 EventChoice::EventChoice(Scene* const parentScene) noexcept
@@ -136,47 +136,71 @@ Choice* EventChoice::getChoice(uint index)
 
 const std::vector<Choice>* EventChoice::setChoices(const std::vector<Choice>& choices) noexcept
 {
-	return &(choices_ = choices);
+	choices_ = choices;
+	choicesChanged();
+	return &choices_;
 }
 
 const std::vector<Choice>* EventChoice::setChoices(std::vector<Choice>&& choices) noexcept
 {
-	return &(choices = std::move(choices));
+	choices_ = std::move(choices);
+	choicesChanged();
+	return &choices_;
 }
 
 Choice* EventChoice::addChoice(const Choice& choice)
 {
-	return NovelLib::Helpers::itToPtr(NovelLib::Helpers::listAdd(choices_, choice, "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	Choice* changedChoice = NovelLib::Helpers::itToPtr(NovelLib::Helpers::listAdd(choices_, choice, "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	choicesChanged();
+	return changedChoice;
 }
 
 Choice* EventChoice::addChoice(Choice&& choice)
 {
-	return NovelLib::Helpers::itToPtr(NovelLib::Helpers::listAdd(choices_, std::move(choice), "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	Choice* changedChoice = NovelLib::Helpers::itToPtr(NovelLib::Helpers::listAdd(choices_, std::move(choice), "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	choicesChanged();
+	return changedChoice;
 }
 
 Choice* EventChoice::insertChoice(uint index, const Choice& choice)
 {
-	return NovelLib::Helpers::itToPtr(NovelLib::Helpers::listInsert(choices_, index, choice, "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	Choice* changedChoice = NovelLib::Helpers::itToPtr(NovelLib::Helpers::listInsert(choices_, index, choice, "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	choicesChanged();
+	return changedChoice;
 }
 
 Choice* EventChoice::insertChoice(uint index, Choice&& choice)
 {
-	return NovelLib::Helpers::itToPtr(NovelLib::Helpers::listInsert(choices_, index, std::move(choice), "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	Choice* changedChoice = NovelLib::Helpers::itToPtr(NovelLib::Helpers::listInsert(choices_, index, std::move(choice), "Choice", NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	choicesChanged();
+	return changedChoice;
 }
 
 Choice* EventChoice::reinsertChoice(uint index, uint newIndex)
 {
-	return NovelLib::Helpers::itToPtr(NovelLib::Helpers::listReinsert(choices_, index, newIndex, "Choice", NovelLib::ErrorType::ChoiceMissing, NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	Choice* changedChoice = NovelLib::Helpers::itToPtr(NovelLib::Helpers::listReinsert(choices_, index, newIndex, "Choice", NovelLib::ErrorType::ChoiceMissing, NovelLib::ErrorType::ChoiceInvalid, "Event", QString::number(getIndex()), "Scene", parentScene->name));
+	choicesChanged();
+	return changedChoice;
 }
 
 bool EventChoice::removeChoice(uint index)
 {
-	return NovelLib::Helpers::listRemove(choices_, index, "Choice", NovelLib::ErrorType::ChoiceMissing, "Event", QString::number(getIndex()), "Scene", parentScene->name);
+	if (!NovelLib::Helpers::listRemove(choices_, index, "Choice", NovelLib::ErrorType::ChoiceMissing, "Event", QString::number(getIndex()), "Scene", parentScene->name))
+		return false;
+	choicesChanged();
+	return true;
 }
 
 void EventChoice::clearChoices() noexcept
 {
 	choices_.clear();
+	choicesChanged();
+}
+
+void EventChoice::choicesChanged()
+{
+	if (parentScene)
+		Novel::getInstance().sceneChanged(*parentScene);
 }
 
 void EventChoice::acceptVisitor(EventVisitor* visitor)
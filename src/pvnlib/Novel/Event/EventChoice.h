@@ -69,6 +69,9 @@ private:
 	/// Needed for Serialization, to know the class of an object before the loading performed
 	NovelLib::SerializationID getType() const noexcept override;
 
+	/// Lets the Novel know the Choices (or their order) have changed, so it updates its JumpIndex and marks the Scene dirty
+	void choicesChanged();
+
 	/// A function pointer that is called (if not nullptr) after the EventChoice's `void run()` allowing for data read. Consts are safe to be casted to non-consts, they are there to indicate you should not do that, unless you have a very reason for it
 	std::function<void(const Scene* const parentScene, const QString& label, const Translation* const translation, const std::vector<Choice>* const choices)> onRun_ = nullptr;
 
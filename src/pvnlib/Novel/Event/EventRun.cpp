@@ -1,6 +1,8 @@
 #include "pvnLib/Novel/Event/EventAll.h"
 #include "pvnLib/Novel/Data/Novel.h"
 
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+
 void Event::run()
 {
 	Novel&          novel       = Novel::getInstance();
@@ -21,6 +23,9 @@ void Event::end()
 {
 	for (std::shared_ptr<Action>& action : actions_)
 		action->end();
+
+	//Sounds that don't persist to a new Event are cut
+	AudioEngine::getInstance().stopSounds(false);
 }
 
 void Event::update()
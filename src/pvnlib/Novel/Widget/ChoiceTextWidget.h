@@ -1,6 +1,8 @@
 #pragma once
 #include <QGraphicsWidget>
-#include <QFont>
+#include <memory>
+
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
 
 class ChoiceTextWidget : public QGraphicsWidget
 {
@@ -12,6 +14,9 @@ public:
 
 	void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
 
+	/// Rebinds a pooled ChoiceTextWidget to another Choice
+	void setChoice(uint index, const QString& text, double width);
+
 	QString text;
 
 signals:
@@ -26,5 +31,5 @@ private:
 
 	bool bHover_ = false;
 
-	QFont font_  = QFont("Fantasque Sans Mono", 24);
+	std::shared_ptr<const FontRegistry::Font> font_ = FontRegistry::getInstance().getFont("Fantasque Sans Mono", 24);
 };
@@ -2,28 +2,14 @@
 
 #include <QPainter>
 
-#define RESOLUTION_X 1600.0
-#define RESOLUTION_Y 900.0
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
+
 #define WIDTH RESOLUTION_X * 0.44
 
-ChoiceWidget::ChoiceWidget(QGraphicsScene* scene, const QString& menuText, const std::vector<Choice>& choices, bool bPreview)
+ChoiceWidget::ChoiceWidget(bool bPreview)
 	: QGraphicsWidget(),
-	menuText_(menuText),
 	bPreview_(bPreview)
 {
-	if (choices.size() <= 0)
-	{
-		qCritical() << NovelLib::ErrorType::ChoiceInvalid << "Cannot construct a ChoiceWidget without Choices";
-		return;
-	}
-
-	font_.setStyleHint(QFont::Helvetica, QFont::PreferAntialias);
-	QFontMetrics metrics(font_);
-	QRectF textRect = metrics.boundingRect(QRect(0, 0, static_cast<uint>(WIDTH - 16.0), RESOLUTION_Y), Qt::TextWordWrap, menuText_);
-	height_         = textRect.height();
-
-	setMinimumSize(textRect.width() + 16.0, height_);
-
 	//todo: not supported yet
 	/*if (preview_)
 	{
@@ -32,24 +18,57 @@ ChoiceWidget::ChoiceWidget(QGraphicsScene* scene, const QString& menuText, const
 		setFlag(ItemSendsGeometryChanges);
 	}*/
 
-	NovelSettings& novelSettings = NovelSettings::getInstance();
-
 	layout_ = new QGraphicsLinearLayout(Qt::Vertical);
-	layout_->setContentsMargins(8, height_ + 40, 8, 8);
 	layout_->setSpacing(32);
-
-	uint index = 0;
-	for (const Choice& choice : choices)
-	{
-		ChoiceTextWidget* choiceTextWidget = new ChoiceTextWidget(index++, choice.translation.text(), textRect.width());
-		choices_.push_back(choiceTextWidget);
-		layout_->addItem(choiceTextWidget);
-		connect(choiceTextWidget, &ChoiceTextWidget::chosen, this, &ChoiceWidget::chosen);
-	}
 	setLayout(layout_);
 
 	drawPen_.setColor(QColor(80, 88, 167, 255));
 	drawPen_.setWidth(2);
+	hide();
+}
+
+void ChoiceWidget::setChoices(const QString& menuText, const std::vector<Choice>& choices)
+{
+	if (choices.size() <= 0)
+	{
+		qCritical() << NovelLib::ErrorType::ChoiceInvalid << "Cannot display a ChoiceWidget without Choices";
+		hide();
+		return;
+	}
+
+	menuText_ = menuText;
+
+	QRectF textRect = font_->metrics.boundingRect(QRectF(0.0, 0.0, WIDTH - 16.0, RESOLUTION_Y), Qt::TextWordWrap, menuText_);
+	height_         = textRect.height();
+
+	setMinimumSize(textRect.width() + 16.0, height_);
+	layout_->setContentsMargins(8, height_ + 40, 8, 8);
+
+	while (layout_->count() > 0)
+		layout_->removeAt(layout_->count() - 1);
+
+	for (uint index = 0; index != choices.size(); ++index)
+	{
+		if (index < choices_.size())
+			choices_[index]->setChoice(index, choices[index].translation.text(), textRect.width());
+		else
+		{
+			ChoiceTextWidget* choiceTextWidget = new ChoiceTextWidget(index, choices[index].translation.text(), textRect.width());
+			//Parented right away, so it's deleted with the ChoiceWidget even when it's not in the layout
+			choiceTextWidget->setParentItem(this);
+			connect(choiceTextWidget, &ChoiceTextWidget::chosen, this, &ChoiceWidget::chosen);
+			choices_.push_back(choiceTextWidget);
+		}
+		choices_[index]->show();
+		layout_->addItem(choices_[index]);
+	}
+	for (size_t index = choices.size(); index < choices_.size(); ++index)
+		choices_[index]->hide();
+
+	//The previous menu might have been bigger
+	adjustSize();
+	show();
+	update();
 }
 
 void ChoiceWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
@@ -59,7 +78,7 @@ void ChoiceWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
 	painter->setBrush(QColor(50, 48, 97, 210));
 	painter->drawRoundedRect(0, 0, rect().width(), rect().height(), 8.0, 8.0);
 	painter->setPen(QColor(255, 249, 208, 255));
-	painter->setFont(font_);
+	painter->setFont(font_->font);
 	QTextOption options;
 	options.setAlignment(Qt::AlignCenter);
 	painter->drawText(QRectF(8.0, 8.0, rect().width() - 16.0, height_), menuText_, options);
@@ -5,13 +5,15 @@
 #include <QPen>
 
 #include "pvnLib/Novel/Data/Text/Choice.h"
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
 #include "pvnLib/Novel/Widget/ChoiceTextWidget.h"
 
 class ChoiceWidget : public QGraphicsWidget
 {
 	Q_OBJECT
 public:
-	ChoiceWidget(QGraphicsScene* scene, const QString& menuText, const std::vector<Choice>& choices, bool bPreview = false);
+	/// Creates an empty and hidden ChoiceWidget, which is reused for every Choice menu (see `setChoices()`)
+	explicit ChoiceWidget(bool bPreview = false);
 	ChoiceWidget(const ChoiceWidget&)            = delete;
 	ChoiceWidget& operator=(const ChoiceWidget&) = delete;
 
@@ -21,6 +23,10 @@ public:
 
 	void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
 
+	/// Rebinds the ChoiceWidget to another menu and shows it
+	/// ChoiceTextWidgets are pooled: the existing ones are rebound, new ones are created only if there are more Choices than ever before
+	void setChoices(const QString& menuText, const std::vector<Choice>& choices);
+
 signals:
 	void chosen(uint choiceID);
 
@@ -29,10 +35,11 @@ private:
 	void resizeEvent(QGraphicsSceneResizeEvent* event) override;
 
 	QString menuText_;
-	QFont   font_ = QFont("Fantasque Sans Mono", 40);
+	std::shared_ptr<const FontRegistry::Font> font_ = FontRegistry::getInstance().getFont("Fantasque Sans Mono", 40);
 
 	uint height_ = 0;
 
+	/// All the ChoiceTextWidgets ever created, only the ones needed by the current menu are in the layout
 	std::vector<ChoiceTextWidget *> choices_;
 
 	QGraphicsLinearLayout* layout_ = nullptr;
@@ -2,23 +2,21 @@
 
 #include <QPainter>
 
-#define RESOLUTION_X 1600.0
-#define RESOLUTION_Y 900.0
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
+
 #define WIDTH RESOLUTION_X * 0.75
 
 DisplayNameWidget::DisplayNameWidget(const QString& text)
 	: text(text)
 {
-	font_.setStyleHint(QFont::Helvetica, QFont::PreferAntialias);
-	QFontMetrics metrics(font_);
-	setMinimumSize(WIDTH, metrics.height());
+	setMinimumSize(WIDTH, font_->metrics.height());
 }
 
 void DisplayNameWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
 	painter->setPen(QColor(225, 209, 168, 210));
 	painter->setRenderHint(QPainter::Antialiasing);
-	painter->setFont(font_);
+	painter->setFont(font_->font);
 
 	QTextOption options;
 	options.setAlignment(Qt::AlignVCenter);
@@ -1,6 +1,8 @@
 #pragma once
 #include <QGraphicsWidget>
-#include <QFont>
+#include <memory>
+
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
 
 class DisplayNameWidget final : public QGraphicsWidget
 {
@@ -14,5 +16,5 @@ public:
 	QString text;
 
 private:
-	QFont font_ = QFont("Fantasque Sans Mono", 40, -1, true);
+	std::shared_ptr<const FontRegistry::Font> font_ = FontRegistry::getInstance().getFont("Fantasque Sans Mono", 40, false, true);
 };
@@ -2,23 +2,68 @@
 
 #include <QPainter>
 
-#define RESOLUTION_X 1600.0
-#define RESOLUTION_Y 900.0
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
+
 #define WIDTH RESOLUTION_X * 0.75
 #define ADDITIONAL_LINES 5
 
-DisplayTextWidget::DisplayTextWidget(const QString& text)
-	: text(text)
+//Text starts a bit to the right of the widget's left edge
+#define TEXT_ORIGIN QPointF(8.0, 0.0)
+
+DisplayTextWidget::DisplayTextWidget()
+{
+	setMinimumSize(WIDTH, font_->metrics.height() + font_->metrics.lineSpacing() * ADDITIONAL_LINES);
+}
+
+void DisplayTextWidget::setTexts(const std::vector<QString>& texts)
 {
-	font_.setStyleHint(QFont::Helvetica, QFont::PreferAntialias);
-	QFontMetrics metrics(font_);
-	setMinimumSize(WIDTH, metrics.height() + metrics.lineSpacing() * ADDITIONAL_LINES);
+	texts_.clear();
+	texts_.reserve(texts.size());
+	for (const QString& text : texts)
+		texts_.push_back(std::make_unique<RevealedText>(text, font_->font, WIDTH - TEXT_ORIGIN.x()));
+	textIndex_      = 0;
+	revealedLength_ = 0;
+	update();
 }
 
 void DisplayTextWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
+	if (textIndex_ >= texts_.size())
+		return;
+
 	painter->setPen(QColor(225, 209, 168, 235));
 	painter->setRenderHint(QPainter::Antialiasing);
-	painter->setFont(font_);
-	painter->drawText(QRectF(8.0, 0.0, rect().width() - 8.0, rect().height()), text);
-}
\ No newline at end of file
+	texts_[textIndex_]->draw(painter, TEXT_ORIGIN, revealedLength_);
+}
+
+void DisplayTextWidget::showText(uint index)
+{
+	textIndex_      = index;
+	revealedLength_ = 0;
+	update();
+}
+
+void DisplayTextWidget::setRevealedLength(int revealedLength)
+{
+	if (textIndex_ >= texts_.size())
+		return;
+
+	revealedLength = qBound(0, revealedLength, texts_[textIndex_]->length());
+	if (revealedLength == revealedLength_)
+		return;
+
+	const QRectF changedRect = texts_[textIndex_]->charactersRect(qMin(revealedLength, revealedLength_), qMax(revealedLength, revealedLength_));
+	revealedLength_ = revealedLength;
+	update(changedRect.translated(TEXT_ORIGIN));
+}
+
+void DisplayTextWidget::revealAll()
+{
+	if (textIndex_ < texts_.size())
+		setRevealedLength(texts_[textIndex_]->length());
+}
+
+int DisplayTextWidget::getRevealedLength() const noexcept
+{
+	return revealedLength_;
+}
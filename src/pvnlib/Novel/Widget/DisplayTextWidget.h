@@ -1,17 +1,33 @@
 #pragma once
 #include <QGraphicsWidget>
+#include <memory>
+#include <vector>
+
+#include "pvnLib/Novel/Data/Text/FontRegistry.h"
+#include "pvnLib/Novel/Widget/RevealedText.h"
 
 class DisplayTextWidget : public QGraphicsWidget
 {
 public:
-	explicit DisplayTextWidget(const QString& text);
+	DisplayTextWidget();
 	DisplayTextWidget(const DisplayTextWidget&)            = delete;
 	DisplayTextWidget& operator=(const DisplayTextWidget&) = delete;
 
 	void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
 
-	QString text;
+	/// Lays out all the texts at once, so revealing them later does not need any shaping
+	void setTexts(const std::vector<QString>& texts);
+	/// Switches to another text, with nothing revealed yet
+	void showText(uint index);
+	/// Reveals the first `revealedLength` characters of the shown text, only the newly revealed part is repainted
+	void setRevealedLength(int revealedLength);
+	void revealAll();
+	int getRevealedLength() const noexcept;
 
 private:
-	QFont font_ = QFont("Fantasque Sans Mono", 24);
+	std::shared_ptr<const FontRegistry::Font> font_ = FontRegistry::getInstance().getFont("Fantasque Sans Mono", 24);
+
+	std::vector<std::unique_ptr<RevealedText>> texts_;
+	uint textIndex_      = 0;
+	int  revealedLength_ = 0;
 };
@@ -0,0 +1,353 @@
+#include "pvnLib/Novel/Widget/ImageFilterPipeline.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <QtMath>
+
+namespace
+{
+	/// Affine color transformation of a premultiplied pixel: rgb' = matrix * rgb + offset * alpha
+	/// Since the offset is scaled by alpha, the transformation gives the same result as if it was applied to the unpremultiplied color
+	struct ColorMatrix
+	{
+		std::array<std::array<double, 3>, 3> matrix = { { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } } };
+		std::array<double, 3> offset = { 0.0, 0.0, 0.0 };
+
+		/// \return ColorMatrix that applies `this` first and `next` afterwards
+		ColorMatrix then(const ColorMatrix& next) const noexcept
+		{
+			ColorMatrix result;
+			for (int row = 0; row != 3; ++row)
+			{
+				for (int column = 0; column != 3; ++column)
+				{
+					result.matrix[row][column] = 0.0;
+					for (int i = 0; i != 3; ++i)
+						result.matrix[row][column] += next.matrix[row][i] * matrix[i][column];
+				}
+
+				result.offset[row] = next.offset[row];
+				for (int i = 0; i != 3; ++i)
+					result.offset[row] += next.matrix[row][i] * offset[i];
+			}
+			return result;
+		}
+
+		/// \return ColorMatrix blended with the identity, `weight` of 1.0 leaves it unchanged
+		ColorMatrix weighted(double weight) const noexcept
+		{
+			ColorMatrix result;
+			for (int row = 0; row != 3; ++row)
+			{
+				for (int column = 0; column != 3; ++column)
+					result.matrix[row][column] += (matrix[row][column] - result.matrix[row][column]) * weight;
+				result.offset[row] = offset[row] * weight;
+			}
+			return result;
+		}
+	};
+
+	ColorMatrix colorMatrix(const ImageFilter& filter) noexcept
+	{
+		ColorMatrix result;
+		switch (filter.type)
+		{
+		case ImageFilter::Type::Brightness:
+			result.offset = { filter.strength, filter.strength, filter.strength };
+			break;
+		case ImageFilter::Type::Negative:
+			result.matrix = { { { -1.0, 0.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, 0.0, -1.0 } } };
+			result.offset = { 1.0, 1.0, 1.0 };
+			break;
+		case ImageFilter::Type::Saturation:
+		{
+			//Same luminance weights as the SVG's feColorMatrix
+			const double s = filter.strength;
+			result.matrix = { { { 0.213 + 0.787 * s, 0.715 - 0.715 * s, 0.072 - 0.072 * s },
+								{ 0.213 - 0.213 * s, 0.715 + 0.285 * s, 0.072 - 0.072 * s },
+								{ 0.213 - 0.213 * s, 0.715 - 0.715 * s, 0.072 + 0.928 * s } } };
+			break;
+		}
+		case ImageFilter::Type::Hue:
+		{
+			const double c = std::cos(qDegreesToRadians(filter.strength)),
+						 s = std::sin(qDegreesToRadians(filter.strength));
+			result.matrix = { { { 0.213 + c * 0.787 - s * 0.213, 0.715 - c * 0.715 - s * 0.715, 0.072 - c * 0.072 + s * 0.928 },
+								{ 0.213 - c * 0.213 + s * 0.143, 0.715 + c * 0.285 + s * 0.140, 0.072 - c * 0.072 - s * 0.283 },
+								{ 0.213 - c * 0.213 - s * 0.787, 0.715 - c * 0.715 + s * 0.715, 0.072 + c * 0.928 + s * 0.072 } } };
+			break;
+		}
+		default:
+			break;
+		}
+		return result.weighted(filter.intensivness / 100.0);
+	}
+
+	/// Single pass over the pixels, in 20.12 fixed-point arithmetic
+	void applyColorMatrix(QImage& image, const ColorMatrix& colorMatrix)
+	{
+		constexpr int SHIFT = 12,
+					  ROUND = 1 << (SHIFT - 1);
+
+		std::array<std::array<int, 4>, 3> k;
+		for (int row = 0; row != 3; ++row)
+		{
+			for (int column = 0; column != 3; ++column)
+				k[row][column] = static_cast<int>(std::lround(colorMatrix.matrix[row][column] * (1 << SHIFT)));
+			k[row][3] = static_cast<int>(std::lround(colorMatrix.offset[row] * (1 << SHIFT)));
+		}
+
+		const int width = image.width();
+		for (int y = 0; y != image.height(); ++y)
+		{
+			QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+			for (int x = 0; x != width; ++x)
+			{
+				const int a = qAlpha(line[x]),
+						  r = qRed(line[x]),
+						  g = qGreen(line[x]),
+						  b = qBlue(line[x]);
+				//Premultiplied channels cannot exceed alpha
+				const int outR = qBound(0, (k[0][0] * r + k[0][1] * g + k[0][2] * b + k[0][3] * a + ROUND) >> SHIFT, a),
+						  outG = qBound(0, (k[1][0] * r + k[1][1] * g + k[1][2] * b + k[1][3] * a + ROUND) >> SHIFT, a),
+						  outB = qBound(0, (k[2][0] * r + k[2][1] * g + k[2][2] * b + k[2][3] * a + ROUND) >> SHIFT, a);
+				line[x] = qRgba(outR, outG, outB, a);
+			}
+		}
+	}
+
+	/// Sliding window sum along the row, the pixels outside of the image are transparent
+	void boxBlurHorizontal(const QImage& source, QImage& destination, int radius)
+	{
+		const int  width = source.width();
+		const uint scale = (1u << 16) / (2 * radius + 1);
+		for (int y = 0; y != source.height(); ++y)
+		{
+			const uchar* sourceLine      = source.constScanLine(y);
+			uchar*       destinationLine = destination.scanLine(y);
+
+			uint sum[4] = { 0u, 0u, 0u, 0u };
+			for (int x = 0; x <= radius && x < width; ++x)
+				for (int channel = 0; channel != 4; ++channel)
+					sum[channel] += sourceLine[x * 4 + channel];
+
+			for (int x = 0; x != width; ++x)
+			{
+				for (int channel = 0; channel != 4; ++channel)
+					destinationLine[x * 4 + channel] = static_cast<uchar>((sum[channel] * scale + (1u << 15)) >> 16);
+
+				if (x + radius + 1 < width)
+					for (int channel = 0; channel != 4; ++channel)
+						sum[channel] += sourceLine[(x + radius + 1) * 4 + channel];
+				if (x - radius >= 0)
+					for (int channel = 0; channel != 4; ++channel)
+						sum[channel] -= sourceLine[(x - radius) * 4 + channel];
+			}
+		}
+	}
+
+	/// Sliding window of rows, every operation works on whole rows, which is friendly to both the cache and the vectorizer
+	void boxBlurVertical(const QImage& source, QImage& destination, int radius)
+	{
+		const int  height = source.height(),
+				   count  = source.width() * 4;
+		const uint scale  = (1u << 16) / (2 * radius + 1);
+
+		std::vector<uint> sums(count, 0u);
+		for (int y = 0; y <= radius && y < height; ++y)
+		{
+			const uchar* line = source.constScanLine(y);
+			for (int i = 0; i != count; ++i)
+				sums[i] += line[i];
+		}
+
+		for (int y = 0; y != height; ++y)
+		{
+			uchar* destinationLine = destination.scanLine(y);
+			for (int i = 0; i != count; ++i)
+				destinationLine[i] = static_cast<uchar>((sums[i] * scale + (1u << 15)) >> 16);
+
+			if (y + radius + 1 < height)
+			{
+				const uchar* line = source.constScanLine(y + radius + 1);
+				for (int i = 0; i != count; ++i)
+					sums[i] += line[i];
+			}
+			if (y - radius >= 0)
+			{
+				const uchar* line = source.constScanLine(y - radius);
+				for (int i = 0; i != count; ++i)
+					sums[i] -= line[i];
+			}
+		}
+	}
+
+	void boxBlur(QImage& image, QImage& buffer, int radius)
+	{
+		if (radius <= 0)
+			return;
+
+		boxBlurHorizontal(image, buffer, radius);
+		boxBlurVertical(buffer, image, radius);
+	}
+
+	/// Three box blurs, which sizes are chosen to approximate a Gaussian with the standard deviation of half the radius
+	void gaussianBlur(QImage& image, QImage& buffer, double radius)
+	{
+		constexpr int PASSES = 3;
+
+		const double sigma      = radius / 2.0;
+		const double idealWidth = std::sqrt(12.0 * sigma * sigma / PASSES + 1.0);
+		int lowerWidth = static_cast<int>(idealWidth);
+		if (lowerWidth % 2 == 0)
+			--lowerWidth;
+		const int upperWidth = lowerWidth + 2;
+		const int lowerCount = static_cast<int>(std::lround((12.0 * sigma * sigma - PASSES * lowerWidth * lowerWidth - 4.0 * PASSES * lowerWidth - 3.0 * PASSES) / (-4.0 * lowerWidth - 4.0)));
+
+		for (int pass = 0; pass != PASSES; ++pass)
+			boxBlur(image, buffer, ((pass < lowerCount ? lowerWidth : upperWidth) - 1) / 2);
+	}
+
+	/// Maximum (Dilation) or minimum (Erosion) of every channel in a square window, only the pixels inside the image are considered
+	template<bool bDilation>
+	void morphology(QImage& image, QImage& buffer, int radius)
+	{
+		if (radius <= 0)
+			return;
+
+		auto pick = [](uchar lhs, uchar rhs) { return bDilation ? qMax(lhs, rhs) : qMin(lhs, rhs); };
+
+		const int width  = image.width(),
+				  height = image.height(),
+				  count  = width * 4;
+		for (int y = 0; y != height; ++y)
+		{
+			const uchar* sourceLine      = image.constScanLine(y);
+			uchar*       destinationLine = buffer.scanLine(y);
+			for (int x = 0; x != width; ++x)
+			{
+				const int first = qMax(0, x - radius) * 4,
+						  last  = qMin(width - 1, x + radius) * 4;
+				for (int channel = 0; channel != 4; ++channel)
+				{
+					uchar value = sourceLine[first + channel];
+					for (int i = first + 4 + channel; i <= last + channel; i += 4)
+						value = pick(value, sourceLine[i]);
+					destinationLine[x * 4 + channel] = value;
+				}
+			}
+		}
+
+		for (int y = 0; y != height; ++y)
+		{
+			uchar* destinationLine = image.scanLine(y);
+			std::copy_n(buffer.constScanLine(qMax(0, y - radius)), count, destinationLine);
+			for (int row = qMax(0, y - radius) + 1; row <= qMin(height - 1, y + radius); ++row)
+			{
+				const uchar* line = buffer.constScanLine(row);
+				for (int i = 0; i != count; ++i)
+					destinationLine[i] = pick(destinationLine[i], line[i]);
+			}
+		}
+	}
+
+	/// Mixes the filtered image with the unfiltered one, weight is in the [0, 256] range
+	void blend(const QImage& source, QImage& filtered, int weight)
+	{
+		const int count = source.width() * 4;
+		for (int y = 0; y != source.height(); ++y)
+		{
+			const uchar* sourceLine   = source.constScanLine(y);
+			uchar*       filteredLine = filtered.scanLine(y);
+			for (int i = 0; i != count; ++i)
+				filteredLine[i] = static_cast<uchar>(sourceLine[i] + (((filteredLine[i] - sourceLine[i]) * weight) >> 8));
+		}
+	}
+}
+
+QImage NovelLib::ImageFilterPipeline::apply(const QImage& image, const std::vector<ImageFilter>& filters)
+{
+	QImage result = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	if (result.isNull() || filters.empty())
+		return result;
+
+	//Allocated once and reused by every separable pass
+	QImage buffer(result.size(), QImage::Format_ARGB32_Premultiplied);
+
+	for (auto it = filters.cbegin(); it != filters.cend();)
+	{
+		if (it->intensivness <= 0.0)
+		{
+			++it;
+			continue;
+		}
+
+		if (it->isColorFilter())
+		{
+			ColorMatrix fused = colorMatrix(*it);
+			for (++it; it != filters.cend() && it->isColorFilter(); ++it)
+				fused = fused.then(colorMatrix(*it));
+			applyColorMatrix(result, fused);
+			continue;
+		}
+
+		const int  weight   = qBound(0, static_cast<int>(std::lround(it->intensivness * 2.56)), 256);
+		const bool bPartial = weight != 256;
+		QImage unfiltered   = bPartial ? result.copy() : QImage();
+
+		const int radius = static_cast<int>(std::lround(it->strength));
+		switch (it->type)
+		{
+		case ImageFilter::Type::GaussianBlur:
+			gaussianBlur(result, buffer, it->strength);
+			break;
+		case ImageFilter::Type::BoxBlur:
+			boxBlur(result, buffer, radius);
+			break;
+		case ImageFilter::Type::Dilation:
+			morphology<true>(result, buffer, radius);
+			break;
+		case ImageFilter::Type::Erosion:
+			morphology<false>(result, buffer, radius);
+			break;
+		default:
+			break;
+		}
+
+		if (bPartial)
+			blend(unfiltered, result, weight);
+		++it;
+	}
+	return result;
+}
+
+QImage NovelLib::ImageFilterPipeline::multiplyColors(const QImage& image, const QVarLengthArray<double, 4>& colorMultiplier)
+{
+	QImage result = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	if (result.isNull())
+		return result;
+
+	//8.8 fixed-point factors, the color ones already include the alpha multiplier, since the channels are premultiplied
+	const double alphaMultiplier = qBound(0.0, colorMultiplier[3], 1.0);
+	const uint   factorA         = static_cast<uint>(std::lround(alphaMultiplier * 256.0)),
+				 factorR         = static_cast<uint>(std::lround(qBound(0.0, colorMultiplier[0], 255.0) * alphaMultiplier * 256.0)),
+				 factorG         = static_cast<uint>(std::lround(qBound(0.0, colorMultiplier[1], 255.0) * alphaMultiplier * 256.0)),
+				 factorB         = static_cast<uint>(std::lround(qBound(0.0, colorMultiplier[2], 255.0) * alphaMultiplier * 256.0));
+
+	const int width = result.width();
+	for (int y = 0; y != result.height(); ++y)
+	{
+		QRgb* line = reinterpret_cast<QRgb*>(result.scanLine(y));
+		for (int x = 0; x != width; ++x)
+		{
+			const uint a = (qAlpha(line[x]) * factorA + 128u) >> 8;
+			//Premultiplied channels cannot exceed alpha
+			line[x] = qRgba(qMin((qRed(line[x])   * factorR + 128u) >> 8, a),
+							qMin((qGreen(line[x]) * factorG + 128u) >> 8, a),
+							qMin((qBlue(line[x])  * factorB + 128u) >> 8, a),
+							a);
+		}
+	}
+	return result;
+}
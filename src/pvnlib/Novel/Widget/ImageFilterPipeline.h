@@ -0,0 +1,22 @@
+#pragma once
+#include <QImage>
+#include <QVarLengthArray>
+#include <vector>
+
+#include "pvnLib/Novel/Data/Visual/Scenery/ImageFilter.h"
+
+/// CPU implementation of the ImageFilter chains
+/// Works on `QImage::Format_ARGB32_Premultiplied` buffers, the kernels are plain loops over the channels of whole rows, written so the compiler can vectorize them
+namespace NovelLib::ImageFilterPipeline
+{
+	/// Applies the filter chain to a copy of the image
+	/// Consecutive color filters (see `ImageFilter::isColorFilter()`) are fused into a single color matrix, so they take only one pass over the pixels
+	/// Blurs are separable (a Gaussian blur is approximated by three box blurs), Dilation and Erosion are separable as well
+	/// \return Filtered image in the `QImage::Format_ARGB32_Premultiplied` format
+	QImage apply(const QImage& image, const std::vector<ImageFilter>& filters);
+
+	/// Multiplies every channel of a copy of the image by the SceneryObject's `colorMultiplier` (red, green, blue, alpha)
+	/// Multipliers above 1.0 brighten the color until it saturates, which allows for the color flashes
+	/// \return Tinted image in the `QImage::Format_ARGB32_Premultiplied` format
+	QImage multiplyColors(const QImage& image, const QVarLengthArray<double, 4>& colorMultiplier);
+}
@@ -0,0 +1,90 @@
+#include "pvnLib/Novel/Widget/RevealedText.h"
+
+#include <algorithm>
+#include <numeric>
+#include <QPainter>
+#include <QTextOption>
+
+RevealedText::RevealedText(const QString& text, const QFont& font, double width)
+	: length_(static_cast<int>(text.length())),
+	layout_(std::make_unique<QTextLayout>(text, font))
+{
+	QTextOption textOption;
+	//CJK text has no spaces, so it has to be broken anywhere
+	textOption.setWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
+	layout_->setTextOption(textOption);
+	layout_->setCacheEnabled(true);
+
+	double y = 0.0;
+	layout_->beginLayout();
+	for (QTextLine line = layout_->createLine(); line.isValid(); line = layout_->createLine())
+	{
+		line.setLineWidth(width);
+		line.setPosition(QPointF(0.0, y));
+		y += line.height();
+	}
+	layout_->endLayout();
+
+	for (const QGlyphRun& glyphRun : layout_->glyphRuns(-1, -1, QTextLayout::RetrieveGlyphIndexes | QTextLayout::RetrieveGlyphPositions | QTextLayout::RetrieveStringIndexes))
+	{
+		const QList<quint32>   glyphIndexes   = glyphRun.glyphIndexes();
+		const QList<QPointF>   glyphPositions = glyphRun.positions();
+		const QList<qsizetype> stringIndexes  = glyphRun.stringIndexes();
+
+		std::vector<qsizetype> order(glyphIndexes.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&stringIndexes](qsizetype lhs, qsizetype rhs) { return stringIndexes[lhs] < stringIndexes[rhs]; });
+
+		Run run;
+		run.glyphRun = glyphRun;
+		run.glyphIndexes.reserve(order.size());
+		run.glyphPositions.reserve(order.size());
+		run.stringIndexes.reserve(order.size());
+		for (qsizetype i : order)
+		{
+			run.glyphIndexes.push_back(glyphIndexes[i]);
+			run.glyphPositions.push_back(glyphPositions[i]);
+			run.stringIndexes.push_back(stringIndexes[i]);
+		}
+		runs_.push_back(std::move(run));
+	}
+}
+
+void RevealedText::draw(QPainter* painter, const QPointF& origin, int revealedLength) const
+{
+	for (const Run& run : runs_)
+	{
+		const qsizetype revealedGlyphs = std::lower_bound(run.stringIndexes.cbegin(), run.stringIndexes.cend(), revealedLength) - run.stringIndexes.cbegin();
+		if (revealedGlyphs == 0)
+			continue;
+
+		//Raw data is not copied, only the QGlyphRun's header is
+		QGlyphRun revealed = run.glyphRun;
+		revealed.setRawData(run.glyphIndexes.data(), run.glyphPositions.data(), static_cast<int>(revealedGlyphs));
+		painter->drawGlyphRun(origin, revealed);
+	}
+}
+
+QRectF RevealedText::charactersRect(int from, int to) const
+{
+	QRectF ret;
+	for (int i = 0; i != layout_->lineCount(); ++i)
+	{
+		const QTextLine line  = layout_->lineAt(i);
+		const int       first = qMax(from, line.textStart()),
+						last  = qMin(to,   line.textStart() + line.textLength());
+		if (first >= last)
+			continue;
+
+		const double x1 = line.cursorToX(first),
+					 x2 = line.cursorToX(last);
+		//A small margin for the antialiasing and glyphs that overhang their advance
+		ret = ret.united(QRectF(qMin(x1, x2), line.y(), qAbs(x2 - x1), line.height()).adjusted(-2.0, 0.0, 2.0, 0.0));
+	}
+	return ret;
+}
+
+int RevealedText::length() const noexcept
+{
+	return length_;
+}
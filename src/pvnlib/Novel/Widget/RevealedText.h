@@ -0,0 +1,47 @@
+#pragma once
+#include <QFont>
+#include <QGlyphRun>
+#include <QRectF>
+#include <QString>
+#include <QTextLayout>
+#include <memory>
+#include <vector>
+
+class QPainter;
+
+/// Text that is laid out and shaped only once and then revealed character by character
+/// Revealing draws a prefix of the already shaped glyphs, so the cost of a frame does not depend on how long the text is
+class RevealedText final
+{
+public:
+	/// \param width Lines are wrapped at this width
+	RevealedText(const QString& text, const QFont& font, double width);
+	RevealedText(const RevealedText&)            = delete;
+	RevealedText& operator=(const RevealedText&) = delete;
+
+	/// Draws the glyphs of the first `revealedLength` characters
+	/// \param origin Top-left corner of the text
+	void draw(QPainter* painter, const QPointF& origin, int revealedLength) const;
+
+	/// \return Rectangle (relative to the origin) that contains the characters in the [from, to) range, so only it needs to be repainted when they are revealed
+	QRectF charactersRect(int from, int to) const;
+
+	/// \return Number of characters (UTF-16 code units)
+	int length() const noexcept;
+
+private:
+	/// Glyphs of a QGlyphRun sorted by the characters they come from, so the revealed glyphs always form a prefix
+	/// The positions are absolute, so the drawing order does not matter, even for right-to-left text
+	struct Run
+	{
+		QGlyphRun              glyphRun;
+		std::vector<quint32>   glyphIndexes;
+		std::vector<QPointF>   glyphPositions;
+		std::vector<qsizetype> stringIndexes;
+	};
+
+	int length_ = 0;
+	/// QTextLayout cannot be moved, but it's needed to map the characters to the lines
+	std::unique_ptr<QTextLayout> layout_;
+	std::vector<Run> runs_;
+};
@@ -1,16 +1,15 @@
 ﻿#include "pvnLib/Novel/Widget/SceneWidget.h"
 
+#include <QHash>
 #include <QResizeEvent>
 #include <QOpenGLWidget>
 #include <QSurfaceFormat>
 
 #include "pvnLib/Novel/Data/Novel.h"
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
 #include "pvnLib/Novel/Widget/ChoiceWidget.h"
 #include "pvnLib/Novel/Widget/TextWidget.h"
 
-#define RESOLUTION_X 1600.0
-#define RESOLUTION_Y 900.0
-
 SceneWidget::SceneWidget(QWidget* parent)
 	: QGraphicsView(parent)
 {
@@ -31,6 +30,8 @@ void SceneWidget::switchToPreview()
 	bPreview_ = true;
 	for (SceneryObjectWidget* sceneryObjectWidget : sceneryObjectWidgets_)
 		sceneryObjectWidget->switchToPreview();
+	for (SceneryObjectWidget* characterWidget : characterWidgets_)
+		characterWidget->switchToPreview();
 }
 
 void SceneWidget::switchToDisplay()
@@ -38,6 +39,8 @@ void SceneWidget::switchToDisplay()
 	bPreview_ = false;
 	for (SceneryObjectWidget* sceneryObjectWidget : sceneryObjectWidgets_)
 		sceneryObjectWidget->switchToDisplay();
+	for (SceneryObjectWidget* characterWidget : characterWidgets_)
+		characterWidget->switchToDisplay();
 }
 
 const std::vector<SceneryObjectWidget*>* SceneWidget::getSceneryObjectWidgets() const noexcept
@@ -59,7 +62,7 @@ void SceneWidget::addSceneryObjectWidget(const SceneryObject& sceneryObject, int
 {
 	if (!sceneryObject.getAssetImage())
 		return;
-	SceneryObjectWidget* sceneryObjectWidget = new SceneryObjectWidget(sceneryObject, zorder, bPreview_);
+	SceneryObjectWidget* sceneryObjectWidget = new SceneryObjectWidget(sceneryObject, zorder, bPreview_, &spriteAtlas_);
 
 	sceneryObjectWidgets_.push_back(sceneryObjectWidget);
 	scene()->addItem(sceneryObjectWidget);
@@ -73,7 +76,7 @@ bool SceneWidget::insertSceneryObjectWidget(size_t index, const SceneryObject& s
 		qCritical() << NovelLib::ErrorType::General << "Tried to insert past \"sceneryObjectWidgets_\" size";
 		return false;
 	}
-	SceneryObjectWidget* sceneryObjectWidget = new SceneryObjectWidget(sceneryObject, index, bPreview_);
+	SceneryObjectWidget* sceneryObjectWidget = new SceneryObjectWidget(sceneryObject, index, bPreview_, &spriteAtlas_);
 
 	scene()->addItem(sceneryObjectWidget);
 	sceneryObjectWidgets_.insert(sceneryObjectWidgets_.begin() + index, std::move(sceneryObjectWidget));
@@ -90,6 +93,8 @@ bool SceneWidget::removeSceneryObjectWidget(size_t index)
 		qCritical() << NovelLib::ErrorType::General << "Tried to remove past \"sceneryObjectWidgets_\" size";
 		return false;
 	}
+	//Deleting a QGraphicsItem removes it from the QGraphicsScene
+	delete sceneryObjectWidgets_[index];
 	sceneryObjectWidgets_.erase(sceneryObjectWidgets_.begin() + index);
 	//Removing an item doesn't need to correct Z-Values
 	return true;
@@ -97,7 +102,13 @@ bool SceneWidget::removeSceneryObjectWidget(size_t index)
 
 void SceneWidget::clearSceneryObjectWidgets() noexcept
 {
+	for (SceneryObjectWidget* sceneryObjectWidget : sceneryObjectWidgets_)
+		delete sceneryObjectWidget;
+	for (SceneryObjectWidget* characterWidget : characterWidgets_)
+		delete characterWidget;
+
 	sceneryObjectWidgets_.clear();
+	characterWidgets_.clear();
 }
 
 void SceneWidget::resizeEvent(QResizeEvent* event)
@@ -107,6 +118,8 @@ void SceneWidget::resizeEvent(QResizeEvent* event)
 	setSceneRect(QRectF(0.0, 0.0, RESOLUTION_X, RESOLUTION_Y));
 	transformMatrix_.reset();
 	transformMatrix_.scale(width() / RESOLUTION_X, height() / RESOLUTION_Y);
+	//AssetImages decoded from now on will have enough pixels for the new size
+	AssetImage::setViewScale(qMax(width() / RESOLUTION_X, height() / RESOLUTION_Y) * devicePixelRatioF());
 	setTransform(transformMatrix_);	//No Image resize needed, since it will be drawn (where it will be resized) and then cached
 	//QImage img = scene()->backgroundBrush().textureImage();
 	//if (!img.isNull())
@@ -115,6 +128,18 @@ void SceneWidget::resizeEvent(QResizeEvent* event)
 
 void SceneWidget::drawBackground(QPainter* painter, const QRectF& rect)
 {
+	if (backgroundTransition_.isActive())
+	{
+		backgroundTransition_.paint(painter, QRectF(0.0, 0.0, RESOLUTION_X, RESOLUTION_Y), true);
+		return;
+	}
+
+	if (tiledBackground_.isActive())
+	{
+		tiledBackground_.paint(painter, rect);
+		return;
+	}
+
 	QRectF scaledRect = transformMatrix_.mapRect(rect);
 
 	QImage img = scene()->backgroundBrush().textureImage();
@@ -147,56 +172,245 @@ void SceneWidget::mouseDoubleClickEvent(QMouseEvent* event)
 		emit LPMClicked();
 }
 
+QImage SceneWidget::grabFrame()
+{
+	if (QOpenGLWidget* openGLWidget = qobject_cast<QOpenGLWidget*>(viewport()))
+		return openGLWidget->grabFramebuffer();
+	return viewport()->grab().toImage();
+}
+
 void SceneWidget::displayEventChoice(const QString& menuText, const std::vector<Choice>& choices)
 {
-	ChoiceWidget* choiceWidget = new ChoiceWidget(scene(), menuText, choices, bPreview_);
-	connect(choiceWidget, &ChoiceWidget::chosen, this, &SceneWidget::pendChoiceRun);
-	//Takes ownership and will delete it later
-	scene()->addItem(choiceWidget);
+	if (!choiceWidget_)
+	{
+		choiceWidget_ = new ChoiceWidget(bPreview_);
+		connect(choiceWidget_, &ChoiceWidget::chosen, this, &SceneWidget::pendChoiceRun);
+		//Takes ownership and will delete it later
+		scene()->addItem(choiceWidget_);
+	}
+	choiceWidget_->setChoices(menuText, choices);
 }
 
 void SceneWidget::displayEventDialogue(const std::vector<Sentence>& sentences, uint sentenceReadIndex)
 {
-	TextWidget* textWidget = new TextWidget(scene(), sentences, sentenceReadIndex, bPreview_);
-	connect(textWidget, &TextWidget::pendNovelEnd,this,       &SceneWidget::pendNovelEnd);
-	connect(this,       &SceneWidget::LPMClicked, textWidget, &TextWidget::mouseClicked);
-	//Takes ownership and will delete it later
-	scene()->addItem(textWidget);
+	if (!textWidget_)
+	{
+		textWidget_ = new TextWidget(bPreview_);
+		connect(textWidget_, &TextWidget::pendNovelEnd, this,        &SceneWidget::pendNovelEnd);
+		connect(this,        &SceneWidget::LPMClicked,  textWidget_, &TextWidget::mouseClicked);
+		//Takes ownership and will delete it later
+		scene()->addItem(textWidget_);
+	}
+	textWidget_->setSentences(sentences, sentenceReadIndex);
 }
 
 void SceneWidget::displaySceneryObjects(const std::vector<SceneryObject>& sceneryObjects)
 {
-	for (uint i = 0u; i != sceneryObjects.size(); ++i)
-	{
-		const SceneryObject& sceneryObject = sceneryObjects[i];
-		const AssetImage* sprite = sceneryObject.getAssetImage();
-		if (sprite && sprite->isLoaded())
-			addSceneryObjectWidget(sceneryObject, i);
-	}
+	bindSceneryObjectWidgets(sceneryObjectWidgets_, sceneryObjects);
 	update();
 }
 
 void SceneWidget::displayCharacters(const std::vector<Character>& characters)
 {
-	for (uint i = 0u; i != characters.size(); ++i)
-	{
-		const Character& character = characters[i];
-		const AssetImage* sprite = character.getAssetImage();
-		if (sprite && sprite->isLoaded())
-			addSceneryObjectWidget(character, i);
-	}
+	bindSceneryObjectWidgets(characterWidgets_, characters);
 	update();
 }
 
+void SceneWidget::updateSceneryObjectTransforms(const std::vector<SceneryObject>& sceneryObjects, const std::vector<Character>& characters)
+{
+	updateSceneryObjectWidgetTransforms(sceneryObjectWidgets_, sceneryObjects);
+	updateSceneryObjectWidgetTransforms(characterWidgets_,     characters);
+}
+
+void SceneWidget::packSprites(const std::vector<const AssetImage*>& sprites)
+{
+	uint generation = spriteAtlas_.getGeneration();
+	spriteAtlas_.build(sprites);
+	if (generation == spriteAtlas_.getGeneration())
+		return;
+
+	//The old Regions are gone, the widgets cannot paint from them anymore
+	for (SceneryObjectWidget* sceneryObjectWidget : sceneryObjectWidgets_)
+		sceneryObjectWidget->refreshPixmap();
+	for (SceneryObjectWidget* characterWidget : characterWidgets_)
+		characterWidget->refreshPixmap();
+}
+
 void SceneWidget::clearScene()
 {
-	scene()->clear();
-	clearSceneryObjectWidgets();
+	//The pooled widgets wait hidden for the next dialogue/menu
+	if (textWidget_)
+		textWidget_->hide();
+	if (choiceWidget_)
+		choiceWidget_->hide();
+
+	//Collect top-level items first, as deleting a parent also deletes its children
+	std::vector<QGraphicsItem*> removedItems;
+	for (QGraphicsItem* item : scene()->items())
+		if (!item->parentItem() && item->type() != SceneryObjectWidget::Type && item != textWidget_ && item != choiceWidget_)
+			removedItems.push_back(item);
+
+	for (QGraphicsItem* item : removedItems)
+		delete item;
+}
+
+template<typename SceneryObjectType>
+void SceneWidget::bindSceneryObjectWidgets(std::vector<SceneryObjectWidget*>& widgets, const std::vector<SceneryObjectType>& sceneryObjects)
+{
+	QMultiHash<QString, SceneryObjectWidget*> unboundWidgets;
+	unboundWidgets.reserve(widgets.size());
+	for (SceneryObjectWidget* widget : widgets)
+		unboundWidgets.insert(widget->getSceneryObjectName(), widget);
+
+	std::vector<SceneryObjectWidget*> boundWidgets;
+	boundWidgets.reserve(sceneryObjects.size());
+	std::vector<int> pendingIndices;
+
+	//Widgets that display SceneryObjects of the same name are the likeliest to keep the same image
+	for (int i = 0; i != static_cast<int>(sceneryObjects.size()); ++i)
+	{
+		const SceneryObjectType& sceneryObject = sceneryObjects[i];
+		const AssetImage* sprite = sceneryObject.getAssetImage();
+		if (!sprite || !sprite->isLoaded())
+			continue;
+
+		auto it = unboundWidgets.find(sceneryObject.name);
+		if (it == unboundWidgets.end())
+		{
+			pendingIndices.push_back(i);
+			continue;
+		}
+		it.value()->setSceneryObject(sceneryObject, i);
+		boundWidgets.push_back(it.value());
+		unboundWidgets.erase(it);
+	}
+
+	auto leftoverIt = unboundWidgets.begin();
+	for (int i : pendingIndices)
+	{
+		SceneryObjectWidget* widget = nullptr;
+		if (leftoverIt != unboundWidgets.end())
+		{
+			widget = leftoverIt.value();
+			widget->setSceneryObject(sceneryObjects[i], i);
+			leftoverIt = unboundWidgets.erase(leftoverIt);
+		}
+		else
+		{
+			widget = new SceneryObjectWidget(sceneryObjects[i], i, bPreview_, &spriteAtlas_);
+			scene()->addItem(widget);
+		}
+		boundWidgets.push_back(widget);
+	}
+
+	//Deleting a QGraphicsItem removes it from the QGraphicsScene
+	for (SceneryObjectWidget* widget : unboundWidgets)
+		delete widget;
+
+	widgets = std::move(boundWidgets);
+}
+
+template<typename SceneryObjectType>
+void SceneWidget::updateSceneryObjectWidgetTransforms(std::vector<SceneryObjectWidget*>& widgets, const std::vector<SceneryObjectType>& sceneryObjects)
+{
+	for (SceneryObjectWidget* widget : widgets)
+	{
+		int index = widget->getSceneryObjectIndex();
+		if (index < static_cast<int>(sceneryObjects.size()) && sceneryObjects[index].name == widget->getSceneryObjectName())
+			widget->updateTransform(sceneryObjects[index]);
+	}
 }
 
 void SceneWidget::displayBackground(const QImage* img)
 {
+	if (img != backgroundImage_)
+		backgroundTransition_.stop();
+	backgroundImage_ = img;
+	tiledBackground_.setTiledImagePack(nullptr, QSizeF());
+	if (!img)
+	{
+		scene()->setBackgroundBrush(QBrush());
+		return;
+	}
+
 	//No resize needed, since it is cached
 	QBrush brush(*img/*->scaled(size())*/);
 	scene()->setBackgroundBrush(brush);
+}
+
+void SceneWidget::displayTiledBackground(const TiledImagePack* tiledImagePack)
+{
+	backgroundTransition_.stop();
+	backgroundImage_ = nullptr;
+	scene()->setBackgroundBrush(QBrush());
+	tiledBackground_.setTiledImagePack(tiledImagePack, QSizeF(RESOLUTION_X, RESOLUTION_Y));
+	resetCachedContent();
+	viewport()->update();
+}
+
+void SceneWidget::moveBackgroundCamera(const QPointF& cameraPos)
+{
+	if (!tiledBackground_.isActive())
+		return;
+
+	tiledBackground_.setCameraPos(cameraPos);
+	//The background is cached by QGraphicsView, which doesn't know it has moved
+	resetCachedContent();
+	viewport()->update();
+}
+
+void SceneWidget::transitionBackground(const QImage* img, Transition::Type transitionType, uint transitionTime)
+{
+	if (img == backgroundImage_)
+		return;
+
+	//Both backgrounds are scaled once, every frame only draws them
+	const QSize   size = QSizeF(RESOLUTION_X, RESOLUTION_Y).toSize();
+	const QImage  old  = scene()->backgroundBrush().textureImage();
+	const QPixmap from = old.isNull() ? QPixmap() : QPixmap::fromImage(old.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+
+	displayBackground(img);
+	//Without the game clock the Transition would never end, so the new background is displayed right away
+	if (img && !img->isNull() && Novel::getInstance().isClockRunning())
+		backgroundTransition_.start(from, QPixmap::fromImage(img->scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)), transitionType, transitionTime);
+	resetCachedContent();
+	viewport()->update();
+}
+
+void SceneWidget::transitionSceneryObjectImage(const QString& sceneryObjectName, const AssetImage* assetImage, Transition::Type transitionType, uint transitionTime)
+{
+	for (std::vector<SceneryObjectWidget*>* widgets : { &sceneryObjectWidgets_, &characterWidgets_ })
+		for (SceneryObjectWidget* widget : *widgets)
+			if (widget->getSceneryObjectName() == sceneryObjectName)
+			{
+				widget->startTransition(assetImage, transitionType, Novel::getInstance().isClockRunning() ? transitionTime : 0u);
+				return;
+			}
+}
+
+void SceneWidget::updateSceneryObjectFilters(const QString& sceneryObjectName, const std::vector<ImageFilter>& filters)
+{
+	for (std::vector<SceneryObjectWidget*>* widgets : { &sceneryObjectWidgets_, &characterWidgets_ })
+		for (SceneryObjectWidget* widget : *widgets)
+			if (widget->getSceneryObjectName() == sceneryObjectName)
+			{
+				widget->setFilters(filters);
+				return;
+			}
+}
+
+void SceneWidget::advanceTransitions(uint elapsedTime)
+{
+	if (backgroundTransition_.isActive())
+	{
+		backgroundTransition_.advance(elapsedTime);
+		//The background is cached by QGraphicsView, which doesn't know it has changed
+		resetCachedContent();
+		viewport()->update();
+	}
+
+	for (SceneryObjectWidget* sceneryObjectWidget : sceneryObjectWidgets_)
+		sceneryObjectWidget->advanceTransition(elapsedTime);
+	for (SceneryObjectWidget* characterWidget : characterWidgets_)
+		characterWidget->advanceTransition(elapsedTime);
 }
\ No newline at end of file
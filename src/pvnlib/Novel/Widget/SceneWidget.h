@@ -2,6 +2,9 @@
 #include <QGraphicsView>
 
 #include "pvnLib/Novel/Widget/SceneryObjectWidget.h"
+#include "pvnLib/Novel/Widget/SpriteAtlas.h"
+#include "pvnLib/Novel/Widget/TiledBackground.h"
+#include "pvnLib/Novel/Widget/Transition.h"
 #include "pvnLib/Novel/Widget/ChoiceWidget.h"
 #include "pvnLib/Novel/Widget/TextWidget.h"
 
@@ -26,12 +29,34 @@ public:
 
 	void drawBackground(QPainter* painter, const QRectF& rect) override;
 
+	/// Grabs the currently displayed frame at full size, it's a GPU readback, so it should be done once and the result processed elsewhere (see `NovelState::save()`)
+	QImage grabFrame();
+
 public slots:
 	void displayBackground(const QImage* img);
+	/// Displays an oversized background, which is streamed tile by tile as the camera moves
+	void displayTiledBackground(const TiledImagePack* tiledImagePack);
+	/// Pans the camera over a tiled background
+	/// \param cameraPos Top-left corner of the scene on the background scaled to the scene's height
+	void moveBackgroundCamera(const QPointF& cameraPos);
+	/// Replaces the background, blending the old one into the new one over `transitionTime` milliseconds
+	void transitionBackground(const QImage* img, Transition::Type transitionType, uint transitionTime);
+	/// Replaces the image of a displayed SceneryObject (or Character), blending the old one into the new one over `transitionTime` milliseconds
+	void transitionSceneryObjectImage(const QString& sceneryObjectName, const AssetImage* assetImage, Transition::Type transitionType, uint transitionTime);
+	/// Moves all the Transitions to the game clock's time
+	void advanceTransitions(uint elapsedTime);
+	/// Applies the ImageFilters changed by an ActionFilter to the displayed SceneryObject
+	void updateSceneryObjectFilters(const QString& sceneryObjectName, const std::vector<ImageFilter>& filters);
 	void displayEventChoice(const QString& menuText, const std::vector<Choice>& choices);
 	void displayEventDialogue(const std::vector<Sentence>& sentences, uint sentenceReadIndex = 0u);
 	void displaySceneryObjects(const std::vector<SceneryObject>& sceneryObjects);
 	void displayCharacters(const std::vector<Character>& characters);
+	/// Applies the Animators' output to the already displayed SceneryObjectWidgets, without rebuilding them
+	void updateSceneryObjectTransforms(const std::vector<SceneryObject>& sceneryObjects, const std::vector<Character>& characters);
+	/// Packs the sprites that the upcoming Scene will display into the SpriteAtlas and rebinds the displayed SceneryObjectWidgets to it
+	void packSprites(const std::vector<const AssetImage*>& sprites);
+	/// Removes everything, but the SceneryObjectWidgets, which are rebound by the next `displaySceneryObjects()`/`displayCharacters()` call
+	/// The TextWidget and ChoiceWidget are only hidden, the next `displayEventDialogue()`/`displayEventChoice()` rebinds them
 	void clearScene();
 
 signals:
@@ -45,10 +70,31 @@ private:
 	void mousePressEvent(QMouseEvent* event)       override;
 	void mouseDoubleClickEvent(QMouseEvent* event) override;
 
+	/// Reuses `widgets` for `sceneryObjects` (matching by name first), creates the missing ones and deletes the unused ones
+	template<typename SceneryObjectType>
+	void bindSceneryObjectWidgets(std::vector<SceneryObjectWidget*>& widgets, const std::vector<SceneryObjectType>& sceneryObjects);
+
+	template<typename SceneryObjectType>
+	void updateSceneryObjectWidgetTransforms(std::vector<SceneryObjectWidget*>& widgets, const std::vector<SceneryObjectType>& sceneryObjects);
+
 	std::vector<SceneryObjectWidget*> sceneryObjectWidgets_;
+	std::vector<SceneryObjectWidget*> characterWidgets_;
+
+	/// Shared by all the SceneryObjectWidgets, must outlive them
+	SpriteAtlas spriteAtlas_;
 
 	QTransform transformMatrix_;
 
+	TiledBackground tiledBackground_;
+
+	/// Displayed background, remembered to tell if a Transition was interrupted by another background
+	const QImage* backgroundImage_ = nullptr;
+	Transition    backgroundTransition_;
+
+	/// Pooled, created by the first dialogue/menu and only hidden by `clearScene()`
+	TextWidget*   textWidget_   = nullptr;
+	ChoiceWidget* choiceWidget_ = nullptr;
+
 	bool bPreview_ = false;
 };
 
@@ -1,8 +1,15 @@
 #include "pvnLib/Novel/Widget/SceneryObjectWidget.h"
 
-SceneryObjectWidget::SceneryObjectWidget(const SceneryObject& sceneryObject, int zorder, bool bPreview)
+#include <QPainter>
+
+#include "pvnLib/Novel/Widget/ImageFilterPipeline.h"
+#include "pvnLib/Novel/Widget/SpritePixmapCache.h"
+#include "pvnLib/Novel/Widget/SpriteTintRenderer.h"
+
+SceneryObjectWidget::SceneryObjectWidget(const SceneryObject& sceneryObject, int zorder, bool bPreview, const SpriteAtlas* spriteAtlas)
 	: QGraphicsPixmapItem(),
-	bPreview_(bPreview)
+	bPreview_(bPreview),
+	spriteAtlas_(spriteAtlas)
 {
 	if (bPreview_)
 	{
@@ -10,19 +17,8 @@ SceneryObjectWidget::SceneryObjectWidget(const SceneryObject& sceneryObject, int
 		setFlag(ItemIsFocusable);
 		setFlag(ItemSendsGeometryChanges);
 	}
-	QImage img = *sceneryObject.getAssetImage()->getImage();
-	if (sceneryObject.bMirrored)
-		img.mirror(true, false);
-	
-	transformMatrix_.scale(sceneryObject.scale.width(), sceneryObject.scale.height());
-
-	setPixmap(QPixmap::fromImage(std::move(img)));
-	//setZValue(zorder);
-	setTransformOriginPoint(boundingRect().center());
-	setRotation(sceneryObject.rotationDegree);
-	setPos(sceneryObject.pos.x(), sceneryObject.pos.y());
 	setTransformationMode(Qt::SmoothTransformation);
-	setTransform(transformMatrix_);
+	setSceneryObject(sceneryObject, zorder);
 }
 
 void SceneryObjectWidget::switchToPreview()
@@ -39,4 +35,266 @@ void SceneryObjectWidget::switchToDisplay()
 	setFlag(ItemIsMovable,            false);
 	setFlag(ItemIsFocusable,          false);
 	setFlag(ItemSendsGeometryChanges, false);
-}
\ No newline at end of file
+}
+
+int SceneryObjectWidget::type() const
+{
+	return Type;
+}
+
+QRectF SceneryObjectWidget::boundingRect() const
+{
+	if (transition_.isActive())
+		return spriteRect().united(transitionFromRect_);
+
+	return spriteRect();
+}
+
+QPainterPath SceneryObjectWidget::shape() const
+{
+	if (spriteAtlasRegion_)
+	{
+		QPainterPath path;
+		path.addRect(spriteRect());
+		return path;
+	}
+
+	return QGraphicsPixmapItem::shape();
+}
+
+bool SceneryObjectWidget::contains(const QPointF& point) const
+{
+	if (spriteAtlasRegion_)
+		return spriteRect().contains(point);
+
+	return QGraphicsPixmapItem::contains(point);
+}
+
+void SceneryObjectWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+	if (transition_.isActive())
+	{
+		transition_.paint(painter, transitionFromRect_, spriteRect(), false);
+		return;
+	}
+
+	if (!SpritePixmapCache::isIdentityTint(colorMultiplier_))
+	{
+		paintTinted(painter);
+		return;
+	}
+
+	if (!spriteAtlasRegion_)
+	{
+		QGraphicsPixmapItem::paint(painter, option, widget);
+		return;
+	}
+
+	painter->setRenderHint(QPainter::SmoothPixmapTransform, transformationMode() == Qt::SmoothTransformation);
+
+	const QRectF target = spriteRect();
+	if (bMirrored_)
+	{
+		//Mirroring at draw time allows to pack a sprite only once for both orientations
+		painter->save();
+		painter->translate(target.left() + target.right(), 0.0);
+		painter->scale(-1.0, 1.0);
+		painter->drawPixmap(target, *spriteAtlasRegion_->page, spriteAtlasRegion_->rect);
+		painter->restore();
+	}
+	else painter->drawPixmap(target, *spriteAtlasRegion_->page, spriteAtlasRegion_->rect);
+}
+
+void SceneryObjectWidget::setSceneryObject(const SceneryObject& sceneryObject, int zorder)
+{
+	sceneryObjectName_  = sceneryObject.name;
+	sceneryObjectIndex_ = zorder;
+
+	const bool bAtlasRebuilt = spriteAtlas_ && spriteAtlas_->getGeneration() != spriteAtlasGeneration_;
+	if (bAtlasRebuilt || assetImage_ != sceneryObject.getAssetImage() || isImageReloaded() || bMirrored_ != sceneryObject.bMirrored || filters_ != sceneryObject.filters || (pixmap().isNull() && !spriteAtlasRegion_))
+		updatePixmap(sceneryObject);
+
+	//setZValue(zorder);
+	updateTransform(sceneryObject);
+	//A tint that comes with the SceneryObject itself is static, so it is worth caching
+	if (bTintAnimated_)
+	{
+		bTintAnimated_ = false;
+		tintedPixmap_  = QPixmap();
+		untintedImage_ = QImage();
+	}
+}
+
+void SceneryObjectWidget::updateTransform(const SceneryObject& sceneryObject)
+{
+	//An Animation might have requested a larger scale, which decoded the AssetImage again
+	if (isImageReloaded())
+		refreshPixmap();
+	//An ActionFilter might have changed them since the SceneryObject was displayed
+	setFilters(sceneryObject.filters);
+
+	//Qt's setters return early if nothing changed, so there is no need to compare the values here
+	//The AssetImage might be decoded at a lower resolution, which has to be compensated to keep the size of the full-resolution image
+	transformMatrix_ = QTransform::fromScale(sceneryObject.scale.width() * sourceScale_.width(), sceneryObject.scale.height() * sourceScale_.height());
+	setTransform(transformMatrix_);
+	setRotation(sceneryObject.rotationDegree);
+	setPos(sceneryObject.pos.x(), sceneryObject.pos.y());
+	setOpacity(sceneryObject.alphaMultiplier);
+
+	if (colorMultiplier_ != sceneryObject.colorMultiplier)
+	{
+		colorMultiplier_ = sceneryObject.colorMultiplier;
+		bTintAnimated_   = true;
+		tintedPixmap_    = QPixmap();
+		update();
+	}
+}
+
+void SceneryObjectWidget::setFilters(const std::vector<ImageFilter>& filters)
+{
+	if (filters_ == filters)
+		return;
+
+	filters_ = filters;
+	refreshPixmap();
+}
+
+QString SceneryObjectWidget::getSceneryObjectName() const noexcept
+{
+	return sceneryObjectName_;
+}
+
+int SceneryObjectWidget::getSceneryObjectIndex() const noexcept
+{
+	return sceneryObjectIndex_;
+}
+
+void SceneryObjectWidget::updatePixmap(const SceneryObject& sceneryObject)
+{
+	//Something else is displayed now, there is nothing left to blend into
+	if (transition_.isActive())
+	{
+		prepareGeometryChange();
+		transition_.stop();
+	}
+	assetImage_ = sceneryObject.getAssetImage();
+	bMirrored_  = sceneryObject.bMirrored;
+	filters_    = sceneryObject.filters;
+	refreshPixmap();
+}
+
+void SceneryObjectWidget::refreshPixmap()
+{
+	spriteAtlasRegion_ = nullptr;
+	tintedPixmap_      = QPixmap();
+	untintedImage_     = QImage();
+	imageKey_          = assetImage_ && assetImage_->getImage() ? assetImage_->getImage()->cacheKey() : 0;
+	sourceScale_       = assetImage_ ? assetImage_->getSourceScale() : QSizeF(1.0, 1.0);
+	if (spriteAtlas_)
+		spriteAtlasGeneration_ = spriteAtlas_->getGeneration();
+
+	if (!assetImage_ || !assetImage_->getImage())
+	{
+		setPixmap(QPixmap());
+		return;
+	}
+
+	if (spriteAtlas_ && filters_.empty())
+		spriteAtlasRegion_ = spriteAtlas_->getRegion(*assetImage_);
+
+	if (spriteAtlasRegion_)
+	{
+		//Geometry changes without a new pixmap, so QGraphicsScene needs to be told about it
+		prepareGeometryChange();
+		setPixmap(QPixmap());
+	}
+	//Shared with every other SceneryObjectWidget that displays the same sprite
+	else setPixmap(SpritePixmapCache::getInstance().getPixmap(*assetImage_, bMirrored_, { 1.0, 1.0, 1.0, 1.0 }, filters_));
+	setTransformOriginPoint(spriteRect().center());
+}
+
+void SceneryObjectWidget::startTransition(const AssetImage* assetImage, Transition::Type type, uint duration)
+{
+	if (!assetImage || assetImage == assetImage_ || !assetImage->getImage())
+		return;
+
+	SpritePixmapCache& spritePixmapCache = SpritePixmapCache::getInstance();
+	const QPixmap from      = assetImage_ && assetImage_->getImage() ? spritePixmapCache.getPixmap(*assetImage_, bMirrored_, { 1.0, 1.0, 1.0, 1.0 }, filters_) : QPixmap();
+	const QSizeF  fromScale = sourceScale_;
+
+	prepareGeometryChange();
+	transition_.stop();
+	assetImage_ = assetImage;
+	refreshPixmap();
+
+	//Both images might be decoded at different scales, the displayed size has to stay the same
+	const QSizeF toScale = sourceScale_;
+	transformMatrix_ = QTransform::fromScale(transformMatrix_.m11() / fromScale.width() * toScale.width(), transformMatrix_.m22() / fromScale.height() * toScale.height());
+	setTransform(transformMatrix_);
+
+	transitionFromRect_ = QRectF(offset(), QSizeF(from.width() * fromScale.width() / toScale.width(), from.height() * fromScale.height() / toScale.height()));
+	transition_.start(from, spritePixmapCache.getPixmap(*assetImage_, bMirrored_, { 1.0, 1.0, 1.0, 1.0 }, filters_), type, duration);
+	update();
+}
+
+void SceneryObjectWidget::advanceTransition(uint elapsedTime)
+{
+	if (!transition_.isActive())
+		return;
+
+	//The `boundingRect()` shrinks when the Transition ends
+	prepareGeometryChange();
+	transition_.advance(elapsedTime);
+	update();
+}
+
+bool SceneryObjectWidget::isImageReloaded() const noexcept
+{
+	//The AssetImage stays at the same address, only its QImage is replaced
+	return assetImage_ && assetImage_->getImage() && assetImage_->getImage()->cacheKey() != imageKey_;
+}
+
+QRectF SceneryObjectWidget::spriteRect() const
+{
+	if (spriteAtlasRegion_)
+		return QRectF(offset(), spriteAtlasRegion_->rect.size());
+
+	return QGraphicsPixmapItem::boundingRect();
+}
+
+void SceneryObjectWidget::paintTinted(QPainter* painter)
+{
+	const QRectF target = spriteRect();
+
+	//The shader multiplies the colors while drawing, so animating the tint does not create any pixmaps
+	if (spriteAtlasRegion_)
+	{
+		if (SpriteTintRenderer::getInstance().draw(painter, target, *spriteAtlasRegion_->page, spriteAtlasRegion_->rect, bMirrored_, colorMultiplier_))
+			return;
+	}
+	else if (SpriteTintRenderer::getInstance().draw(painter, target, pixmap(), pixmap().rect(), false, colorMultiplier_))
+		return;
+
+	const QPixmap& tinted = tintedPixmap();
+	if (tinted.isNull())
+		return;
+	painter->setRenderHint(QPainter::SmoothPixmapTransform, transformationMode() == Qt::SmoothTransformation);
+	painter->drawPixmap(target, tinted, tinted.rect());
+}
+
+const QPixmap& SceneryObjectWidget::tintedPixmap()
+{
+	if (!tintedPixmap_.isNull() || !assetImage_ || !assetImage_->getImage())
+		return tintedPixmap_;
+
+	if (bTintAnimated_)
+	{
+		//Tinted from the shared untinted sprite, which is converted to an image only once, so only the multiplication is done every frame
+		if (untintedImage_.isNull())
+			untintedImage_ = SpritePixmapCache::getInstance().getPixmap(*assetImage_, bMirrored_, { 1.0, 1.0, 1.0, 1.0 }, filters_).toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+		tintedPixmap_ = QPixmap::fromImage(NovelLib::ImageFilterPipeline::multiplyColors(untintedImage_, colorMultiplier_));
+	}
+	else tintedPixmap_ = SpritePixmapCache::getInstance().getPixmap(*assetImage_, bMirrored_, colorMultiplier_, filters_);
+
+	return tintedPixmap_;
+}
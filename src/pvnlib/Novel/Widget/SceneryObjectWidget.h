@@ -2,19 +2,100 @@
 #include <QGraphicsPixmapItem>
 
 #include "pvnLib/Novel/Data/Visual/Scenery/SceneryObject.h"
+#include "pvnLib/Novel/Widget/SpriteAtlas.h"
+#include "pvnLib/Novel/Widget/Transition.h"
 #include <QGraphicsWidget>
 
+/// Persistent view of a SceneryObject
+/// The widget is rebound to new SceneryObjects instead of being recreated, so the pixmap is replaced only when the image actually changes and Animations only update the transformation
 class SceneryObjectWidget final : public QObject, public QGraphicsPixmapItem
 {
 	Q_OBJECT
 public:
-	explicit SceneryObjectWidget(const SceneryObject& sceneryObject, int zorder = 0, bool bPreview = false);
+	/// Allows to tell SceneryObjectWidgets apart from the other items in the QGraphicsScene
+	enum { Type = UserType + 1 };
+
+	/// \param spriteAtlas If the sprite is packed there, it is drawn from the shared page instead of a standalone pixmap
+	explicit SceneryObjectWidget(const SceneryObject& sceneryObject, int zorder = 0, bool bPreview = false, const SpriteAtlas* spriteAtlas = nullptr);
 	SceneryObjectWidget(const SceneryObjectWidget&)            = delete;
 	SceneryObjectWidget& operator=(const SceneryObjectWidget&) = delete;
 	void switchToPreview();
 	void switchToDisplay();
 
+	int type() const override;
+
+	QRectF boundingRect() const override;
+	QPainterPath shape() const override;
+	bool contains(const QPointF& point) const override;
+	void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+	/// Binds the widget to another SceneryObject
+	/// The pixmap is rebuilt only if the AssetImage, mirroring or ImageFilters differ from the currently displayed ones or the SpriteAtlas was rebuilt
+	void setSceneryObject(const SceneryObject& sceneryObject, int zorder = 0);
+
+	/// Applies position, scale, rotation, opacity and color multiplier of the SceneryObject without touching the pixmap, unless its ImageFilters changed
+	/// Called every frame for the animated SceneryObjects
+	void updateTransform(const SceneryObject& sceneryObject);
+
+	/// Replaces the ImageFilters of the displayed sprite, the pixmap is rebuilt only if they differ from the current ones
+	void setFilters(const std::vector<ImageFilter>& filters);
+
+	/// Looks up the bound AssetImage in the SpriteAtlas again, must be called after the SpriteAtlas is rebuilt
+	void refreshPixmap();
+
+	/// Replaces the displayed AssetImage, blending the old image into the new one
+	/// \param duration In milliseconds, 0 replaces the image immediately
+	void startTransition(const AssetImage* assetImage, Transition::Type type, uint duration);
+	/// Moves the Transition (if there is any) to the game clock's time
+	void advanceTransition(uint elapsedTime);
+
+	QString getSceneryObjectName() const noexcept;
+	/// Index of the bound SceneryObject in the container it was displayed from
+	int getSceneryObjectIndex()    const noexcept;
+
 private:
+	void updatePixmap(const SceneryObject& sceneryObject);
+	/// \return Whether the bound AssetImage was decoded again (e.g. at another scale) since its pixmap was made
+	bool isImageReloaded() const noexcept;
+
+	/// Rectangle of the displayed sprite, the `boundingRect()` also covers the old sprite during a Transition
+	QRectF spriteRect() const;
+
+	/// Draws the sprite multiplied by the `colorMultiplier_`, on the GPU if possible
+	void paintTinted(QPainter* painter);
+	/// CPU fallback of the tinting, the result is kept until the `colorMultiplier_` changes
+	const QPixmap& tintedPixmap();
+
 	QTransform transformMatrix_;
 	bool bPreview_ = false;
+
+	QString sceneryObjectName_  = "";
+	int     sceneryObjectIndex_ = 0;
+
+	/// Remembered to detect if the pixmap needs to be rebuilt
+	const AssetImage* assetImage_ = nullptr;
+	bool bMirrored_               = false;
+	/// Filtered sprites are not packed into the SpriteAtlas, they come from the SpritePixmapCache
+	std::vector<ImageFilter> filters_;
+	/// `QImage::cacheKey()` of the image that the pixmap was made from
+	qint64 imageKey_     = 0;
+	/// `AssetImage::getSourceScale()` of that image, applied to the transformation together with the pixmap
+	QSizeF sourceScale_  = QSizeF(1.0, 1.0);
+
+	QVarLengthArray<double, 4> colorMultiplier_ = { 1.0, 1.0, 1.0, 1.0 };
+	/// Set if the `colorMultiplier_` was changed by an Animation, such tints are not stored in the SpritePixmapCache, as every frame would add a new pixmap there
+	bool    bTintAnimated_ = false;
+	/// Result of the CPU tinting, null if it needs to be recalculated
+	QPixmap tintedPixmap_;
+	/// Untinted sprite that an animated tint is calculated from, kept so every frame only multiplies the colors, null if it needs to be fetched again
+	QImage  untintedImage_;
+
+	Transition transition_;
+	/// Where the old sprite is drawn during the `transition_`, in the new sprite's coordinates
+	QRectF     transitionFromRect_;
+
+	const SpriteAtlas*         spriteAtlas_           = nullptr;
+	/// Set if the sprite is drawn from the `spriteAtlas_`, the own pixmap is empty then
+	const SpriteAtlas::Region* spriteAtlasRegion_     = nullptr;
+	uint                       spriteAtlasGeneration_ = 0;
 };
@@ -0,0 +1,132 @@
+#include "pvnLib/Novel/Widget/SpriteAtlas.h"
+
+#include <algorithm>
+#include <QPainter>
+
+SpriteAtlas::SpriteAtlas(int pageSize, int maxSpriteSize)
+	: pageSize_(pageSize),
+	maxSpriteSize_(qMin(maxSpriteSize, pageSize - 2 * padding_))
+{
+}
+
+void SpriteAtlas::build(const std::vector<const AssetImage*>& sprites)
+{
+	std::vector<const QImage*> images;
+	images.reserve(sprites.size());
+	for (const AssetImage* sprite : sprites)
+	{
+		if (!sprite || !sprite->isLoaded())
+			continue;
+
+		const QImage* img = sprite->getImage();
+		if (img->isNull() || img->width() > maxSpriteSize_ || img->height() > maxSpriteSize_)
+			continue;
+
+		images.push_back(img);
+	}
+
+	//The same sprite might be used in many Events
+	std::sort(images.begin(), images.end(), [](const QImage* lhs, const QImage* rhs) { return lhs->cacheKey() < rhs->cacheKey(); });
+	images.erase(std::unique(images.begin(), images.end(), [](const QImage* lhs, const QImage* rhs) { return lhs->cacheKey() == rhs->cacheKey(); }), images.end());
+
+	std::vector<qint64> imageKeys;
+	imageKeys.reserve(images.size());
+	for (const QImage* img : images)
+		imageKeys.push_back(img->cacheKey());
+
+	if (imageKeys == packedImageKeys_)
+		return;
+
+	clear();
+	packedImageKeys_ = std::move(imageKeys);
+	if (images.empty())
+		return;
+
+	//Shelf packing: the tallest sprites go first, every shelf is as tall as its first sprite
+	std::sort(images.begin(), images.end(), [](const QImage* lhs, const QImage* rhs) { return lhs->height() > rhs->height(); });
+
+	struct Placement
+	{
+		const QImage* img;
+		int page;
+		QPoint pos;
+	};
+	std::vector<Placement> placements;
+	placements.reserve(images.size());
+
+	int page        = 0,
+		shelfY      = padding_,
+		shelfHeight = 0,
+		cursorX     = padding_;
+	for (const QImage* img : images)
+	{
+		if (cursorX + img->width() + padding_ > pageSize_)
+		{
+			shelfY     += shelfHeight + padding_;
+			cursorX     = padding_;
+			shelfHeight = 0;
+		}
+		if (shelfY + img->height() + padding_ > pageSize_)
+		{
+			++page;
+			shelfY      = padding_;
+			cursorX     = padding_;
+			shelfHeight = 0;
+		}
+		placements.push_back(Placement{ img, page, QPoint(cursorX, shelfY) });
+		cursorX    += img->width() + padding_;
+		shelfHeight = qMax(shelfHeight, img->height());
+	}
+
+	//Pages are uploaded once, then every sprite is drawn as a sub-rectangle of them
+	pages_.reserve(page + 1);
+	auto placementIt = placements.cbegin();
+	for (int i = 0; i <= page; ++i)
+	{
+		QImage pageImage(pageSize_, pageSize_, QImage::Format_ARGB32_Premultiplied);
+		pageImage.fill(Qt::transparent);
+
+		QPainter painter(&pageImage);
+		painter.setCompositionMode(QPainter::CompositionMode_Source);
+		for (; placementIt != placements.cend() && placementIt->page == i; ++placementIt)
+			painter.drawImage(placementIt->pos, *placementIt->img);
+		painter.end();
+
+		pages_.push_back(QPixmap::fromImage(std::move(pageImage)));
+	}
+
+	regions_.reserve(placements.size());
+	for (const Placement& placement : placements)
+		regions_.insert(placement.img->cacheKey(), Region{ &pages_[placement.page], QRect(placement.pos, placement.img->size()) });
+}
+
+void SpriteAtlas::clear() noexcept
+{
+	regions_.clear();
+	pages_.clear();
+	packedImageKeys_.clear();
+	++generation_;
+}
+
+const SpriteAtlas::Region* SpriteAtlas::getRegion(const AssetImage& assetImage) const
+{
+	const QImage* img = assetImage.getImage();
+	if (!img)
+		return nullptr;
+
+	auto it = regions_.constFind(img->cacheKey());
+	if (it == regions_.cend())
+		return nullptr;
+
+	return &it.value();
+}
+
+uint SpriteAtlas::getGeneration() const noexcept
+{
+	return generation_;
+}
+
+size_t SpriteAtlas::getPageCount() const noexcept
+{
+	return pages_.size();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <QHash>
+#include <QPixmap>
+#include <QRect>
+#include <vector>
+
+#include "pvnLib/Novel/Data/Asset/AssetImage.h"
+
+/// Packs small and medium sprites used by a Scene into a few shared pixmaps (pages)
+/// On the OpenGL viewport every page becomes a single texture, so drawing many sprites does not switch textures nor upload each sprite separately
+/// Only QPainter is used, so it works on every OpenGL implementation, including Mesa's software rasterizer
+class SpriteAtlas final
+{
+public:
+	/// Part of a page that holds a single sprite
+	struct Region
+	{
+		const QPixmap* page = nullptr;
+		QRect rect;
+	};
+
+	/// \param pageSize Width and height of a single page, it should not exceed GL_MAX_TEXTURE_SIZE of the weakest supported GPU
+	/// \param maxSpriteSize Sprites with a larger side are not packed, as they would waste most of a page
+	explicit SpriteAtlas(int pageSize = 2048, int maxSpriteSize = 1024);
+	SpriteAtlas(const SpriteAtlas&)            = delete;
+	SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+	/// Packs the loaded sprites into pages, unless exactly the same set of images is already packed
+	/// Not loaded and oversized AssetImages are skipped
+	void build(const std::vector<const AssetImage*>& sprites);
+	void clear() noexcept;
+
+	/// \return Region of the packed AssetImage or nullptr if it was not packed (the caller should use a standalone pixmap then)
+	const Region* getRegion(const AssetImage& assetImage) const;
+
+	/// Changes every time the pages are rebuilt, so the users can tell that their Regions are no longer valid
+	uint getGeneration() const noexcept;
+
+	size_t getPageCount() const noexcept;
+
+private:
+	int pageSize_      = 2048;
+	int maxSpriteSize_ = 1024;
+
+	/// Transparent gap between the sprites, so the smooth transformation does not sample pixels of the neighbours
+	static constexpr int padding_ = 2;
+
+	uint generation_ = 0;
+
+	/// Sorted `QImage::cacheKey()`s of the packed images, to skip rebuilding the same atlas
+	std::vector<qint64> packedImageKeys_;
+
+	std::vector<QPixmap> pages_;
+
+	QHash<qint64, Region> regions_;
+};
@@ -0,0 +1,88 @@
+#include "pvnLib/Novel/Widget/SpritePixmapCache.h"
+
+#include <cmath>
+
+#include "pvnLib/Novel/Widget/ImageFilterPipeline.h"
+
+size_t qHash(const SpritePixmapCache::Key& key, size_t seed) noexcept
+{
+	return qHashMulti(seed, key.imageKey, key.bMirrored, key.tint, qHash(key.filters));
+}
+
+SpritePixmapCache& SpritePixmapCache::getInstance() noexcept
+{
+	static SpritePixmapCache spritePixmapCache;
+	return spritePixmapCache;
+}
+
+SpritePixmapCache::SpritePixmapCache()
+	//256 MB should fit every sprite of a few Scenes at 1600x900
+	: cache_(256 * 1024)
+{
+	AssetImage::setOnUnloadListener([this](const AssetImage& assetImage) { remove(assetImage); });
+}
+
+SpritePixmapCache::~SpritePixmapCache()
+{
+	AssetImage::setOnUnloadListener(nullptr);
+}
+
+QPixmap SpritePixmapCache::getPixmap(const AssetImage& assetImage, bool bMirrored, const QVarLengthArray<double, 4>& colorMultiplier, const std::vector<ImageFilter>& filters)
+{
+	const QImage* img = assetImage.getImage();
+	if (!img || img->isNull())
+		return QPixmap();
+
+	const quint64 tint = quantizeTint(colorMultiplier);
+	const Key key{ img->cacheKey(), bMirrored, tint, filters };
+	if (QPixmap* cached = cache_.object(key))
+		return *cached;
+
+	QImage converted = bMirrored ? img->mirrored(true, false) : *img;
+	if (!filters.empty())
+		converted = NovelLib::ImageFilterPipeline::apply(converted, filters);
+	if (!isIdentityTint(colorMultiplier))
+		converted = NovelLib::ImageFilterPipeline::multiplyColors(converted, colorMultiplier);
+
+	QPixmap* pixmap = new QPixmap(QPixmap::fromImage(std::move(converted)));
+	QPixmap  ret    = *pixmap;
+	//Cost is in kilobytes, so big backgrounds do not starve the sprites
+	const qsizetype cost = qMax<qsizetype>(1, static_cast<qsizetype>(pixmap->width()) * pixmap->height() * pixmap->depth() / 8 / 1024);
+	if (cache_.insert(key, pixmap, cost) && !imageKeys_.contains(key.imageKey, key))
+		imageKeys_.insert(key.imageKey, key);
+
+	return ret;
+}
+
+bool SpritePixmapCache::isIdentityTint(const QVarLengthArray<double, 4>& colorMultiplier) noexcept
+{
+	return quantizeTint(colorMultiplier) == quantizeTint({ 1.0, 1.0, 1.0, 1.0 });
+}
+
+quint64 SpritePixmapCache::quantizeTint(const QVarLengthArray<double, 4>& colorMultiplier) noexcept
+{
+	quint64 ret = 0;
+	for (int i = 0; i != 4; ++i)
+		ret = (ret << 16) | static_cast<quint64>(std::lround(qBound(0.0, colorMultiplier[i], i == 3 ? 1.0 : 255.0) * 256.0));
+	return ret;
+}
+
+void SpritePixmapCache::remove(const AssetImage& assetImage) noexcept
+{
+	const QImage* img = assetImage.getImage();
+	if (!img)
+		return;
+
+	//Walks the keys in place instead of copying them with `values()`, so nothing is allocated during `AssetImage::unload()`
+	const qint64 imageKey = img->cacheKey();
+	for (auto it = imageKeys_.constFind(imageKey); it != imageKeys_.cend() && it.key() == imageKey; ++it)
+		cache_.remove(it.value());
+	imageKeys_.remove(imageKey);
+}
+
+void SpritePixmapCache::clear() noexcept
+{
+	cache_.clear();
+	imageKeys_.clear();
+}
+
@@ -0,0 +1,57 @@
+#pragma once
+#include <QCache>
+#include <QPixmap>
+
+#include "pvnLib/Novel/Data/Asset/AssetImage.h"
+#include "pvnLib/Novel/Data/Visual/Scenery/ImageFilter.h"
+
+/// Stores pixmaps created from AssetImages, so a sprite is copied, mirrored and uploaded only once, no matter how many Events display it
+/// Pixmaps are keyed by the loaded image (`QImage::cacheKey()`), mirroring, quantized color multiplier and the ImageFilter chain, so reloading an AssetImage automatically invalidates the old entries
+/// **Singleton**
+class SpritePixmapCache final
+{
+public:
+	static SpritePixmapCache& getInstance() noexcept;
+	SpritePixmapCache(const SpritePixmapCache&)            noexcept = delete;
+	SpritePixmapCache(SpritePixmapCache&&)                 noexcept = delete;
+	SpritePixmapCache& operator=(const SpritePixmapCache&) noexcept = delete;
+	~SpritePixmapCache();
+
+	/// \return Shared pixmap of the AssetImage or a null QPixmap if the AssetImage is not loaded
+	/// \param colorMultiplier Multiplies every channel (red, green, blue, alpha) of the pixels, the multipliers are quantized to 1/256 steps
+	/// \param filters Applied before the tint, a filtered sprite is calculated only once per chain
+	QPixmap getPixmap(const AssetImage& assetImage, bool bMirrored = false, const QVarLengthArray<double, 4>& colorMultiplier = { 1.0, 1.0, 1.0, 1.0 }, const std::vector<ImageFilter>& filters = {});
+
+	/// \return Whether the `colorMultiplier` leaves the pixels unchanged (within the quantization)
+	static bool isIdentityTint(const QVarLengthArray<double, 4>& colorMultiplier) noexcept;
+
+	/// Drops all pixmaps created from this AssetImage, so the memory is freed immediately
+	/// Registered as the AssetImage's unload listener, as the pixmaps are keyed by the image and would never be hit again
+	void remove(const AssetImage& assetImage) noexcept;
+	void clear() noexcept;
+
+private:
+	//Nothing can create the SpritePixmapCache, but its methods
+	SpritePixmapCache();
+
+	struct Key
+	{
+		qint64 imageKey = 0;
+		bool   bMirrored = false;
+		quint64 tint     = 0;
+		/// Compared as a whole, so two chains with the same hash never share a pixmap
+		std::vector<ImageFilter> filters;
+
+		bool operator==(const Key& obj) const noexcept = default;
+	};
+	friend size_t qHash(const Key& key, size_t seed) noexcept;
+
+	/// Packs the multipliers as 8.8 fixed-point values
+	static quint64 quantizeTint(const QVarLengthArray<double, 4>& colorMultiplier) noexcept;
+
+	/// Cost is in kilobytes, the least recently used pixmaps are dropped first
+	QCache<Key, QPixmap> cache_;
+
+	/// Remembers which keys were created from which image, so `remove()` does not need to scan the whole cache
+	QMultiHash<qint64, Key> imageKeys_;
+};
@@ -0,0 +1,182 @@
+#include "pvnLib/Novel/Widget/SpriteTintRenderer.h"
+
+#include <QOpenGLContext>
+#include <QOpenGLFunctions>
+#include <QOpenGLPaintDevice>
+#include <QPaintEngine>
+#include <utility>
+
+#include "pvnLib/Exceptions.h"
+
+namespace
+{
+	const char* const VERTEX_SHADER =
+		"attribute highp vec2 vertexCoord;\n"
+		"attribute highp vec2 textureCoord;\n"
+		"varying highp vec2 uv;\n"
+		"void main()\n"
+		"{\n"
+		"	uv          = textureCoord;\n"
+		"	gl_Position = vec4(vertexCoord, 0.0, 1.0);\n"
+		"}\n";
+
+	//The texture is not premultiplied, the output is, so it can be blended the same way QPainter does
+	const char* const FRAGMENT_SHADER =
+		"uniform sampler2D sprite;\n"
+		"uniform mediump vec4 colorMultiplier;\n"
+		"varying highp vec2 uv;\n"
+		"void main()\n"
+		"{\n"
+		"	mediump vec4  color = texture2D(sprite, uv);\n"
+		"	mediump float alpha = color.a * colorMultiplier.a;\n"
+		"	gl_FragColor = vec4(clamp(color.rgb * colorMultiplier.rgb, 0.0, 1.0) * alpha, alpha);\n"
+		"}\n";
+}
+
+SpriteTintRenderer& SpriteTintRenderer::getInstance() noexcept
+{
+	static SpriteTintRenderer spriteTintRenderer;
+	return spriteTintRenderer;
+}
+
+SpriteTintRenderer::SpriteTintRenderer()
+	//Same budget as the SpritePixmapCache, so every cached sprite can have its texture
+	: textures_(256 * 1024)
+{
+}
+
+bool SpriteTintRenderer::isSupported(const QPainter* painter) noexcept
+{
+	return painter && painter->paintEngine() && painter->paintEngine()->type() == QPaintEngine::OpenGL2 && QOpenGLContext::currentContext();
+}
+
+bool SpriteTintRenderer::initialize()
+{
+	QOpenGLContext* context = QOpenGLContext::currentContext();
+	if (context_ == context)
+		return program_ != nullptr;
+
+	//The SceneWidget's viewport might have been recreated, the old resources died with its context
+	program_.reset();
+	textures_.clear();
+	context_       = context;
+	bShaderFailed_ = false;
+	QObject::connect(context, &QOpenGLContext::aboutToBeDestroyed, context, [this] { releaseResources(); });
+
+	program_ = std::make_unique<QOpenGLShaderProgram>();
+	program_->addShaderFromSourceCode(QOpenGLShader::Vertex,   VERTEX_SHADER);
+	program_->addShaderFromSourceCode(QOpenGLShader::Fragment, FRAGMENT_SHADER);
+	program_->bindAttributeLocation("vertexCoord",  0);
+	program_->bindAttributeLocation("textureCoord", 1);
+	if (!program_->link())
+	{
+		qCritical() << NovelLib::ErrorType::General << "Could not compile the sprite tint shader, falling back to the CPU tinting:" << program_->log();
+		program_.reset();
+		bShaderFailed_ = true;
+		return false;
+	}
+	return true;
+}
+
+void SpriteTintRenderer::releaseResources()
+{
+	//Textures and the program have to be deleted while their context is still current
+	textures_.clear();
+	program_.reset();
+	context_ = nullptr;
+}
+
+QOpenGLTexture* SpriteTintRenderer::getTexture(const QPixmap& pixmap)
+{
+	if (QOpenGLTexture* cached = textures_.object(pixmap.cacheKey()))
+		return cached;
+
+	QOpenGLTexture* texture = new QOpenGLTexture(pixmap.toImage().convertToFormat(QImage::Format_RGBA8888), QOpenGLTexture::DontGenerateMipMaps);
+	texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
+	texture->setWrapMode(QOpenGLTexture::ClampToEdge);
+
+	const qsizetype cost = qMax<qsizetype>(1, static_cast<qsizetype>(pixmap.width()) * pixmap.height() * 4 / 1024);
+	if (!textures_.insert(pixmap.cacheKey(), texture, cost))
+		//Bigger than the whole budget, QCache already deleted it
+		return nullptr;
+	return texture;
+}
+
+bool SpriteTintRenderer::draw(QPainter* painter, const QRectF& target, const QPixmap& pixmap, const QRect& source, bool bMirrored, const QVarLengthArray<double, 4>& colorMultiplier)
+{
+	if (pixmap.isNull() || !isSupported(painter) || (bShaderFailed_ && context_ == QOpenGLContext::currentContext()))
+		return false;
+
+	//Everything that QPainter queued must reach the framebuffer before the native drawing
+	painter->beginNativePainting();
+	if (!initialize())
+	{
+		painter->endNativePainting();
+		return false;
+	}
+	QOpenGLTexture* texture = getTexture(pixmap);
+	if (!texture)
+	{
+		painter->endNativePainting();
+		return false;
+	}
+
+	QOpenGLFunctions* gl = QOpenGLContext::currentContext()->functions();
+	GLint viewport[4];
+	gl->glGetIntegerv(GL_VIEWPORT, viewport);
+
+	//QPainter's logical coordinates are mapped to the device pixels and then to the normalized device coordinates
+	//QOpenGLWidget's framebuffer is not flipped, so the top of the painter is at the bottom of the framebuffer (see `QOpenGLPaintDevice::paintFlipped()`)
+	const QTransform transform = painter->combinedTransform();
+	const double     ratio     = painter->device()->devicePixelRatioF();
+	const auto*      device    = dynamic_cast<const QOpenGLPaintDevice*>(painter->paintEngine()->paintDevice());
+	const double     flip      = device && device->paintFlipped() ? -1.0 : 1.0;
+	auto toDevice = [&](const QPointF& point) -> QPointF
+	{
+		const QPointF mapped = transform.map(point) * ratio;
+		return { 2.0 * mapped.x() / viewport[2] - 1.0, flip * (2.0 * mapped.y() / viewport[3] - 1.0) };
+	};
+
+	const QPointF topLeft     = toDevice(target.topLeft()),
+				  topRight    = toDevice(target.topRight()),
+				  bottomLeft  = toDevice(target.bottomLeft()),
+				  bottomRight = toDevice(target.bottomRight());
+
+	float       left   = static_cast<float>(source.left())       / pixmap.width(),
+				right  = static_cast<float>(source.right() + 1)  / pixmap.width();
+	const float top    = static_cast<float>(source.top())        / pixmap.height(),
+				bottom = static_cast<float>(source.bottom() + 1) / pixmap.height();
+	if (bMirrored)
+		std::swap(left, right);
+
+	const GLfloat vertices[] = { static_cast<GLfloat>(topLeft.x()),     static_cast<GLfloat>(topLeft.y()),
+								 static_cast<GLfloat>(topRight.x()),    static_cast<GLfloat>(topRight.y()),
+								 static_cast<GLfloat>(bottomLeft.x()),  static_cast<GLfloat>(bottomLeft.y()),
+								 static_cast<GLfloat>(bottomRight.x()), static_cast<GLfloat>(bottomRight.y()) };
+	const GLfloat textureCoords[] = { left, top, right, top, left, bottom, right, bottom };
+
+	program_->bind();
+	program_->setUniformValue("sprite", 0);
+	program_->setUniformValue("colorMultiplier", static_cast<GLfloat>(colorMultiplier[0]), static_cast<GLfloat>(colorMultiplier[1]), static_cast<GLfloat>(colorMultiplier[2]),
+							  static_cast<GLfloat>(qBound(0.0, colorMultiplier[3] * painter->opacity(), 1.0)));
+
+	gl->glActiveTexture(GL_TEXTURE0);
+	texture->bind();
+	gl->glEnable(GL_BLEND);
+	gl->glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+	//Client-side arrays, QPainter's vertex buffer might still be bound
+	gl->glBindBuffer(GL_ARRAY_BUFFER, 0);
+	program_->enableAttributeArray(0);
+	program_->enableAttributeArray(1);
+	program_->setAttributeArray(0, GL_FLOAT, vertices,      2);
+	program_->setAttributeArray(1, GL_FLOAT, textureCoords, 2);
+	gl->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	program_->disableAttributeArray(0);
+	program_->disableAttributeArray(1);
+
+	texture->release();
+	program_->release();
+	painter->endNativePainting();
+	return true;
+}
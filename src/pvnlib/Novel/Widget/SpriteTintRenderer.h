@@ -0,0 +1,47 @@
+#pragma once
+#include <QCache>
+#include <QOpenGLShaderProgram>
+#include <QOpenGLTexture>
+#include <QPainter>
+#include <QPixmap>
+#include <QVarLengthArray>
+#include <memory>
+
+/// Draws sprites multiplied by a color on the OpenGL viewport, the multiplication is done by a fragment shader, so animating the tint costs nothing on the CPU
+/// If the painter does not paint with OpenGL (or the shader cannot be compiled), `draw()` fails and the caller should fall back to the SpritePixmapCache's tinted pixmaps
+/// **Singleton**
+class SpriteTintRenderer final
+{
+public:
+	static SpriteTintRenderer& getInstance() noexcept;
+	SpriteTintRenderer(const SpriteTintRenderer&)            noexcept = delete;
+	SpriteTintRenderer(SpriteTintRenderer&&)                 noexcept = delete;
+	SpriteTintRenderer& operator=(const SpriteTintRenderer&) noexcept = delete;
+
+	/// Draws the `source` part of the pixmap into the `target` rectangle (in the painter's coordinates), respecting the painter's transformation and opacity
+	/// \param colorMultiplier Multiplies every channel (red, green, blue, alpha) of the pixels
+	/// \return Whether the sprite was drawn
+	bool draw(QPainter* painter, const QRectF& target, const QPixmap& pixmap, const QRect& source, bool bMirrored, const QVarLengthArray<double, 4>& colorMultiplier);
+
+	/// \return Whether the painter paints with OpenGL, so `draw()` can succeed
+	static bool isSupported(const QPainter* painter) noexcept;
+
+private:
+	//Nothing can create the SpriteTintRenderer, but its methods
+	SpriteTintRenderer();
+
+	/// Compiles the shader for the current OpenGL context, if it was not done yet
+	bool initialize();
+	/// Must be called with the owning OpenGL context being current
+	void releaseResources();
+
+	/// \return Texture with the pixmap's content, it is uploaded only once per pixmap
+	QOpenGLTexture* getTexture(const QPixmap& pixmap);
+
+	const void* context_ = nullptr;
+	bool bShaderFailed_  = false;
+
+	std::unique_ptr<QOpenGLShaderProgram> program_;
+	/// Keyed by `QPixmap::cacheKey()`, the SpritePixmapCache and SpriteAtlas keep the pixmaps alive, so the keys stay unique
+	QCache<qint64, QOpenGLTexture> textures_;
+};
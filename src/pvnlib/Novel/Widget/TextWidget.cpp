@@ -3,20 +3,14 @@
 #include <QGraphicsScene>
 #include <QPainter>
 
-#define RESOLUTION_X 1600.0
-#define RESOLUTION_Y 900.0
+#include "pvnLib/Novel/Audio/AudioEngine.h"
+#include "pvnLib/Novel/Audio/VoiceLineStreamer.h"
+#include "pvnLib/Novel/Data/Visual/Resolution.h"
 
-TextWidget::TextWidget(QGraphicsScene* scene, const std::vector<Sentence>& sentences, uint sentenceReadIndex, uint cps, bool bPreview)
+TextWidget::TextWidget(bool bPreview)
 	: QGraphicsWidget(),
-	sentenceReadIndex_(sentenceReadIndex),
 	bPreview_(bPreview)
 {
-	if (sentences.size() <= 0)
-	{
-		qCritical() << NovelLib::ErrorType::SentenceInvalid << "Cannot construct a TextWidget without Sentences";
-		return;
-	}
-
 	//todo: not supported yet
 	/*if (preview_)
 	{
@@ -25,33 +19,64 @@ TextWidget::TextWidget(QGraphicsScene* scene, const std::vector<Sentence>& sente
 		setFlag(ItemSendsGeometryChanges);
 	}*/
 
-	NovelSettings& novelSettings = NovelSettings::getInstance();
-
-	for (const Sentence& sentence : sentences)
-	{
-		names_.emplace_back(sentence.displayedName);
-		text_.emplace_back(sentence.translation.text());
-		lengths_.push_back(static_cast<int>(text_.back().length()));
-		cpsList_.push_back((sentence.cpsOverwrite == 0) ? qRound(sentence.cpsMultiplier * novelSettings.cps) : sentence.cpsOverwrite);
-		requiredTimes_.push_back(lengths_.back() * 1000.0 / cpsList_.back());
-	}
-
 	layout_ = new QGraphicsLinearLayout(Qt::Vertical);
 	layout_->setContentsMargins(8,8,8,8);
 	layout_->setSpacing(16);
 
-	nameWidget_ = new DisplayNameWidget(names_[sentenceReadIndex_]);
-	if (!(bNarrate_ = names_[sentenceReadIndex_].isEmpty()))
-		layout_->addItem(nameWidget_);
-	layout_->addItem(textWidget_ = new DisplayTextWidget(""));
+	//Parented right away, since it's not in the layout while a narrator speaks and has to be deleted with the TextWidget anyway
+	nameWidget_ = new DisplayNameWidget("");
+	nameWidget_->setParentItem(this);
+	layout_->addItem(textWidget_ = new DisplayTextWidget());
 	setLayout(layout_);
-	setPos((RESOLUTION_X - minimumWidth()) / 2.0, RESOLUTION_Y * 0.95 - minimumHeight());
 
 	drawPen_.setColor(QColor(60, 68, 107, 255));
 	drawPen_.setWidth(2);		
 	connect(&cpsCallTimer_, &QTimer::timeout, this, &TextWidget::updateText);
-	cpsCallTimer_.start();
-	cpsTimer_.start();
+	hide();
+}
+
+void TextWidget::setSentences(const std::vector<Sentence>& sentences, uint sentenceReadIndex)
+{
+	cpsCallTimer_.stop();
+	if (sentences.size() <= 0)
+	{
+		qCritical() << NovelLib::ErrorType::SentenceInvalid << "Cannot display a TextWidget without Sentences";
+		lengths_.clear();
+		hide();
+		return;
+	}
+
+	NovelSettings& novelSettings = NovelSettings::getInstance();
+	AudioEngine&   audioEngine   = AudioEngine::getInstance();
+
+	//The containers keep their capacity, so rebinding a TextWidget to a similar dialogue does not allocate them again
+	names_.clear();
+	texts_.clear();
+	blipSounds_.clear();
+	cpsList_.clear();
+	lengths_.clear();
+	requiredTimes_.clear();
+	for (const Sentence& sentence : sentences)
+	{
+		names_.emplace_back(sentence.displayedName);
+		texts_.emplace_back(sentence.translation.text());
+		lengths_.push_back(static_cast<int>(texts_.back().length()));
+		cpsList_.push_back((sentence.cpsOverwrite == 0) ? qRound(sentence.cpsMultiplier * novelSettings.cps) : sentence.cpsOverwrite);
+		requiredTimes_.push_back(lengths_.back() * 1000.0 / cpsList_.back());
+
+		const Voice* voice = sentence.getVoice();
+		blipSounds_.push_back((!bPreview_ && voice && !voice->insertionSound.soundFilePath.isEmpty()) ? &voice->insertionSound : nullptr);
+		//Pinned (once decoded in the background), so revealing a character only tells the mixer to play it
+		if (blipSounds_.back())
+			audioEngine.prepareBlip(*blipSounds_.back());
+	}
+
+	//Every Sentence is laid out here once, revealing the text only draws more of the shaped glyphs
+	textWidget_->setTexts(texts_);
+	if (!bPreview_)
+		VoiceLineStreamer::getInstance().setSentences(sentences);
+	showSentence(qMin(sentenceReadIndex, static_cast<uint>(sentences.size() - 1)));
+	show();
 }
 
 void TextWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
@@ -66,6 +91,10 @@ void TextWidget::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
 
 void TextWidget::mouseClicked()
 {
+	//Pooled TextWidget waits hidden for the next dialogue
+	if (!isVisible() || lengths_.empty())
+		return;
+
 	if (cpsTimer_.elapsed() < requiredTimes_[sentenceReadIndex_])
 	{
 		if (!bSkip_)
@@ -73,8 +102,7 @@ void TextWidget::mouseClicked()
 			bSkip_ = true;
 			clickTimePoint_ = cpsTimer_.elapsed();
 			cpsCallTimer_.stop();
-			textWidget_->text = QString::fromRawData(text_[sentenceReadIndex_].data(), lengths_[sentenceReadIndex_]);
-			update();
+			textWidget_->revealAll();
 			return;
 		}
 	}
@@ -82,47 +110,73 @@ void TextWidget::mouseClicked()
 	if (cpsTimer_.elapsed() - clickTimePoint_ < 150)
 		return;
 
-	if ((sentenceReadIndex_ + 1) == text_.size())
-	{
+	if ((sentenceReadIndex_ + 1) == lengths_.size())
 		emit pendNovelEnd();
-	}
 	else
-	{
-		++sentenceReadIndex_;
-		bSkip_    = false;
+		showSentence(sentenceReadIndex_ + 1);
+}
+
+void TextWidget::showSentence(uint sentenceReadIndex)
+{
+	sentenceReadIndex_ = sentenceReadIndex;
+	bSkip_             = false;
+	clickTimePoint_    = 0.0;
+
+	if (!bNarrate_)
+		layout_->removeItem(nameWidget_);
+	layout_->removeItem(textWidget_);
 
-		if (!bNarrate_)
-			layout_->removeItem(nameWidget_);
-		layout_->removeItem(textWidget_);
+	nameWidget_->text = names_[sentenceReadIndex_];
+	textWidget_->showText(sentenceReadIndex_);
 
-		nameWidget_->text = names_[sentenceReadIndex_];
-		textWidget_->text = "";
+	if (!(bNarrate_ = names_[sentenceReadIndex_].isEmpty()))
+		layout_->addItem(nameWidget_);
+	layout_->addItem(textWidget_);
 
-		if (!(bNarrate_ = names_[sentenceReadIndex_].isEmpty()))
-			layout_->addItem(nameWidget_);
-		layout_->addItem(textWidget_);
+	setPos((RESOLUTION_X - minimumWidth()) / 2.0, RESOLUTION_Y * 0.95 - minimumHeight());		
+	update();
 
-		setPos((RESOLUTION_X - minimumWidth()) / 2.0, RESOLUTION_Y * 0.95 - minimumHeight());		
-		update();
+	cpsCallTimer_.start();
+	cpsTimer_.restart();
+
+	if (!bPreview_)
+		VoiceLineStreamer::getInstance().play(sentenceReadIndex_);
+}
 
-		cpsCallTimer_.start();
-		cpsTimer_.restart();
+void TextWidget::hideEvent(QHideEvent* event)
+{
+	QGraphicsWidget::hideEvent(event);
+	cpsCallTimer_.stop();
+	if (!bPreview_)
+	{
+		AudioEngine::getInstance().releaseBlips();
+		VoiceLineStreamer::getInstance().release();
 	}
 }
 
 void TextWidget::updateText()
 {
-	static unsigned int lastCharacterDisplay = 0;
+	if (lengths_.empty())
+		return;
 
 	double elapsedTime    = cpsTimer_.elapsed();
 	int charactersDisplay = qMin(lengths_[sentenceReadIndex_], static_cast<const uint>(qRound(elapsedTime / 1000.0 * cpsList_[sentenceReadIndex_])));
 
-	if (lastCharacterDisplay == charactersDisplay)
-		return;
+	const int previousCharactersDisplay = textWidget_->getRevealedLength();
+	//Repaints only the newly revealed characters, not the whole TextWidget
+	textWidget_->setRevealedLength(charactersDisplay);
 
-	lastCharacterDisplay = charactersDisplay;
-	textWidget_->text = text_[sentenceReadIndex_].left(charactersDisplay);
-	update();
+	//The AudioEngine rate-limits the blips, so several characters revealed by one tick play at most one
+	if (const Sound* blipSound = blipSounds_[sentenceReadIndex_])
+	{
+		const QString& text = texts_[sentenceReadIndex_];
+		for (int i = previousCharactersDisplay; i < charactersDisplay && i < text.length(); ++i)
+			if (!text[i].isSpace())
+			{
+				AudioEngine::getInstance().playBlip(*blipSound);
+				break;
+			}
+	}
 	if (elapsedTime >= requiredTimes_[sentenceReadIndex_])
 		cpsCallTimer_.stop();
 }
\ No newline at end of file
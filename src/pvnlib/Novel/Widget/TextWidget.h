@@ -15,12 +15,16 @@ class TextWidget : public QGraphicsWidget
 {
 	Q_OBJECT
 public:
-	TextWidget(QGraphicsScene* scene, const std::vector<Sentence>& sentences, uint sentenceReadIndex = 0u, uint cps = 40u, bool bPreview = false);
+	/// Creates an empty and hidden TextWidget, which is reused for every dialogue (see `setSentences()`)
+	explicit TextWidget(bool bPreview = false);
 	TextWidget(const TextWidget&)            = delete;
 	TextWidget& operator=(const TextWidget&) = delete;
 	
 	void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
 
+	/// Rebinds the TextWidget to another dialogue and shows it, the child widgets, layout and timers are kept
+	void setSentences(const std::vector<Sentence>& sentences, uint sentenceReadIndex = 0u);
+
 	//todo: not supported yet
 	//void switchToPreview();
 	//void switchToDisplay();
@@ -32,8 +36,13 @@ public slots:
 	void mouseClicked();
 
 private:
+	void showSentence(uint sentenceReadIndex);
+	void hideEvent(QHideEvent* event) override;
+
 	std::vector<QString> names_,
-						 text_;
+						 texts_;
+	/// `insertionSound` of every Sentence's Voice, nullptr if there is none
+	std::vector<const Sound*> blipSounds_;
 
 	QGraphicsLinearLayout* layout_     = nullptr;
 	DisplayNameWidget*     nameWidget_ = nullptr;
@@ -51,7 +60,8 @@ private:
 	double clickTimePoint_ = 0.0;
 	std::vector<double> requiredTimes_;
 
-	bool bNarrate_ = false,
+	/// The DisplayNameWidget starts outside the layout
+	bool bNarrate_ = true,
 		 bSkip_    = false,
 		 bPreview_ = false;
 };
@@ -0,0 +1,115 @@
+#include "pvnLib/Novel/Widget/TiledBackground.h"
+
+#include <QPainter>
+
+TiledBackground::TiledBackground(int marginTiles)
+	: marginTiles_(qMax(0, marginTiles))
+{
+}
+
+void TiledBackground::setTiledImagePack(const TiledImagePack* tiledImagePack, const QSizeF& sceneSize)
+{
+	tiles_.clear();
+	tiledImagePack_ = tiledImagePack;
+	sceneSize_      = sceneSize;
+	cameraPos_      = QPointF(0.0, 0.0);
+	if (!tiledImagePack_ || tiledImagePack_->getSourceSize().isEmpty())
+	{
+		tiledImagePack_ = nullptr;
+		return;
+	}
+
+	scale_ = sceneSize_.height() / tiledImagePack_->getSourceSize().height();
+	streamTiles();
+}
+
+bool TiledBackground::isActive() const noexcept
+{
+	return tiledImagePack_ != nullptr;
+}
+
+void TiledBackground::setCameraPos(const QPointF& cameraPos)
+{
+	if (!tiledImagePack_)
+		return;
+
+	const QSizeF scaledSize = QSizeF(tiledImagePack_->getSourceSize()) * scale_;
+	cameraPos_ = QPointF(qBound(0.0, cameraPos.x(), qMax(0.0, scaledSize.width()  - sceneSize_.width())),
+						 qBound(0.0, cameraPos.y(), qMax(0.0, scaledSize.height() - sceneSize_.height())));
+	streamTiles();
+}
+
+QPointF TiledBackground::getCameraPos() const noexcept
+{
+	return cameraPos_;
+}
+
+void TiledBackground::paint(QPainter* painter, const QRectF& exposedRect)
+{
+	if (!tiledImagePack_)
+		return;
+
+	painter->save();
+	painter->setRenderHint(QPainter::SmoothPixmapTransform);
+	//Background pixels are mapped into the scene, so the tiles can be drawn at their own positions
+	painter->translate(-cameraPos_);
+	painter->scale(scale_, scale_);
+
+	const QRectF exposedSourceRect(exposedRect.topLeft() / scale_ + cameraPos_ / scale_, exposedRect.size() / scale_);
+	const QRect  visibleTiles = tilesInView(0);
+	for (int row = visibleTiles.top(); row <= visibleTiles.bottom(); ++row)
+		for (int column = visibleTiles.left(); column <= visibleTiles.right(); ++column)
+		{
+			const QRect tileRect = tiledImagePack_->getTileRect(column, row);
+			if (tileRect.intersects(exposedSourceRect.toAlignedRect()))
+				painter->drawPixmap(tileRect.topLeft(), tile(column, row));
+		}
+
+	painter->restore();
+}
+
+qsizetype TiledBackground::getResidentTileCount() const noexcept
+{
+	return tiles_.size();
+}
+
+QRect TiledBackground::tilesInView(int margin) const
+{
+	const int   tileSize = tiledImagePack_->getTileSize();
+	const QRectF viewRect(cameraPos_ / scale_, sceneSize_ / scale_);
+
+	const int left   = qMax(0,                                    static_cast<int>(viewRect.left()   / tileSize) - margin),
+			  top    = qMax(0,                                    static_cast<int>(viewRect.top()    / tileSize) - margin),
+			  right  = qMin(tiledImagePack_->getColumnCount() - 1, static_cast<int>(viewRect.right()  / tileSize) + margin),
+			  bottom = qMin(tiledImagePack_->getRowCount()    - 1, static_cast<int>(viewRect.bottom() / tileSize) + margin);
+	return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+void TiledBackground::streamTiles()
+{
+	const QRect tilesInMargin = tilesInView(marginTiles_);
+	const int   columnCount   = tiledImagePack_->getColumnCount();
+
+	//Evicting first keeps the peak memory at the margin's size
+	for (auto it = tiles_.begin(); it != tiles_.end();)
+	{
+		if (!tilesInMargin.contains(it.key() % columnCount, it.key() / columnCount))
+			it = tiles_.erase(it);
+		else
+			++it;
+	}
+
+	for (int row = tilesInMargin.top(); row <= tilesInMargin.bottom(); ++row)
+		for (int column = tilesInMargin.left(); column <= tilesInMargin.right(); ++column)
+			tile(column, row);
+}
+
+const QPixmap& TiledBackground::tile(int column, int row)
+{
+	const int key = row * tiledImagePack_->getColumnCount() + column;
+	auto it = tiles_.find(key);
+	if (it == tiles_.end())
+		it = tiles_.insert(key, QPixmap::fromImage(tiledImagePack_->readTile(column, row)));
+
+	return it.value();
+}
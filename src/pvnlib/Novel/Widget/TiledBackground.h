@@ -0,0 +1,54 @@
+#pragma once
+#include <QHash>
+#include <QPixmap>
+#include <QPointF>
+#include <QRect>
+
+#include "pvnLib/Novel/Data/Asset/TiledImagePack.h"
+
+class QPainter;
+
+/// Streams tiles of a TiledImagePack background, so only the part seen by the camera (plus a margin) is decoded and kept in the memory
+/// The background is scaled to fill the scene's height and the camera pans over it, the tiles that leave the margin are evicted, so the memory usage does not depend on the background's size
+class TiledBackground final
+{
+public:
+	/// \param marginTiles How many tiles around the visible ones are decoded ahead, so panning does not wait for decoding
+	explicit TiledBackground(int marginTiles = 1);
+	TiledBackground(const TiledBackground&)            = delete;
+	TiledBackground& operator=(const TiledBackground&) = delete;
+
+	/// Drops all the tiles of the previous TiledImagePack
+	/// \param tiledImagePack nullptr disables the TiledBackground
+	void setTiledImagePack(const TiledImagePack* tiledImagePack, const QSizeF& sceneSize);
+	bool isActive() const noexcept;
+
+	/// Moves the camera, which is clamped to the background's edges
+	/// Decodes the tiles that came into the margin and evicts the ones that left it
+	/// \param cameraPos Top-left corner of the scene on the scaled background
+	void setCameraPos(const QPointF& cameraPos);
+	QPointF getCameraPos() const noexcept;
+
+	/// Draws the visible tiles over the scene, decoding the missing ones
+	void paint(QPainter* painter, const QRectF& exposedRect);
+
+	/// \return Number of the currently decoded tiles
+	qsizetype getResidentTileCount() const noexcept;
+
+private:
+	/// \return Columns and rows of the tiles intersecting the camera, extended by `margin` tiles
+	QRect tilesInView(int margin) const;
+	void streamTiles();
+	const QPixmap& tile(int column, int row);
+
+	const TiledImagePack* tiledImagePack_ = nullptr;
+	int marginTiles_ = 1;
+
+	QSizeF  sceneSize_;
+	/// Scene units per background pixel
+	double  scale_     = 1.0;
+	QPointF cameraPos_ = { 0.0, 0.0 };
+
+	/// Keyed by `row * columnCount + column`
+	QHash<int, QPixmap> tiles_;
+};
@@ -0,0 +1,179 @@
+#include "pvnLib/Novel/Widget/Transition.h"
+
+#include <cmath>
+#include <QPainter>
+
+void Transition::start(const QPixmap& from, const QPixmap& to, Type type, uint duration, const QImage& mask)
+{
+	stop();
+	if (duration == 0 || to.isNull())
+		return;
+
+	from_      = from;
+	to_        = to;
+	type_      = type;
+	duration_  = duration;
+	startTime_ = -1;
+	progress_  = 0.0;
+	bActive_   = true;
+
+	if (type_ != Type::Dissolve)
+		return;
+
+	//Everything the Dissolve needs is allocated here, the frames are written into `dissolveFrame_`
+	toImage_       = to_.toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	dissolveFrame_ = QImage(toImage_.size(), QImage::Format_ARGB32_Premultiplied);
+	if (!mask.isNull())
+		dissolveMask_ = mask.convertToFormat(QImage::Format_Grayscale8).scaled(toImage_.size(), Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+	else
+	{
+		dissolveMask_ = QImage(toImage_.size(), QImage::Format_Grayscale8);
+		for (int y = 0; y != dissolveMask_.height(); ++y)
+		{
+			uchar* line = dissolveMask_.scanLine(y);
+			for (int x = 0; x != dissolveMask_.width(); ++x)
+			{
+				//Integer hash, so the noise is the same every time
+				uint hash = static_cast<uint>(x) * 73856093u ^ static_cast<uint>(y) * 19349663u;
+				hash ^= hash >> 13;
+				hash *= 0x5bd1e995u;
+				hash ^= hash >> 15;
+				line[x] = static_cast<uchar>(hash & 0xFFu);
+			}
+		}
+	}
+	dissolveFrameProgress_ = -1.0;
+}
+
+void Transition::stop() noexcept
+{
+	bActive_       = false;
+	progress_      = 1.0;
+	from_          = QPixmap();
+	to_            = QPixmap();
+	toImage_       = QImage();
+	dissolveMask_  = QImage();
+	dissolveFrame_ = QImage();
+}
+
+bool Transition::isActive() const noexcept
+{
+	return bActive_;
+}
+
+bool Transition::advance(uint elapsedTime)
+{
+	if (!bActive_)
+		return false;
+
+	if (startTime_ < 0)
+		startTime_ = elapsedTime;
+
+	progress_ = qBound(0.0, static_cast<double>(elapsedTime - startTime_) / duration_, 1.0);
+	if (progress_ < 1.0)
+		return false;
+
+	stop();
+	return true;
+}
+
+double Transition::getProgress() const noexcept
+{
+	return progress_;
+}
+
+void Transition::paint(QPainter* painter, const QRectF& target, bool bOpaque)
+{
+	paint(painter, target, target, bOpaque);
+}
+
+void Transition::paint(QPainter* painter, const QRectF& fromTarget, const QRectF& toTarget, bool bOpaque)
+{
+	if (!bActive_)
+		return;
+
+	//Item's opacity is already set on the painter, the blend factor has to be multiplied by it
+	const double opacity = painter->opacity();
+	const double t       = progress_;
+
+	painter->save();
+	painter->setRenderHint(QPainter::SmoothPixmapTransform);
+	switch (type_)
+	{
+	case Type::CrossFade:
+		if (!from_.isNull())
+		{
+			//An opaque image underneath does not need to fade out, which keeps the colors from dimming in the middle
+			painter->setOpacity(opacity * (bOpaque ? 1.0 : 1.0 - t));
+			painter->drawPixmap(fromTarget, from_, from_.rect());
+		}
+		painter->setOpacity(opacity * t);
+		painter->drawPixmap(toTarget, to_, to_.rect());
+		break;
+	case Type::FadeOutToFadeIn:
+		if (bOpaque)
+			painter->fillRect(toTarget, Qt::black);
+		if (t < 0.5)
+		{
+			if (!from_.isNull())
+			{
+				painter->setOpacity(opacity * (1.0 - 2.0 * t));
+				painter->drawPixmap(fromTarget, from_, from_.rect());
+			}
+		}
+		else
+		{
+			painter->setOpacity(opacity * (2.0 * t - 1.0));
+			painter->drawPixmap(toTarget, to_, to_.rect());
+		}
+		break;
+	case Type::Slide:
+	{
+		painter->setClipRect(fromTarget.united(toTarget), Qt::IntersectClip);
+		const double shift = toTarget.width() * t;
+		if (!from_.isNull())
+			painter->drawPixmap(fromTarget.translated(shift, 0.0), from_, from_.rect());
+		painter->drawPixmap(toTarget.translated(shift - toTarget.width(), 0.0), to_, to_.rect());
+		break;
+	}
+	case Type::Dissolve:
+		if (!from_.isNull())
+		{
+			painter->setOpacity(opacity * (bOpaque ? 1.0 : 1.0 - t));
+			painter->drawPixmap(fromTarget, from_, from_.rect());
+			painter->setOpacity(opacity);
+		}
+		updateDissolveFrame();
+		painter->drawImage(toTarget, dissolveFrame_, dissolveFrame_.rect());
+		break;
+	}
+	painter->restore();
+}
+
+void Transition::updateDissolveFrame()
+{
+	if (dissolveFrameProgress_ == progress_)
+		return;
+	dissolveFrameProgress_ = progress_;
+
+	//Width of the soft edge between the appeared and not yet appeared pixels, as a part of the mask's range
+	constexpr double SOFTNESS = 0.1;
+	const double threshold = progress_ * (1.0 + SOFTNESS);
+	for (int value = 0; value != 256; ++value)
+		dissolveLookup_[value] = static_cast<uint>(std::lround(qBound(0.0, (threshold - value / 255.0) / SOFTNESS, 1.0) * 256.0));
+
+	const int width = toImage_.width();
+	for (int y = 0; y != toImage_.height(); ++y)
+	{
+		const uchar* maskLine   = dissolveMask_.constScanLine(y);
+		const QRgb*  sourceLine = reinterpret_cast<const QRgb*>(toImage_.constScanLine(y));
+		QRgb*        frameLine  = reinterpret_cast<QRgb*>(dissolveFrame_.scanLine(y));
+		for (int x = 0; x != width; ++x)
+		{
+			//Premultiplied pixel, so all four channels are scaled alike, two at a time
+			const uint alpha = dissolveLookup_[maskLine[x]];
+			frameLine[x] = ((((sourceLine[x] & 0x00FF00FFu) * alpha) >> 8) & 0x00FF00FFu) |
+						   ((((sourceLine[x] >> 8) & 0x00FF00FFu) * alpha) & 0xFF00FF00u);
+		}
+	}
+}
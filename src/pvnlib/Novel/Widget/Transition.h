@@ -0,0 +1,76 @@
+#pragma once
+#include <QImage>
+#include <QPixmap>
+#include <QRectF>
+#include <array>
+
+class QPainter;
+
+/// Blends two images over time, used when a background or a sprite is replaced
+/// Both images are prepared once, when the Transition starts, so a frame only draws them with a different blend factor and does not allocate any images
+/// The time comes from the game clock (see `Novel::update()`), so pausing the game also pauses the Transitions
+class Transition final
+{
+public:
+	enum class Type
+	{
+		/// The new image fades in over the old one
+		CrossFade,
+		/// The old image fades out completely and the new image fades in afterwards
+		FadeOutToFadeIn,
+		/// The new image pushes the old one out to the right
+		Slide,
+		/// The new image appears pixel by pixel, in the order given by the brightness of a mask
+		Dissolve
+	};
+
+	Transition() = default;
+	Transition(const Transition&)            = delete;
+	Transition& operator=(const Transition&) = delete;
+
+	/// \param from Currently displayed image, might be null if nothing was displayed
+	/// \param to Image that replaces `from`, both of them should already have the size they will be drawn at
+	/// \param duration In milliseconds, 0 displays `to` immediately
+	/// \param mask Grayscale image used by the Dissolve, darker pixels appear first; if null, a noise mask is generated
+	void start(const QPixmap& from, const QPixmap& to, Type type, uint duration, const QImage& mask = QImage());
+	/// Jumps to the end of the Transition
+	void stop() noexcept;
+	bool isActive() const noexcept;
+
+	/// Advances the Transition to the game clock's time, the first call after `start()` marks its beginning
+	/// \param elapsedTime Game clock's time in milliseconds
+	/// \return Whether the Transition has ended during this call
+	bool advance(uint elapsedTime);
+	/// \return Blend factor in the [0.0, 1.0] range
+	double getProgress() const noexcept;
+
+	/// Draws the current frame
+	/// \param bOpaque Backgrounds fade through black, sprites fade through transparency
+	void paint(QPainter* painter, const QRectF& target, bool bOpaque);
+	/// Draws the current frame, when the images are not drawn at the same rectangle (e.g. sprites of different sizes)
+	void paint(QPainter* painter, const QRectF& fromTarget, const QRectF& toTarget, bool bOpaque);
+
+private:
+	/// Writes the current Dissolve frame into the preallocated `dissolveFrame_`
+	void updateDissolveFrame();
+
+	Type type_     = Type::CrossFade;
+	uint duration_ = 0;
+	/// -1 until the first `advance()` after `start()`
+	qint64 startTime_ = -1;
+	double progress_  = 1.0;
+	bool   bActive_   = false;
+
+	QPixmap from_;
+	QPixmap to_;
+
+	//Dissolve only
+	QImage toImage_;
+	/// Mask scaled to the size of `toImage_`, in the `QImage::Format_Grayscale8` format
+	QImage dissolveMask_;
+	QImage dissolveFrame_;
+	/// Progress that `dissolveFrame_` was calculated for
+	double dissolveFrameProgress_ = -1.0;
+	/// Alpha (0-256) of every mask's value for the current progress
+	std::array<uint, 256> dissolveLookup_{};
+};
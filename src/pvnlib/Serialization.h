@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QDataStream>
+#include <QIODevice>
 
 //[polish personal note; optional todo] Teoretycznie moglibysmy w Serializacji na samym poczatku zliczyc rozmiar calej struktury, tak ze jak wystapi blad przy wczytywaniu jednego obiektu z pliku, to dalo sie wczytac reszte (przeskoczyc znacznikiem do miejsca, gdzie jest nastepny obiekt). Mozna dodac kompresje zapisow
 
@@ -47,6 +48,39 @@ namespace NovelLib
         EventJump                           = 36,
         EventWait                           = 37
     };
+
+    /// Written before the objects that gained new fields after their files (Scenes, Saves, etc.) were already in use, followed by the object's format version
+    /// These objects start with a QString, QByteArray or a container's size, which can never have this value (a UTF-16 string has an even size in bytes)
+    constexpr quint32 SERIALIZATION_VERSION_MARKER = 0xFFFFFFFD;
+
+    /// Saves the format version of the object that is serialized next
+    inline void saveSerializationVersion(QDataStream& dataStream, quint32 version)
+    {
+        dataStream << SERIALIZATION_VERSION_MARKER << version;
+    }
+
+    /// Loads the format version saved by `saveSerializationVersion()`
+    /// \return 0 if the object was saved before it had a version, nothing is consumed from the stream then
+    inline quint32 loadSerializationVersion(QDataStream& dataStream)
+    {
+        QIODevice* device = dataStream.device();
+        const qint64 pos  = device ? device->pos() : 0;
+
+        quint32 marker = 0;
+        dataStream >> marker;
+        if (marker == SERIALIZATION_VERSION_MARKER)
+        {
+            quint32 version = 0;
+            dataStream >> version;
+            return version;
+        }
+
+        //Files and buffers are random-access, so the first field can be read again
+        if (device)
+            device->seek(pos);
+        dataStream.resetStatus();
+        return 0;
+    }
 }
 
 /// Serialization loading
@@ -0,0 +1,111 @@
+#include <QTest>
+#include <QDataStream>
+
+#include "pvnlib/Novel/Data/Visual/Animation/AnimInterpolation.h"
+
+using namespace NovelLib::Interpolation;
+
+class TestAnimInterpolation : public QObject
+{
+    Q_OBJECT
+private slots:
+    void cubicBezierEndpoints();
+    void cubicBezierLinearControlPoints();
+    void cubicBezierDefaultCurve();
+    void cubicBezierMonotonic();
+    void interpolateUsesTargetControlPoints();
+    void interpolateLongLongRounds();
+    void bezierControlPointsSerialization();
+};
+
+void TestAnimInterpolation::cubicBezierEndpoints()
+{
+    QCOMPARE(cubicBezier(0.0, 0.25, 0.1, 0.25, 1.0), 0.0);
+    QVERIFY(qAbs(cubicBezier(1.0, 0.25, 0.1, 0.25, 1.0) - 1.0) < 1e-6);
+}
+
+void TestAnimInterpolation::cubicBezierLinearControlPoints()
+{
+    // Control points on the diagonal make the curve the identity
+    for (double x = 0.0; x <= 1.0; x += 0.05)
+        QVERIFY(qAbs(cubicBezier(x, 1.0 / 3.0, 1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0) - x) < 1e-6);
+}
+
+void TestAnimInterpolation::cubicBezierDefaultCurve()
+{
+    // CSS `ease`, which is also the AnimNode's default, is ~0.8024 in the middle
+    QVERIFY(qAbs(cubicBezier(0.5, 0.25, 0.1, 0.25, 1.0) - 0.8024) < 1e-3);
+}
+
+void TestAnimInterpolation::cubicBezierMonotonic()
+{
+    double previous = 0.0;
+    for (int i = 1; i <= 100; ++i)
+    {
+        const double current = cubicBezier(i / 100.0, 0.42, 0.0, 0.58, 1.0);
+        QVERIFY(current >= previous);
+        previous = current;
+    }
+}
+
+void TestAnimInterpolation::interpolateUsesTargetControlPoints()
+{
+    using Method = AnimNodeBase::AnimInterpolationMethod;
+
+    AnimNodeDouble2D from(0, Method::Linear, { 0.0, 100.0 });
+    AnimNodeDouble2D to(1000, Method::CubicBezier, { 10.0, 200.0 }, { 1.0 / 3.0, 1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0 });
+    AnimNodeDouble2D out(0, Method::Linear, { 0.0, 0.0 });
+
+    selectInterpolator<AnimNodeDouble2D>(to.interpolationMethod)(from, to, out, 0.25);
+    QVERIFY(qAbs(out.state_[0] - 2.5) < 1e-4);
+    QVERIFY(qAbs(out.state_[1] - 125.0) < 1e-4);
+
+    to.bezierControlPoints = { 0.25, 0.1, 0.25, 1.0 };
+    selectInterpolator<AnimNodeDouble2D>(to.interpolationMethod)(from, to, out, 0.5);
+    QVERIFY(qAbs(out.state_[0] - 8.024) < 1e-2);
+}
+
+void TestAnimInterpolation::interpolateLongLongRounds()
+{
+    using Method = AnimNodeBase::AnimInterpolationMethod;
+
+    AnimNodeLongLong4D from(0, Method::Linear, { 0, 0, 255, 10 });
+    AnimNodeLongLong4D to(1000, Method::Linear, { 255, 1, 0, 10 });
+    AnimNodeLongLong4D out(0, Method::Linear, { 0, 0, 0, 0 });
+
+    selectInterpolator<AnimNodeLongLong4D>(to.interpolationMethod)(from, to, out, 0.5);
+    QCOMPARE(out.state_[0], 128LL);
+    QCOMPARE(out.state_[1], 1LL);
+    QCOMPARE(out.state_[2], 127LL);
+    QCOMPARE(out.state_[3], 10LL);
+}
+
+void TestAnimInterpolation::bezierControlPointsSerialization()
+{
+    using Method = AnimNodeBase::AnimInterpolationMethod;
+
+    AnimNodeDouble2D bezierNode(500, Method::CubicBezier, { 1.0, 2.0 }, { 0.1, 0.2, 0.3, 0.4 }),
+                     linearNode(700, Method::Linear, { 3.0, 4.0 });
+
+    QByteArray data;
+    {
+        QDataStream dataStream(&data, QIODeviceBase::WriteOnly);
+        dataStream << bezierNode << linearNode;
+    }
+
+    AnimNodeDouble2D loadedBezierNode, loadedLinearNode;
+    QDataStream dataStream(data);
+    dataStream >> loadedBezierNode >> loadedLinearNode;
+
+    QCOMPARE(loadedBezierNode.timeStamp, 500u);
+    QCOMPARE(loadedBezierNode.interpolationMethod, Method::CubicBezier);
+    QCOMPARE(loadedBezierNode.bezierControlPoints, (std::array<double, 4>{ 0.1, 0.2, 0.3, 0.4 }));
+    QCOMPARE(loadedBezierNode.state_[1], 2.0);
+    // The Node after the Bézier one is read from the right place
+    QCOMPARE(loadedLinearNode.timeStamp, 700u);
+    QCOMPARE(loadedLinearNode.state_[0], 3.0);
+    QVERIFY(dataStream.atEnd());
+}
+
+QTEST_MAIN(TestAnimInterpolation)
+#include "testAnimInterpolation.moc"
@@ -0,0 +1,149 @@
+#include <QTest>
+#include <QAudioDecoder>
+#include <QDataStream>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "pvnlib/Novel/Audio/AudioEngine.h"
+
+class TestAudioEngine : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanup();
+    void renderedSoundSamples();
+    void startDelayAndVolume();
+    void mixesSounds();
+
+private:
+    // Writes `frameCount` frames of the same stereo sample at the AudioEngine's sample rate
+    QString writeWav(const QString& fileName, qint16 left, qint16 right, int frameCount);
+    // Renders `duration` milliseconds offline and returns the interleaved samples
+    std::vector<qint16> render(uint duration);
+    Sound makeSound(const QString& filePath, double volume = 1.0, uint startDelay = 0);
+
+    QTemporaryDir tempDir;
+};
+
+QString TestAudioEngine::writeWav(const QString& fileName, qint16 left, qint16 right, int frameCount)
+{
+    const QString filePath = tempDir.filePath(fileName);
+    QFile file(filePath);
+    if (!file.open(QIODeviceBase::WriteOnly))
+        return QString();
+
+    constexpr quint16 BLOCK_ALIGN = PcmBuffer::CHANNELS * sizeof(qint16);
+    const quint32 dataBytes = frameCount * BLOCK_ALIGN;
+    QDataStream dataStream(&file);
+    dataStream.setByteOrder(QDataStream::LittleEndian);
+    dataStream.writeRawData("RIFF", 4);
+    dataStream << quint32(36 + dataBytes);
+    dataStream.writeRawData("WAVEfmt ", 8);
+    dataStream << quint32(16) << quint16(1) << quint16(PcmBuffer::CHANNELS) << quint32(PcmBuffer::SAMPLE_RATE)
+               << quint32(PcmBuffer::SAMPLE_RATE * BLOCK_ALIGN) << BLOCK_ALIGN << quint16(16);
+    dataStream.writeRawData("data", 4);
+    dataStream << dataBytes;
+    for (int i = 0; i != frameCount; ++i)
+        dataStream << left << right;
+    return filePath;
+}
+
+std::vector<qint16> TestAudioEngine::render(uint duration)
+{
+    const QString filePath = tempDir.filePath("render.wav");
+    if (!AudioEngine::getInstance().renderOffline(filePath, duration))
+        return {};
+
+    QFile file(filePath);
+    if (!file.open(QIODeviceBase::ReadOnly))
+        return {};
+    file.seek(44);
+
+    std::vector<qint16> samples;
+    QDataStream dataStream(&file);
+    dataStream.setByteOrder(QDataStream::LittleEndian);
+    while (!dataStream.atEnd())
+    {
+        qint16 sample;
+        dataStream >> sample;
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+Sound TestAudioEngine::makeSound(const QString& filePath, double volume, uint startDelay)
+{
+    Sound sound;
+    sound.name          = "Sound";
+    sound.soundFilePath = filePath;
+    sound.audioSettings = AudioSettings(volume);
+    sound.startDelay    = startDelay;
+    return sound;
+}
+
+void TestAudioEngine::initTestCase()
+{
+    QVERIFY(tempDir.isValid());
+    if (!QAudioDecoder().isSupported())
+        QSKIP("No audio decoding backend is available");
+    AudioEngine::getInstance().setOutputMode(AudioEngine::OutputMode::Offline);
+}
+
+void TestAudioEngine::cleanup()
+{
+    AudioEngine::getInstance().stopSounds(true);
+    // Lets the mixer drop the stopped Sounds
+    render(1);
+}
+
+void TestAudioEngine::renderedSoundSamples()
+{
+    // 50 ms of a quarter of the full scale, inverted on the right
+    const QString filePath = writeWav("quarter.wav", 8192, -8192, PcmBuffer::SAMPLE_RATE / 20);
+    QVERIFY(!filePath.isEmpty());
+
+    AudioEngine::getInstance().playSound(makeSound(filePath));
+    const std::vector<qint16> samples = render(100);
+    QCOMPARE(samples.size(), size_t(PcmBuffer::SAMPLE_RATE / 10 * PcmBuffer::CHANNELS));
+
+    QVERIFY(qAbs(samples[2 * 100] - 8192) <= 4);
+    QVERIFY(qAbs(samples[2 * 100 + 1] + 8192) <= 4);
+    QVERIFY(qAbs(samples[2 * 2300] - 8192) <= 4);
+    // The Sound has ended
+    QCOMPARE(samples[2 * 2500], qint16(0));
+    QCOMPARE(samples.back(), qint16(0));
+}
+
+void TestAudioEngine::startDelayAndVolume()
+{
+    const QString filePath = writeWav("delayed.wav", 8192, -8192, PcmBuffer::SAMPLE_RATE / 20);
+    QVERIFY(!filePath.isEmpty());
+
+    // 20 ms is 960 frames
+    AudioEngine::getInstance().playSound(makeSound(filePath, 0.5, 20));
+    const std::vector<qint16> samples = render(100);
+    QVERIFY(!samples.empty());
+
+    QCOMPARE(samples[2 * 900], qint16(0));
+    QVERIFY(qAbs(samples[2 * 1000] - 4096) <= 4);
+    QVERIFY(qAbs(samples[2 * 1000 + 1] + 4096) <= 4);
+}
+
+void TestAudioEngine::mixesSounds()
+{
+    const QString filePath = writeWav("mixed.wav", 8192, -8192, PcmBuffer::SAMPLE_RATE / 20);
+    QVERIFY(!filePath.isEmpty());
+
+    AudioEngine& audioEngine = AudioEngine::getInstance();
+    audioEngine.playSound(makeSound(filePath));
+    audioEngine.playSound(makeSound(filePath));
+    const std::vector<qint16> samples = render(50);
+    QVERIFY(!samples.empty());
+
+    QVERIFY(qAbs(samples[2 * 100] - 16384) <= 4);
+    QVERIFY(qAbs(samples[2 * 100 + 1] + 16384) <= 4);
+}
+
+QTEST_MAIN(TestAudioEngine)
+#include "testAudioEngine.moc"
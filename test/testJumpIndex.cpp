@@ -0,0 +1,114 @@
+#include <QTest>
+
+#include "pvnlib/Novel/Data/Novel.h"
+#include "pvnlib/Novel/Event/EventChoice.h"
+#include "pvnlib/Novel/Event/EventJump.h"
+
+class TestJumpIndex : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+    void indexesJumps();
+    void renameRetargetsJumpsInto();
+    void renameMovesJumpsOutOf();
+    void removeClearsJumpsInto();
+    void insertedChoiceShiftsJumps();
+
+private:
+    // "Scene A" jumps to "Scene B", "Scene C" has Choices leading to "Scene B" and "Scene A"
+    EventJump*   jump   = nullptr;
+    EventChoice* choice = nullptr;
+};
+
+void TestJumpIndex::init()
+{
+    Novel& novel = Novel::getInstance();
+    Scene* sceneA = novel.addScene(Scene("Scene A"));
+    novel.addScene(Scene("Scene B"));
+    Scene* sceneC = novel.addScene(Scene("Scene C"));
+
+    jump = new EventJump(sceneA, "Jump", "Scene B");
+    sceneA->insertEvent(0, jump);
+
+    choice = new EventChoice(sceneC, "Choice");
+    sceneC->insertEvent(0, choice);
+    choice->addChoice(Choice(choice, Translation({ { "En", "To B" } }), "Scene B"));
+    choice->addChoice(Choice(choice, Translation({ { "En", "To A" } }), "Scene A"));
+}
+
+void TestJumpIndex::cleanup()
+{
+    Novel::getInstance().clearNovel();
+    jump   = nullptr;
+    choice = nullptr;
+}
+
+void TestJumpIndex::indexesJumps()
+{
+    const JumpIndex& jumpIndex = Novel::getInstance().getJumpIndex();
+
+    QCOMPARE(jumpIndex.getJumpsTo("Scene B").size(), size_t(2));
+    QCOMPARE(jumpIndex.getJumpsTo("Scene A").size(), size_t(1));
+    QCOMPARE(jumpIndex.getJumpsFrom("Scene C").size(), size_t(2));
+    QVERIFY(jumpIndex.getJumpsFrom("Scene B").empty());
+
+    const JumpIndex::Jump& jumpToA = jumpIndex.getJumpsTo("Scene A").front();
+    QCOMPARE(jumpToA.sourceSceneName, QString("Scene C"));
+    QCOMPARE(jumpToA.event, static_cast<Event*>(choice));
+    QCOMPARE(jumpToA.choiceIndex, 1);
+}
+
+void TestJumpIndex::renameRetargetsJumpsInto()
+{
+    Novel& novel = Novel::getInstance();
+    QVERIFY(novel.renameScene("Scene B", "Scene D"));
+
+    QCOMPARE(jump->jumpToSceneName, QString("Scene D"));
+    QCOMPARE(choice->getChoice(0)->jumpToSceneName, QString("Scene D"));
+    QCOMPARE(choice->getChoice(1)->jumpToSceneName, QString("Scene A"));
+
+    QVERIFY(novel.getJumpIndex().getJumpsTo("Scene B").empty());
+    QCOMPARE(novel.getJumpIndex().getJumpsTo("Scene D").size(), size_t(2));
+}
+
+void TestJumpIndex::renameMovesJumpsOutOf()
+{
+    Novel& novel = Novel::getInstance();
+    QVERIFY(novel.renameScene("Scene C", "Scene E"));
+
+    QVERIFY(novel.getJumpIndex().getJumpsFrom("Scene C").empty());
+    QCOMPARE(novel.getJumpIndex().getJumpsFrom("Scene E").size(), size_t(2));
+    QCOMPARE(novel.getJumpIndex().getJumpsTo("Scene A").front().sourceSceneName, QString("Scene E"));
+}
+
+void TestJumpIndex::removeClearsJumpsInto()
+{
+    Novel& novel = Novel::getInstance();
+    QVERIFY(novel.removeScene("Scene B"));
+
+    QVERIFY(jump->jumpToSceneName.isEmpty());
+    QVERIFY(choice->getChoice(0)->jumpToSceneName.isEmpty());
+    QCOMPARE(choice->getChoice(1)->jumpToSceneName, QString("Scene A"));
+
+    QVERIFY(novel.getJumpIndex().getJumpsTo("Scene B").empty());
+    QVERIFY(novel.getJumpIndex().getJumpsFrom("Scene A").empty());
+    QCOMPARE(novel.getJumpIndex().getJumpsFrom("Scene C").size(), size_t(1));
+}
+
+void TestJumpIndex::insertedChoiceShiftsJumps()
+{
+    Novel& novel = Novel::getInstance();
+    // The same path as inserting a row in the EventChoice's properties
+    choice->insertChoice(0, Choice(choice));
+    QCOMPARE(novel.getJumpIndex().getJumpsTo("Scene A").front().choiceIndex, 2);
+
+    QVERIFY(novel.renameScene("Scene A", "Scene D"));
+    QVERIFY(choice->getChoice(0)->jumpToSceneName.isEmpty());
+    QCOMPARE(choice->getChoice(1)->jumpToSceneName, QString("Scene B"));
+    QCOMPARE(choice->getChoice(2)->jumpToSceneName, QString("Scene D"));
+}
+
+QTEST_MAIN(TestJumpIndex)
+#include "testJumpIndex.moc"
@@ -0,0 +1,88 @@
+#include <QTest>
+
+#include "pvnlib/Novel/Data/Novel.h"
+#include "pvnlib/Novel/Event/EventDialogue.h"
+
+class TestSearchIndex : public QObject
+{
+    Q_OBJECT
+private slots:
+    void cleanup();
+    void findTextAfterSentenceEdit();
+    void findTextIntersectsWords();
+    void removedSceneIsNotFound();
+
+private:
+    // Adds a Scene with a single EventDialogue containing a Sentence for every text
+    EventDialogue* addDialogue(const QString& sceneName, const QStringList& texts);
+};
+
+EventDialogue* TestSearchIndex::addDialogue(const QString& sceneName, const QStringList& texts)
+{
+    Novel& novel = Novel::getInstance();
+    Scene* scene = novel.addScene(Scene(sceneName));
+    EventDialogue* dialogue = new EventDialogue(scene, "Dialogue");
+    scene->insertEvent(0, dialogue);
+    for (const QString& text : texts)
+        dialogue->addSentence(Sentence(dialogue, Translation({ { "En", text } })));
+    novel.sceneChanged(*scene);
+    return dialogue;
+}
+
+void TestSearchIndex::cleanup()
+{
+    Novel::getInstance().clearNovel();
+}
+
+void TestSearchIndex::findTextAfterSentenceEdit()
+{
+    Novel& novel = Novel::getInstance();
+    EventDialogue* dialogue = addDialogue("Scene 1", { "The quick brown fox" });
+
+    std::vector<SearchIndex::Location> locations = novel.getSearchIndex().findText("quick FOX");
+    QCOMPARE(locations.size(), size_t(1));
+    QCOMPARE(locations[0].sceneName, QString("Scene 1"));
+    QCOMPARE(locations[0].event, static_cast<Event*>(dialogue));
+    QCOMPARE(locations[0].elementIndex, 0);
+
+    // The same path as editing the text in the EventDialogue's properties
+    dialogue->getSentence(0)->translation.setTranslation("En", "The lazy dog");
+    novel.sceneChanged(*dialogue->parentScene);
+
+    QVERIFY(novel.getSearchIndex().findText("quick").empty());
+    locations = novel.getSearchIndex().findText("lazy dog");
+    QCOMPARE(locations.size(), size_t(1));
+    QCOMPARE(locations[0].elementIndex, 0);
+}
+
+void TestSearchIndex::findTextIntersectsWords()
+{
+    Novel& novel = Novel::getInstance();
+    addDialogue("Scene 1", { "red apple", "green apple", "red pear" });
+    addDialogue("Scene 2", { "apple pie", "red sky" });
+
+    QCOMPARE(novel.getSearchIndex().findText("apple").size(), size_t(3));
+    QCOMPARE(novel.getSearchIndex().findText("red").size(), size_t(3));
+
+    std::vector<SearchIndex::Location> locations = novel.getSearchIndex().findText("apple red");
+    QCOMPARE(locations.size(), size_t(1));
+    QCOMPARE(locations[0].sceneName, QString("Scene 1"));
+    QCOMPARE(locations[0].elementIndex, 0);
+
+    // Words in different Sentences of the same Scene are not a match
+    QVERIFY(novel.getSearchIndex().findText("green pear").empty());
+    QVERIFY(novel.getSearchIndex().findText("banana").empty());
+}
+
+void TestSearchIndex::removedSceneIsNotFound()
+{
+    Novel& novel = Novel::getInstance();
+    addDialogue("Scene 1", { "hidden treasure" });
+    QCOMPARE(novel.getSearchIndex().findText("treasure").size(), size_t(1));
+
+    novel.removeScene("Scene 1");
+    QVERIFY(novel.getSearchIndex().findText("treasure").empty());
+}
+
+QTEST_MAIN(TestSearchIndex)
+#include "testSearchIndex.moc"
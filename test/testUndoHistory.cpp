@@ -0,0 +1,168 @@
+#include <QTest>
+
+#include "Editor/ChoiceItemModel.h"
+#include "Editor/UndoHistory.h"
+#include "pvnlib/Novel/Data/Novel.h"
+#include "pvnlib/Novel/Event/EventChoice.h"
+#include "pvnlib/Novel/Event/EventJump.h"
+
+class TestUndoHistory : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+    void eventFieldUndoRedo();
+    void consecutiveChangesMerge();
+    void mergeBoundarySplitsChanges();
+    void defaultSceneryObjectUndoRedo();
+    void displayedSceneryObjectUndoRedo();
+    void choiceRowInsertionUndoRedo();
+
+private:
+    // Changes the Jump's condition the same way the editor's properties do: first the field, then the record
+    void changeCondition(const QString& condition);
+
+    EventJump* jump = nullptr;
+};
+
+void TestUndoHistory::init()
+{
+    Scene* scene = Novel::getInstance().addScene(Scene("Scene 1"));
+    jump = new EventJump(scene, "Jump", "", "a");
+    scene->insertEvent(0, jump);
+}
+
+void TestUndoHistory::cleanup()
+{
+    UndoHistory::getInstance()->clear();
+    Novel::getInstance().clearNovel();
+    jump = nullptr;
+}
+
+void TestUndoHistory::changeCondition(const QString& condition)
+{
+    const QString oldCondition = jump->condition;
+    jump->condition = condition;
+    UndoHistory::getInstance()->pushEventFieldChange<EventJump, QString>(*jump, [](EventJump& event) { return &event.condition; }, oldCondition, condition, "condition");
+}
+
+void TestUndoHistory::eventFieldUndoRedo()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    QVERIFY(!undoHistory->canUndo());
+
+    changeCondition("b");
+    QVERIFY(undoHistory->canUndo());
+    QVERIFY(!undoHistory->canRedo());
+
+    undoHistory->undo();
+    QCOMPARE(jump->condition, QString("a"));
+    QVERIFY(!undoHistory->canUndo());
+    QVERIFY(undoHistory->canRedo());
+
+    undoHistory->redo();
+    QCOMPARE(jump->condition, QString("b"));
+    QVERIFY(undoHistory->canUndo());
+    QVERIFY(!undoHistory->canRedo());
+}
+
+void TestUndoHistory::consecutiveChangesMerge()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    changeCondition("b");
+    changeCondition("c");
+
+    undoHistory->undo();
+    QCOMPARE(jump->condition, QString("a"));
+    QVERIFY(!undoHistory->canUndo());
+}
+
+void TestUndoHistory::mergeBoundarySplitsChanges()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    changeCondition("b");
+    undoHistory->setMergeBoundary();
+    changeCondition("c");
+
+    undoHistory->undo();
+    QCOMPARE(jump->condition, QString("b"));
+    undoHistory->undo();
+    QCOMPARE(jump->condition, QString("a"));
+    QVERIFY(!undoHistory->canUndo());
+}
+
+void TestUndoHistory::defaultSceneryObjectUndoRedo()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    SceneryObject newSceneryObject;
+    newSceneryObject.name = "Object";
+    SceneryObject* sceneryObject = Novel::getInstance().setDefaultSceneryObject(newSceneryObject);
+
+    const QPointF oldPos = sceneryObject->pos;
+    sceneryObject->pos = { 10.0, 20.0 };
+    undoHistory->pushSceneryObjectFieldChange<QPointF>(SceneryObjectLocation::defaultSceneryObject("Object"), [](SceneryObject& object) { return &object.pos; }, oldPos, sceneryObject->pos, "pos");
+
+    undoHistory->undo();
+    QCOMPARE(Novel::getInstance().getDefaultSceneryObject("Object")->pos, oldPos);
+    undoHistory->redo();
+    QCOMPARE(Novel::getInstance().getDefaultSceneryObject("Object")->pos, QPointF(10.0, 20.0));
+}
+
+void TestUndoHistory::displayedSceneryObjectUndoRedo()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    Scenery& scenery = Novel::getInstance().getScene("Scene 1")->scenery;
+    SceneryObject first, second;
+    first.name  = "First";
+    second.name = "Second";
+    scenery.addDisplayedSceneryObject(first);
+    SceneryObject* sceneryObject = scenery.addDisplayedSceneryObject(second);
+
+    // The view passes the Scenery it shows, so only that one is searched
+    const SceneryObjectLocation location = SceneryObjectLocation::displayedIn("Scene 1", -1, &scenery, *sceneryObject);
+    QVERIFY(location.owner == SceneryObjectLocation::Owner::Scenery);
+    QCOMPARE(location.index, 1u);
+
+    const QSizeF oldScale = sceneryObject->scale;
+    sceneryObject->scale = { 2.0, 3.0 };
+    undoHistory->pushSceneryObjectFieldChange<QSizeF>(location, [](SceneryObject& object) { return &object.scale; }, oldScale, sceneryObject->scale, "scale");
+
+    undoHistory->undo();
+    QCOMPARE(scenery.getDisplayedSceneryObject(1u)->scale, oldScale);
+    QCOMPARE(scenery.getDisplayedSceneryObject(0u)->scale, oldScale);
+    undoHistory->redo();
+    QCOMPARE(scenery.getDisplayedSceneryObject(1u)->scale, QSizeF(2.0, 3.0));
+}
+
+void TestUndoHistory::choiceRowInsertionUndoRedo()
+{
+    UndoHistory* undoHistory = UndoHistory::getInstance();
+    Scene* scene = Novel::getInstance().getScene("Scene 1");
+    EventChoice* choice = new EventChoice(scene, "Choice");
+    scene->insertEvent(1, choice);
+    choice->addChoice(Choice(choice, Translation({ { "En", "Only" } }), "", "a"));
+
+    // The Condition column, the JumpToScene one is the only one that needs the GraphView
+    ChoiceItemModel model(choice, nullptr);
+    QVERIFY(model.setData(model.index(0, 3), "b", Qt::EditRole));
+    undoHistory->setMergeBoundary();
+    QVERIFY(model.insertRows(0, 1));
+    QCOMPARE(choice->getChoices()->size(), size_t(2));
+    QCOMPARE(choice->getChoice(1)->condition, QString("b"));
+
+    // The insertion is undone first, so the condition change finds its Choice at the original row again
+    undoHistory->undo();
+    QCOMPARE(choice->getChoices()->size(), size_t(1));
+    undoHistory->undo();
+    QCOMPARE(choice->getChoice(0)->condition, QString("a"));
+
+    undoHistory->redo();
+    undoHistory->redo();
+    QCOMPARE(choice->getChoices()->size(), size_t(2));
+    QVERIFY(choice->getChoice(0)->condition.isEmpty());
+    QCOMPARE(choice->getChoice(1)->condition, QString("b"));
+}
+
+QTEST_MAIN(TestUndoHistory)
+#include "testUndoHistory.moc"